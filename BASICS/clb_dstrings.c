@@ -176,7 +176,7 @@ char* DStrAppendChar(DStr_p strdes, char newch)
 // Function: DStrAppendBuffer()
 //
 //   Append a (not necessarily 0-terminated) buffer to the end of a
-//   DStr.
+//   DStr with a single copy.
 //
 // Global Variables: -
 //
@@ -186,15 +186,25 @@ char* DStrAppendChar(DStr_p strdes, char newch)
 
 char* DStrAppendBuffer(DStr_p strdes, char* buf, int len)
 {
-   int i;
+   long newmem;
 
    assert(strdes);
    assert(buf);
 
-   for(i=0; i<len; i++)
+   newmem = strdes->mem;
+   while(strdes->len+len >= newmem)
    {
-      DStrAppendChar(strdes, buf[i]);
+      newmem += DSTRGROW;
    }
+   if(newmem > strdes->mem)
+   {
+      strdes->string = SecureRealloc(strdes->string, newmem);
+      strdes->mem = newmem;
+   }
+   memcpy(strdes->string+strdes->len, buf, len);
+   strdes->len += len;
+   strdes->string[strdes->len] = '\0';
+
    return strdes->string;
 }
 
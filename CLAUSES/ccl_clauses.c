@@ -83,7 +83,7 @@ static bool foundEqLitLater(OCB_p ocb, Eqn_p lits1, Eqn_p lits2)
    while (lits2)
    {
       if ((!EqnHasEquiv(lits2)) &&
-          (LiteralCompare(ocb, lits1, lits2) == to_equal))
+          (LiteralCompare(ocb, lits1, lits2, DEREF_ALWAYS) == to_equal))
       {
          EqnSetProp(lits1, EPHasEquiv);
          EqnSetProp(lits2, EPHasEquiv);
@@ -2065,7 +2065,8 @@ double ClauseWeight(Clause_p clause, double max_term_multiplier,
 // Function: ClauseFunWeight()
 //
 //   Compute the weight of a clause by summing weights for individual
-//   function symbols and variables and applying various modifiers.
+//   function symbols and variables and applying various
+//   modifiers. cache (if not NULL) caches term weights.
 //
 // Global Variables: -
 //
@@ -2076,7 +2077,8 @@ double ClauseWeight(Clause_p clause, double max_term_multiplier,
 double ClauseFunWeight(Clause_p clause, double max_term_multiplier,
                        double max_literal_multiplier, double
                        pos_multiplier, long vweight, long flimit,
-                       long *fweights, long default_fweight)
+                       long *fweights, long default_fweight,
+                       WeightCache_p cache)
 {
    Eqn_p  handle;
    double res = 0;
@@ -2086,7 +2088,7 @@ double ClauseFunWeight(Clause_p clause, double max_term_multiplier,
       res += LiteralFunWeight(handle, max_term_multiplier,
                               max_literal_multiplier, pos_multiplier,
                               vweight, flimit, fweights,
-                              default_fweight);
+                              default_fweight, cache);
    }
    return res;
 }
@@ -2112,7 +2114,7 @@ double ClauseNonLinearWeight(Clause_p clause, double max_term_multiplier,
                              double max_literal_multiplier, double
                              pos_multiplier, long vlweight, long
                              vweight, long fweight, bool
-                             count_eq_encoding)
+                             count_eq_encoding, WeightCache_p cache)
 {
    Eqn_p  handle;
    double res = 0;
@@ -2122,7 +2124,7 @@ double ClauseNonLinearWeight(Clause_p clause, double max_term_multiplier,
       res += LiteralNonLinearWeight(handle, max_term_multiplier,
                                     max_literal_multiplier, pos_multiplier,
                                     vlweight, vweight, fweight,
-                                    count_eq_encoding);
+                                    count_eq_encoding, cache);
 
    }
    return res;
@@ -2147,7 +2149,8 @@ double ClauseSymTypeWeight(Clause_p clause, double
                            max_term_multiplier, double
                            max_literal_multiplier, double
                            pos_multiplier, long vweight, long
-                           fweight, long cweight, long pweight)
+                           fweight, long cweight, long pweight,
+                           WeightCache_p cache)
 {
    Eqn_p  handle;
    double res = 0;
@@ -2156,7 +2159,8 @@ double ClauseSymTypeWeight(Clause_p clause, double
    {
       res += LiteralSymTypeWeight(handle, max_term_multiplier,
                                   max_literal_multiplier, pos_multiplier,
-                                  vweight, fweight, cweight, pweight);
+                                  vweight, fweight, cweight, pweight,
+                                  cache);
    }
    return res;
 }
@@ -2263,7 +2267,7 @@ bool ClauseNotGreaterEqual(OCB_p ocb,
       {
          if (!EqnHasEquiv(cl1lits))
          {
-            switch (LiteralCompare(ocb, cl1lits, cl2lits))
+            switch (LiteralCompare(ocb, cl1lits, cl2lits, DEREF_ALWAYS))
             {
             case to_greater:
                   foundeqlater = false;
@@ -2357,6 +2361,39 @@ int ClauseCompareFun(const void *c1, const void* c2)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseCompareHash()
+//
+//   Return a hash value for clause that is compatible with
+//   ClauseCompareFun(), i.e. clauses that compare as equal have the
+//   same hash. It is computed from the sign and the (shared) term
+//   pointers of the literals, in literal order.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+unsigned long ClauseCompareHash(Clause_p clause)
+{
+   unsigned long res = clause->pos_lit_no*31+clause->neg_lit_no;
+   Eqn_p handle;
+
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      res = res*2654435761UL+EqnIsPositive(handle);
+      res = (res^((uintptr_t)MAX(handle->lterm, handle->rterm)>>3))*
+         0x85ebca6bUL;
+      res = (res^((uintptr_t)MIN(handle->lterm, handle->rterm)>>3))*
+         0xc2b2ae35UL;
+      res = res^(res>>15);
+   }
+   return res;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseCmpById()
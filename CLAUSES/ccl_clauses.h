@@ -111,9 +111,13 @@ typedef enum
                                            * and hence can only be
                                            * rewritten in limited
                                            * ways. */
-   CPIsRelevant     = 2*CPLimitedRW       /* Clause is selected as
+   CPIsRelevant     = 2*CPLimitedRW,      /* Clause is selected as
                                            * relevant for a proof
                                            * attempt (used by SInE). */
+   CPIsLogged       = 2*CPIsRelevant      /* Clause body has been
+                                           * written to the binary
+                                           * inference log under its
+                                           * current ident. */
 }FormulaProperties;
 
 
@@ -340,19 +344,21 @@ double   ClauseWeight(Clause_p clause, double max_term_multiplier,
 double ClauseFunWeight(Clause_p clause, double max_term_multiplier,
                        double max_literal_multiplier, double
                        pos_multiplier, long vweight, long flimit,
-                       long *fweights, long default_fweight);
+                       long *fweights, long default_fweight,
+                       WeightCache_p cache);
 
 double ClauseNonLinearWeight(Clause_p clause, double
                              max_term_multiplier, double
                              max_literal_multiplier, double
                              pos_multiplier, long vlweight, long
                              vweight, long fweight, bool
-                             count_eq_encoding);
+                             count_eq_encoding, WeightCache_p cache);
 double ClauseSymTypeWeight(Clause_p clause, double
                            max_term_multiplier, double
                            max_literal_multiplier, double
                            pos_multiplier, long vweight, long
-                           fweight, long cweight, long pweight);
+                           fweight, long cweight, long pweight,
+                           WeightCache_p cache);
 
 
 double   ClauseStandardWeight(Clause_p clause);
@@ -369,6 +375,7 @@ bool     ClauseNotGreaterEqual(OCB_p ocb,
                                Clause_p clause1, Clause_p clause2);
 
 int      ClauseCompareFun(const void *c1, const void* c2);
+unsigned long ClauseCompareHash(Clause_p clause);
 int      ClauseCmpById(const void* clause1, const void* clause2);
 #ifdef CLAUSE_PERM_IDENT
 int      ClauseCmpByPermId(const void* clause1, const void* clause2);
@@ -380,7 +387,7 @@ int      ClauseCmpByPtr(const void* clause1, const void* clause2);
 
 #define  NormSubstClause(clause, subst, vars)           \
    NormSubstEqnListExcept((clause)->literals,           \
-                          NULL, (subst), (vars))
+                          NULL, (subst), (vars), DEREF_ALWAYS)
 
 Clause_p ClauseNormalizeVars(Clause_p clause, VarBank_p fresh_vars);
 
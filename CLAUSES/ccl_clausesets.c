@@ -27,6 +27,14 @@
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+/* Entries of the hash table used by ClauseSetMarkCopies() */
+
+typedef struct clause_hash_entry_cell
+{
+   unsigned long hash;
+   Clause_p      clause;
+}ClauseHashEntryCell, *ClauseHashEntry_p;
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -976,7 +984,9 @@ void ClauseSetSetTPTPType(ClauseSet_p set, FormulaProperties type)
 //
 //   Mark clauses that are equivalent (modulo ClauseCompareFun) to
 //   clauses that occur earlier in set. Returns number of marked
-//   clauses.
+//   clauses. Clauses are kept in an open-addressing hash table keyed
+//   by ClauseCompareHash(), so ClauseCompareFun() is only called on
+//   hash collisions.
 //
 // Global Variables: -
 //
@@ -989,15 +999,37 @@ long ClauseSetMarkCopies(ClauseSet_p set)
 {
    long res = 0;
    Clause_p handle, exists;
-   PTree_p  store = NULL;
+   ClauseHashEntry_p table;
+   unsigned long size = 16, mask, hash, i;
 
    assert(set);
 
+   while(size < 2*(unsigned long)set->members)
+   {
+      size = size*2;
+   }
+   mask  = size-1;
+   table = SizeMalloc(size*sizeof(ClauseHashEntryCell));
+   for(i=0; i<size; i++)
+   {
+      table[i].clause = NULL;
+   }
+
    for(handle = set->anchor->succ; handle!=set->anchor; handle =
           handle->succ)
    {
-      if((exists = PTreeObjStore(&store, handle,
-                                 ClauseCompareFun)))
+      hash   = ClauseCompareHash(handle);
+      exists = NULL;
+      for(i = hash&mask; table[i].clause; i = (i+1)&mask)
+      {
+         if(table[i].hash == hash &&
+            ClauseCompareFun(table[i].clause, handle)==0)
+         {
+            exists = table[i].clause;
+            break;
+         }
+      }
+      if(exists)
       {
          if(!ClauseParentsAreSubset(exists, handle))
          {
@@ -1006,8 +1038,13 @@ long ClauseSetMarkCopies(ClauseSet_p set)
          ClauseSetProp(handle, CPDeleteClause);
          res++;
       }
+      else
+      {
+         table[i].hash   = hash;
+         table[i].clause = handle;
+      }
    }
-   PTreeFree(store);
+   SizeFree(table, size*sizeof(ClauseHashEntryCell));
 
    return res;
 }
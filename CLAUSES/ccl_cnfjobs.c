@@ -0,0 +1,638 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_cnfjobs.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Parallel clausification of formula sets using forked worker
+  processes (see ccl_cnfjobs.h).
+
+  A worker result is a sequence of longs. For each formula of the
+  chunk that is not a quoted clause, it contains the symbols
+  introduced while clausifying it (kind, name, arity, properties,
+  type), followed by the clauses generated from it. Terms are written in
+  preorder with their f_code and sort, non-variable terms also with
+  properties and arity.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 18:20:04 CEST 2026
+    New
+<2> Wed Oct 21 16:42:07 CEST 2026
+    Symbol kind is written explicitly.
+
+-----------------------------------------------------------------------*/
+
+#include <sys/wait.h>
+#include "ccl_cnfjobs.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+#define CNF_JOB_TERM_PROPS  (TPRestricted|TPTopPos|TPPredPos|    \
+                             TPPosPolarity|TPNegPolarity)
+
+/* How a symbol introduced by a worker is re-created in the parent */
+
+typedef enum
+{
+   CNFSymNamed,   /* Inserted under its name */
+   CNFSymSkolem,  /* Fresh Skolem symbol */
+   CNFSymNewPred  /* Fresh definition predicate */
+}CNFSymbolKind;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_write_long()
+//
+//   Write a long to a worker result.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_write_long(FILE* out, long val)
+{
+   if(fwrite(&val, sizeof(long), 1, out)!=1)
+   {
+      SysError("Cannot write clausification result", SYS_ERROR);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_read_long()
+//
+//   Read a long from a worker result.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, terminates on error
+//
+/----------------------------------------------------------------------*/
+
+static long cnf_read_long(FILE* in)
+{
+   long val;
+
+   if(fread(&val, sizeof(long), 1, in)!=1)
+   {
+      Error("Truncated clausification result", OTHER_ERROR);
+   }
+   return val;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_write_term()
+//
+//   Write term in preorder.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_write_term(FILE* out, Term_p term)
+{
+   int i;
+
+   cnf_write_long(out, term->f_code);
+   cnf_write_long(out, term->sort);
+   if(TermIsVar(term))
+   {
+      return;
+   }
+   cnf_write_long(out, term->properties&CNF_JOB_TERM_PROPS);
+   cnf_write_long(out, term->arity);
+   for(i=0; i<term->arity; i++)
+   {
+      cnf_write_term(out, term->args[i]);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_read_term()
+//
+//   Read a term and insert it into bank. Symbols newer than base are
+//   translated via fmap.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, changes the term bank
+//
+/----------------------------------------------------------------------*/
+
+static Term_p cnf_read_term(FILE* in, TB_p bank, FunCode base,
+                            PDArray_p fmap)
+{
+   FunCode f_code = cnf_read_long(in);
+   long    sort   = cnf_read_long(in);
+   long    props, arity;
+   int     i;
+   Term_p  t;
+
+   if(f_code < 0)
+   {
+      return VarBankVarAssertAlloc(bank->vars, f_code, sort);
+   }
+   props = cnf_read_long(in);
+   arity = cnf_read_long(in);
+   if(f_code > base)
+   {
+      f_code = PDArrayElementInt(fmap, f_code-base);
+   }
+   assert(f_code > 0);
+   assert(arity == SigFindArity(bank->sig, f_code));
+
+   t = TermTopAlloc(f_code, arity);
+   t->sort = sort;
+   t->properties = props;
+   for(i=0; i<arity; i++)
+   {
+      t->args[i] = cnf_read_term(in, bank, base, fmap);
+   }
+   return TBTermTopInsert(bank, t);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_write_symbols()
+//
+//   Write all symbols of sig newer than from.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_write_symbols(FILE* out, Sig_p sig, FunCode from)
+{
+   FunCode f;
+   Type_p  type;
+   long    len;
+   int     i;
+
+   cnf_write_long(out, sig->f_count-from);
+   for(f=from+1; f<=sig->f_count; f++)
+   {
+      if(SigQueryFuncProp(sig, f, FPSkolemSymbol))
+      {
+         cnf_write_long(out, CNFSymSkolem);
+      }
+      else if(SigQueryFuncProp(sig, f, FPNewPredicate))
+      {
+         cnf_write_long(out, CNFSymNewPred);
+      }
+      else
+      {
+         cnf_write_long(out, CNFSymNamed);
+      }
+      len = strlen(sig->f_info[f].name);
+      cnf_write_long(out, len);
+      if(fwrite(sig->f_info[f].name, 1, len, out)!=len)
+      {
+         SysError("Cannot write clausification result", SYS_ERROR);
+      }
+      cnf_write_long(out, sig->f_info[f].arity);
+      cnf_write_long(out, sig->f_info[f].properties);
+      type = sig->f_info[f].type;
+      if(!type)
+      {
+         cnf_write_long(out, -1);
+         continue;
+      }
+      cnf_write_long(out, type->arity);
+      cnf_write_long(out, type->domain_sort);
+      for(i=0; i<type->arity; i++)
+      {
+         cnf_write_long(out, type->args[i]);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_read_symbols()
+//
+//   Read the symbols introduced for one formula and create them in
+//   sig in the same order. Skolem and definition symbols get fresh
+//   names from the usual generators, the worker names of these are
+//   ignored. *next is the next worker symbol to map.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, changes sig
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_read_symbols(FILE* in, Sig_p sig, FunCode base,
+                             PDArray_p fmap, FunCode *next)
+{
+   long     count, len, arity, type_arity, i, j;
+   CNFSymbolKind kind;
+   char     *name;
+   FunCode  f = 0;
+   SortType domain, *args;
+   Type_p   type;
+
+   count = cnf_read_long(in);
+   for(i=0; i<count; i++)
+   {
+      kind = cnf_read_long(in);
+      len  = cnf_read_long(in);
+      name = SizeMalloc(len+1);
+      if(fread(name, 1, len, in)!=len)
+      {
+         Error("Truncated clausification result", OTHER_ERROR);
+      }
+      name[len] = '\0';
+      arity = cnf_read_long(in);
+      switch(kind)
+      {
+      case CNFSymSkolem:
+            f = SigGetNewSkolemCode(sig, arity);
+            break;
+      case CNFSymNewPred:
+            f = SigGetNewPredicateCode(sig, arity);
+            break;
+      case CNFSymNamed:
+            f = SigInsertId(sig, name, arity, false);
+            break;
+      default:
+            Error("Corrupt clausification result", OTHER_ERROR);
+            break;
+      }
+      SizeFree(name, len+1);
+      sig->f_info[f].properties = cnf_read_long(in);
+
+      type_arity = cnf_read_long(in);
+      if(type_arity >= 0)
+      {
+         domain = cnf_read_long(in);
+         if(type_arity == 0)
+         {
+            type = TypeNewConstant(sig->type_table, domain);
+         }
+         else
+         {
+            args = TypeArgumentAlloc(type_arity);
+            for(j=0; j<type_arity; j++)
+            {
+               args[j] = cnf_read_long(in);
+            }
+            type = TypeNewFunction(sig->type_table, domain,
+                                   type_arity, args);
+            TypeArgumentFree(args, type_arity);
+         }
+         SigDeclareType(sig, f, type);
+      }
+      PDArrayAssignInt(fmap, *next-base, f);
+      (*next)++;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_write_clauses()
+//
+//   Write all clauses in set.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_write_clauses(FILE* out, ClauseSet_p set)
+{
+   Clause_p clause;
+   Eqn_p    lit;
+
+   cnf_write_long(out, set->members);
+   for(clause = set->anchor->succ; clause!=set->anchor;
+       clause = clause->succ)
+   {
+      cnf_write_long(out, ClauseLiteralNumber(clause));
+      for(lit = clause->literals; lit; lit = lit->next)
+      {
+         cnf_write_long(out, lit->properties);
+         cnf_write_term(out, lit->lterm);
+         cnf_write_term(out, lit->rterm);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_read_clauses()
+//
+//   Read the clauses generated from form and insert them into set,
+//   with the same steps as TFormulaToCNF(). Return the number of
+//   clauses.
+//
+// Global Variables: OutputLevel
+//
+// Side Effects    : Input, memory operations, changes the term bank
+//
+/----------------------------------------------------------------------*/
+
+static long cnf_read_clauses(FILE* in, WFormula_p form, ClauseSet_p set,
+                             TB_p terms, FunCode base, PDArray_p fmap)
+{
+   long     count, lits, i, j;
+   Eqn_p    list, *tail, lit;
+   Term_p   lterm, rterm;
+   EqnProperties props;
+   Clause_p clause;
+
+   count = cnf_read_long(in);
+   for(i=0; i<count; i++)
+   {
+      lits = cnf_read_long(in);
+      list = NULL;
+      tail = &list;
+      for(j=0; j<lits; j++)
+      {
+         props = cnf_read_long(in);
+         lterm = cnf_read_term(in, terms, base, fmap);
+         rterm = cnf_read_term(in, terms, base, fmap);
+         lit = EqnAlloc(lterm, rterm, terms, props&EPIsPositive);
+         lit->properties = props;
+         *tail = lit;
+         tail  = &(lit->next);
+      }
+      clause = ClauseAlloc(list);
+      ClauseSetTPTPType(clause, FormulaQueryType(form));
+      DocClauseFromForm(GlobalOut, OutputLevel, clause, form);
+      ClausePushDerivation(clause, DCSplitConjunct, form, NULL);
+      ClauseSetInsert(set, clause);
+   }
+   return count;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_worker()
+//
+//   Clausify the formulas forms[start..end-1] and write the results
+//   to out. Processed formulas are removed from their set, so that
+//   they are no longer protected from garbage collection.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, changes formulas, term bank and signature
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_worker(FILE* out, PStack_p forms, long start, long end,
+                       TB_p terms, VarBank_p fresh_vars, GCAdmin_p gc,
+                       long miniscope_limit, long gc_threshold)
+{
+   ClauseSet_p clauses = ClauseSetAlloc();
+   WFormula_p  form;
+   FunCode     known = terms->sig->f_count;
+   long        i;
+
+   for(i=start; i<end; i++)
+   {
+      form = PStackElementP(forms, i);
+      if(form->is_clause)
+      {
+         continue;
+      }
+      FormulaSetExtractEntry(form);
+      WFormulaCNF2(form, clauses, terms, fresh_vars, miniscope_limit);
+      cnf_write_symbols(out, terms->sig, known);
+      known = terms->sig->f_count;
+      cnf_write_clauses(out, clauses);
+      ClauseSetFreeClauses(clauses);
+      WFormulaFree(form);
+
+      if(TBNonVarTermNodes(terms)>gc_threshold)
+      {
+         GCCollect(gc);
+         gc_threshold = TBNonVarTermNodes(terms)*TFORMULA_GC_LIMIT;
+      }
+   }
+   ClauseSetFree(clauses);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cnf_wait_worker()
+//
+//   Wait for the worker process pid and fail if it did not succeed.
+//
+// Global Variables: -
+//
+// Side Effects    : Terminates on error
+//
+/----------------------------------------------------------------------*/
+
+static void cnf_wait_worker(pid_t pid)
+{
+   int status;
+
+   while(waitpid(pid, &status, 0) == -1)
+   {
+      if(errno != EINTR)
+      {
+         SysError("Cannot wait for clausification worker", SYS_ERROR);
+      }
+   }
+   if(!WIFEXITED(status) || (WEXITSTATUS(status) != NO_ERROR))
+   {
+      Error("Clausification worker failed", OTHER_ERROR);
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: FormulaSetParallelCNF2()
+//
+//   Transform all formulae in set into CNF using up to jobs
+//   processes. The result is the same as with FormulaSetCNF2(),
+//   which is used if there are not enough formulas to split, or if
+//   a proof object has to be built or inferences are printed (these
+//   refer to the intermediate formulas). Return number of clauses
+//   generated.
+//
+// Global Variables: BuildProofObject, OutputLevel
+//
+// Side Effects    : Plenty of memory stuff, forks, creates temporary
+//                   files.
+//
+/----------------------------------------------------------------------*/
+
+long FormulaSetParallelCNF2(FormulaSet_p set, FormulaSet_p archive,
+                            ClauseSet_p clauseset, TB_p terms,
+                            VarBank_p fresh_vars, GCAdmin_p gc,
+                            long miniscope_limit, long jobs)
+{
+   WFormula_p handle;
+   PStack_p   forms;
+   long       workers, n, i, c, res = 0;
+   long       old_nodes = TBNonVarTermNodes(terms);
+   long       gc_threshold = old_nodes*TFORMULA_GC_LIMIT;
+   long       *bounds;
+   pid_t      *pids;
+   FILE       **files;
+   FunCode    base, next;
+   PDArray_p  fmap;
+
+   workers = MIN(jobs, set->members/CNF_JOB_MIN_FORMULAS);
+   if(workers <= 1 || BuildProofObject || OutputLevel >= 2)
+   {
+      return FormulaSetCNF2(set, archive, clauseset, terms,
+                            fresh_vars, gc, miniscope_limit);
+   }
+   TFormulaSetIntroduceDefs(set, archive, terms);
+
+   forms = PStackAlloc();
+   for(handle = set->anchor->succ; handle!=set->anchor;
+       handle = handle->succ)
+   {
+      PStackPushP(forms, handle);
+   }
+   n = PStackGetSP(forms);
+   bounds = SizeMalloc((workers+1)*sizeof(long));
+   pids   = SizeMalloc(workers*sizeof(pid_t));
+   files  = SizeMalloc(workers*sizeof(FILE*));
+   for(c=0; c<=workers; c++)
+   {
+      bounds[c] = (n*c)/workers;
+   }
+   base = terms->sig->f_count;
+   fflush(GlobalOut);
+   fflush(stdout);
+
+   for(c=1; c<workers; c++)
+   {
+      files[c] = tmpfile();
+      if(!files[c])
+      {
+         SysError("Cannot create temporary file for clausification",
+                  SYS_ERROR);
+      }
+      pids[c] = fork();
+      if(pids[c] < 0)
+      {
+         SysError("Cannot fork clausification worker", SYS_ERROR);
+      }
+      if(pids[c] == 0)
+      {
+         /* Child */
+         cnf_worker(files[c], forms, bounds[c], bounds[c+1], terms,
+                    fresh_vars, gc, miniscope_limit, gc_threshold);
+         if(fflush(files[c])!=0)
+         {
+            SysError("Cannot write clausification result", SYS_ERROR);
+         }
+         fflush(GlobalOut);
+         exit(NO_ERROR);
+      }
+   }
+
+   /* The first chunk is done here, exactly as in FormulaSetCNF2() */
+   for(i=bounds[0]; i<bounds[1]; i++)
+   {
+      handle = FormulaSetExtractFirst(set);
+      assert(handle == PStackElementP(forms, i));
+      res += WFormulaCNF2(handle, clauseset, terms, fresh_vars,
+                          miniscope_limit);
+      if(handle->tformula &&
+         (TBNonVarTermNodes(terms)>gc_threshold))
+      {
+         assert(terms == handle->terms);
+         GCCollect(gc);
+         old_nodes = TBNonVarTermNodes(terms);
+         gc_threshold = old_nodes*TFORMULA_GC_LIMIT;
+      }
+      WFormulaFree(handle);
+   }
+
+   fmap = PDIntArrayAlloc(64, 0);
+   for(c=1; c<workers; c++)
+   {
+      cnf_wait_worker(pids[c]);
+      rewind(files[c]);
+      next = base+1;
+      for(i=bounds[c]; i<bounds[c+1]; i++)
+      {
+         handle = FormulaSetExtractFirst(set);
+         assert(handle == PStackElementP(forms, i));
+         if(handle->is_clause)
+         {
+            res += WFormulaCNF2(handle, clauseset, terms, fresh_vars,
+                                miniscope_limit);
+         }
+         else
+         {
+            cnf_read_symbols(files[c], terms->sig, base, fmap, &next);
+            res += cnf_read_clauses(files[c], handle, clauseset, terms,
+                                    base, fmap);
+         }
+         WFormulaFree(handle);
+      }
+      fclose(files[c]);
+   }
+   assert(FormulaSetEmpty(set));
+
+   PDArrayFree(fmap);
+   SizeFree(bounds, (workers+1)*sizeof(long));
+   SizeFree(pids, workers*sizeof(pid_t));
+   SizeFree(files, workers*sizeof(FILE*));
+   PStackFree(forms);
+
+   if(TBNonVarTermNodes(terms)!=old_nodes)
+   {
+      GCCollect(gc);
+   }
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,62 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_cnfjobs.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Clausification of formula sets in forked worker processes. The
+  formulas are split into contiguous chunks. Each worker clausifies
+  one chunk in its own (copy-on-write) term bank and signature and
+  writes the resulting clauses, together with all symbols it
+  introduced, into a temporary file. The main process clausifies
+  the first chunk itself and then merges the results in formula
+  order. New Skolem and definition symbols are re-created in the
+  main signature in the order in which the workers created them, so
+  that symbol names, clause idents and the clause order are the same
+  as for the sequential clausification.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 18:20:04 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCL_CNFJOBS
+
+#define CCL_CNFJOBS
+
+#include <ccl_formulafunc.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Do not fork for less than this many formulas per job */
+
+#define CNF_JOB_MIN_FORMULAS 512
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+long FormulaSetParallelCNF2(FormulaSet_p set, FormulaSet_p archive,
+                            ClauseSet_p clauseset, TB_p terms,
+                            VarBank_p fresh_vars, GCAdmin_p gc,
+                            long miniscope_limit, long jobs);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
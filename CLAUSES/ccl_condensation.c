@@ -16,6 +16,8 @@ Contents
 Changes
 
 <1>     New
+<2> Tue Oct 20 04:27:53 CEST 2026
+    Test candidates without creating them, prefilter literal pairs.
 
 -----------------------------------------------------------------------*/
 
@@ -39,6 +41,103 @@ long CondensationSuccesses = 0;
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: condense_pair_possible()
+//
+//   Cheap test for pairs of literals that LiteralUnifyOneWay() (with
+//   unswapped sides) will certainly not unify: Different signs or
+//   different top symbols on one side.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool condense_pair_possible(Eqn_p l1, Eqn_p l2)
+{
+   if(!PropsAreEquiv(l1, l2, EPIsPositive))
+   {
+      return false;
+   }
+   if(!TermIsVar(l1->lterm) && !TermIsVar(l2->lterm) &&
+      l1->lterm->f_code != l2->lterm->f_code)
+   {
+      return false;
+   }
+   if(!TermIsVar(l1->rterm) && !TermIsVar(l2->rterm) &&
+      l1->rterm->f_code != l2->rterm->f_code)
+   {
+      return false;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: condense_candidate()
+//
+//   Build the literals of the condensation candidate (all literals
+//   of list except except, instantiated with the current bindings
+//   and with duplicates removed, as EqnListCopyExcept() and
+//   EqnListRemoveDuplicates() would) in the preallocated cells in
+//   pool and return the list.
+//
+// Global Variables: -
+//
+// Side Effects    : Inserts instantiated terms into bank
+//
+/----------------------------------------------------------------------*/
+
+static Eqn_p condense_candidate(Eqn_p list, Eqn_p except, Eqn_p pool,
+                                TB_p bank)
+{
+   Eqn_p  res = NULL, handle;
+   EqnRef insert = &res, ref;
+
+   for(; list; list = list->next)
+   {
+      if(list == except)
+      {
+         continue;
+      }
+      pool->lterm = TermIsGround(list->lterm)?list->lterm:
+         TBInsertNoProps(bank, list->lterm, DEREF_ALWAYS);
+      pool->rterm = TermIsGround(list->rterm)?list->rterm:
+         TBInsertNoProps(bank, list->rterm, DEREF_ALWAYS);
+      pool->bank  = bank;
+      pool->pos   = list->pos;
+      pool->properties = list->properties;
+      if(!EqnIsOriented(pool))
+      {
+         EqnDelProp(pool, EPMaxIsUpToDate);
+      }
+      *insert = pool;
+      insert  = &(pool->next);
+      pool++;
+   }
+   *insert = NULL;
+
+   for(handle = res; handle; handle = handle->next)
+   {
+      ref = &(handle->next);
+      while(*ref)
+      {
+         if(LiteralEqual(*ref, handle))
+         {
+            *ref = (*ref)->next;
+         }
+         else
+         {
+            ref = &((*ref)->next);
+         }
+      }
+   }
+   return res;
+}
+
 
 
 /*---------------------------------------------------------------------*/
@@ -52,7 +151,9 @@ long CondensationSuccesses = 0;
 //
 //   Try to condense clause. If successful, simplify the clause, and
 //   return true. If not, the clause is unchanged and false is
-//   returned.
+//   returned. Candidates are only built in a scratch literal array
+//   and tested with EqnListSubsumesClause(), the new literal list is
+//   only created for a successful candidate.
 //
 // Global Variables:
 //
@@ -62,50 +163,43 @@ long CondensationSuccesses = 0;
 
 bool CondenseOnce(Clause_p clause)
 {
-   Eqn_p    l1, l2, newlits;
+   Eqn_p    l1, l2, newlits, cand;
    Subst_p  subst = SubstAlloc();
-   Clause_p cand;
-   bool     swap;
+   long     pool_size = ClauseLiteralNumber(clause)*sizeof(EqnCell);
+   Eqn_p    pool = SizeMalloc(pool_size);
+   bool     res = false;
 
    assert(ClauseIsSubsumeOrdered(clause));
 
-   for(l1=clause->literals; l1; l1=l1->next)
+   for(l1=clause->literals; l1 && !res; l1=l1->next)
    {
       assert(l1);
       for(l2=l1->next; l2; l2=l2->next)
       {
-         for(swap = false; !swap; swap = true)
+         /* Only the unswapped orientation has ever been tried here */
+         if(!condense_pair_possible(l1, l2) ||
+            !LiteralUnifyOneWay(l1, l2, subst, false))
          {
-            if(LiteralUnifyOneWay(l1, l2, subst, swap))
-            {
-               newlits = EqnListCopyExcept(clause->literals,l2, l1->bank);
-               SubstBacktrack(subst);
-               EqnListRemoveDuplicates(newlits);
-               cand = ClauseAlloc(newlits);
-               cand->weight = ClauseStandardWeight(cand);
-               ClauseSubsumeOrderSortLits(cand);
-               if(ClauseSubsumesClause(cand, clause))
-               {
-                  EqnListFree(clause->literals);
-                  clause->literals = cand->literals;
-                  ClauseRecomputeLitCounts(clause);
-                  clause->weight = ClauseStandardWeight(clause);
-                  cand->literals = NULL;
-                  ClauseFree(cand);
-                  SubstFree(subst);
-
-                  return true;
-               }
-               else
-               {
-                  ClauseFree(cand);
-               }
-            }
+            continue;
+         }
+         cand = condense_candidate(clause->literals, l2, pool, l1->bank);
+         SubstBacktrack(subst);
+         if(EqnListSubsumesClause(cand, clause))
+         {
+            newlits = EqnListCopy(cand, l1->bank);
+            EqnListFree(clause->literals);
+            clause->literals = newlits;
+            ClauseRecomputeLitCounts(clause);
+            clause->weight = ClauseStandardWeight(clause);
+            ClauseSubsumeOrderSortLits(clause);
+            res = true;
+            break;
          }
       }
    }
+   SizeFree(pool, pool_size);
    SubstFree(subst);
-   return false;
+   return res;
 }
 
 
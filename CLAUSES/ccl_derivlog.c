@@ -0,0 +1,419 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_derivlog.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Writing of the compact binary inference log (see ccl_derivlog.h).
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 20:41:12 CEST 2026
+    New
+<2> Tue Oct 20 18:20:05 CEST 2026
+    DerivLogForkMark(), DerivLogForkReset()
+
+-----------------------------------------------------------------------*/
+
+#include <unistd.h>
+#include "ccl_derivlog.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* If set, inferences are documented here instead of in the textual
+   protocol. */
+FILE* DerivLogFile = NULL;
+
+/* Identifier of the last step written, the base for the encoding of
+   other identifiers */
+static long derivlog_last_id = 0;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: derivlog_put_varint()
+//
+//   Write value as a variable-length integer.
+//
+// Global Variables: DerivLogFile
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void derivlog_put_varint(unsigned long value)
+{
+   while(value >= 0x80)
+   {
+      putc((int)((value&0x7f)|0x80), DerivLogFile);
+      value >>= 7;
+   }
+   putc((int)value, DerivLogFile);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: derivlog_step_begin()
+//
+//   Write the start of a step record.
+//
+// Global Variables: DerivLogFile, derivlog_last_id
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void derivlog_step_begin(DerivLogTag tag, long id, InfType op,
+                                char* comment)
+{
+   if(comment)
+   {
+      tag = tag|DLHasComment;
+   }
+   putc(tag, DerivLogFile);
+   derivlog_put_varint((unsigned long)id-(unsigned long)derivlog_last_id);
+   derivlog_put_varint(op);
+   if(comment)
+   {
+      fputs(comment, DerivLogFile);
+      putc('\0', DerivLogFile);
+   }
+   derivlog_last_id = id;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: derivlog_body_begin()
+//
+//   Write the start of a body record.
+//
+// Global Variables: DerivLogFile, derivlog_last_id
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void derivlog_body_begin(DerivLogTag tag, long id)
+{
+   putc(tag, DerivLogFile);
+   derivlog_put_varint((unsigned long)derivlog_last_id-(unsigned long)id);
+}
+
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogOpen()
+//
+//   Open the named file as the inference log and write the header.
+//
+// Global Variables: DerivLogFile
+//
+// Side Effects    : Opens file, output
+//
+/----------------------------------------------------------------------*/
+
+void DerivLogOpen(char* name)
+{
+   assert(!DerivLogFile);
+
+   DerivLogFile = OutOpen(name);
+   fputs(DL_MAGIC, DerivLogFile);
+   putc(DL_VERSION, DerivLogFile);
+   derivlog_last_id = 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogClose()
+//
+//   Close the inference log (if any).
+//
+// Global Variables: DerivLogFile
+//
+// Side Effects    : Closes file
+//
+/----------------------------------------------------------------------*/
+
+void DerivLogClose(void)
+{
+   if(DerivLogFile)
+   {
+      OutClose(DerivLogFile);
+      DerivLogFile = NULL;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogForkMark()
+//
+//   Prepare the inference log (if any) for forking processes that
+//   continue it: Flush it (so that the children do not inherit and
+//   later repeat buffered output) and return the current position
+//   for DerivLogForkReset(). Return -1 if there is no log.
+//
+// Global Variables: DerivLogFile
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+long DerivLogForkMark(void)
+{
+   long res = -1;
+
+   if(DerivLogFile)
+   {
+      fflush(DerivLogFile);
+      res = ftell(DerivLogFile);
+      if(res == -1)
+      {
+         Error("Derivation log has to be a regular file if proof "
+               "attempts are forked", USAGE_ERROR);
+      }
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogForkReset()
+//
+//   Discard everything written to the inference log after the
+//   position mark (as returned by DerivLogForkMark()). A forked
+//   process that continues the log calls this first, so that the
+//   steps of earlier (failed) siblings, which use the same
+//   identifiers, are dropped from the log.
+//
+// Global Variables: DerivLogFile
+//
+// Side Effects    : Truncates the log file
+//
+/----------------------------------------------------------------------*/
+
+void DerivLogForkReset(long mark)
+{
+   if(DerivLogFile && mark != -1)
+   {
+      if(fseek(DerivLogFile, mark, SEEK_SET)!=0 ||
+         ftruncate(fileno(DerivLogFile), mark)!=0)
+      {
+         SysError("Cannot reset derivation log", FILE_ERROR);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogClauseStep()
+//
+//   Start the step record for the creation or modification of
+//   clause. The clause already carries its new identifier. Has to be
+//   followed by the parent identifiers and DerivLogStepEnd(), so all
+//   bodies of premises have to be written before.
+//
+// Global Variables: DerivLogFile
+//
+// Side Effects    : Output, the clause body is considered unwritten.
+//
+/----------------------------------------------------------------------*/
+
+void DerivLogClauseStep(Clause_p clause, InfType op, char* comment)
+{
+   DStr_p wl_comment = NULL;
+
+   ClauseDelProp(clause, CPIsLogged);
+   if(ClauseQueryProp(clause, CPWatchOnly))
+   {
+      wl_comment = DStrAlloc();
+      DStrAppendStr(wl_comment, "wl");
+      if(comment)
+      {
+         DStrAppendChar(wl_comment, ',');
+         DStrAppendStr(wl_comment, comment);
+      }
+      comment = DStrView(wl_comment);
+   }
+   derivlog_step_begin(DLClauseStep, clause->ident, op, comment);
+   if(wl_comment)
+   {
+      DStrFree(wl_comment);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogFormulaStep()
+//
+//   Start the step record for the creation or modification of a
+//   formula. See DerivLogClauseStep(). Formula bodies are written
+//   eagerly, call DerivLogFormulaBody() after DerivLogStepEnd().
+//
+// Global Variables: DerivLogFile
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void DerivLogFormulaStep(WFormula_p form, InfType op, char* comment)
+{
+   derivlog_step_begin(DLFormulaStep, form->ident, op, comment);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogSource()
+//
+//   Write the source of an initial clause or formula. Has to follow
+//   the start of the step record immediately.
+//
+// Global Variables: DerivLogFile
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void DerivLogSource(ClauseInfo_p info)
+{
+   if(info)
+   {
+      ClauseSourceInfoPrintTSTP(DerivLogFile, info);
+   }
+   else
+   {
+      fputs("unknown", DerivLogFile);
+   }
+   putc('\0', DerivLogFile);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogParent()
+//
+//   Write the identifier of a premise of the current step. 0 is not
+//   a valid identifier and is ignored.
+//
+// Global Variables: DerivLogFile, derivlog_last_id
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void DerivLogParent(long id)
+{
+   if(id)
+   {
+      derivlog_put_varint((unsigned long)derivlog_last_id-(unsigned long)id);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogStepEnd()
+//
+//   Terminate the list of premises of the current step.
+//
+// Global Variables: DerivLogFile
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void DerivLogStepEnd(void)
+{
+   putc(0, DerivLogFile);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogClauseBody()
+//
+//   Make sure that the body of clause (under its current identifier)
+//   is in the log. Must not be called between the start and the end
+//   of a step record. clause may be NULL.
+//
+// Global Variables: DerivLogFile, PCLFullTerms
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void DerivLogClauseBody(Clause_p clause)
+{
+   if(!clause || ClauseQueryProp(clause, CPIsLogged))
+   {
+      return;
+   }
+   derivlog_body_begin(DLClauseBody, clause->ident);
+   ClauseTSTPPrint(DerivLogFile, clause, PCLFullTerms, false);
+   putc('\0', DerivLogFile);
+   ClauseSetProp(clause, CPIsLogged);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DerivLogFormulaBody()
+//
+//   Write the body of form. Formulas are always named by their
+//   identifier here, so that references to them are consistent.
+//
+// Global Variables: DerivLogFile, PCLFullTerms,
+//                   FormulasKeepInputNames
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void DerivLogFormulaBody(WFormula_p form)
+{
+   bool keep_names = FormulasKeepInputNames;
+
+   derivlog_body_begin(DLFormulaBody, form->ident);
+   FormulasKeepInputNames = false;
+   WFormulaTSTPPrint(DerivLogFile, form, PCLFullTerms, false);
+   FormulasKeepInputNames = keep_names;
+   putc('\0', DerivLogFile);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
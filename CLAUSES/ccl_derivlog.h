@@ -0,0 +1,99 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_derivlog.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Compact binary inference log, an alternative to the textual PCL/TSTP
+  protocol written by the functions in ccl_inferencedoc.c.
+
+  The log is a sequence of records. Each inference step is recorded
+  with the op code and the identifiers of its premises only, all
+  numbers are written as variable-length integers (7 bits per byte,
+  least significant group first, high bit set on all but the last
+  byte). Identifiers are encoded as (unsigned) differences to the
+  identifier of the previous step, which is usually small.
+
+  Clause bodies are only written when they may be needed for a proof,
+  i.e. when a clause is used as a side premise of another inference
+  (or is explicitly quoted). Clauses that are simplified (and get a
+  new identifier) before they are ever used are never written - a
+  reader has to reconstruct their justification as a nested inference
+  term. Formulas are written eagerly, there are few of them.
+
+  Record format (<v> is a varint, <s> a NUL-terminated string):
+
+    Step:  <tag> <id delta> <op> [<s> comment] [<s> source]
+           <parent delta>* 0
+    Body:  <tag> <delta of last step id and id> <s> TSTP text
+
+  The source is only present for initial steps (op inf_initial), the
+  comment only if DLHasComment is set in the tag. The TSTP text is
+  the clause or formula without the justification and closing ")."
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 20:41:12 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCL_DERIVLOG
+
+#define CCL_DERIVLOG
+
+#include <ccl_inferencedoc.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+#define DL_MAGIC     "EDL"
+#define DL_VERSION   1
+
+typedef enum
+{
+   DLNoRecord    = 0,
+   DLClauseStep  = 1,
+   DLFormulaStep = 2,
+   DLClauseBody  = 3,
+   DLFormulaBody = 4,
+   DLTypeMask    = 15,
+   DLHasComment  = 16
+}DerivLogTag;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+extern FILE* DerivLogFile;
+
+void DerivLogOpen(char* name);
+void DerivLogClose(void);
+long DerivLogForkMark(void);
+void DerivLogForkReset(long mark);
+
+void DerivLogClauseStep(Clause_p clause, InfType op, char* comment);
+void DerivLogFormulaStep(WFormula_p form, InfType op, char* comment);
+void DerivLogSource(ClauseInfo_p info);
+void DerivLogParent(long id);
+void DerivLogStepEnd(void);
+
+void DerivLogClauseBody(Clause_p clause);
+void DerivLogFormulaBody(WFormula_p form);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -98,6 +98,7 @@ IOFormat OutputFormat =LOPFormat;
 //
 //   The simplified versions (5)-(11) are not yet implemented!
 //
+//   Both equations are dereferenced with deref.
 //
 // Global Variables: -
 //
@@ -105,12 +106,13 @@ IOFormat OutputFormat =LOPFormat;
 //
 /----------------------------------------------------------------------*/
 
-static CompareResult compare_pos_eqns(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
+static CompareResult compare_pos_eqns(OCB_p ocb, Eqn_p eq1, Eqn_p eq2,
+                                      DerefType deref)
 {
    assert(PropsAreEquiv(eq1, eq2, EPIsPositive));
 
-   CompareResult l1l2 = TOCompare(ocb, eq1->lterm, eq2->lterm, DEREF_ALWAYS, DEREF_ALWAYS);
-   CompareResult r1r2 = TOCompare(ocb, eq1->rterm, eq2->rterm, DEREF_ALWAYS, DEREF_ALWAYS);
+   CompareResult l1l2 = TOCompare(ocb, eq1->lterm, eq2->lterm, deref, deref);
+   CompareResult r1r2 = TOCompare(ocb, eq1->rterm, eq2->rterm, deref, deref);
 
    if((l1l2 == to_equal) && (r1r2 == to_equal))
    {
@@ -130,7 +132,7 @@ static CompareResult compare_pos_eqns(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
    }
 
 
-   CompareResult l1r2 = TOCompare(ocb, eq1->lterm, eq2->rterm, DEREF_ALWAYS, DEREF_ALWAYS);
+   CompareResult l1r2 = TOCompare(ocb, eq1->lterm, eq2->rterm, deref, deref);
 
    if((l1l2 == to_greater) && (l1r2 == to_greater))
    {
@@ -143,7 +145,7 @@ static CompareResult compare_pos_eqns(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
    }
 
 
-   CompareResult r1l2 = TOCompare(ocb, eq1->rterm, eq2->lterm, DEREF_ALWAYS, DEREF_ALWAYS);
+   CompareResult r1l2 = TOCompare(ocb, eq1->rterm, eq2->lterm, deref, deref);
 
    if((l1r2 == to_equal) && (r1l2 == to_equal))
    {
@@ -199,6 +201,7 @@ static CompareResult compare_pos_eqns(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
 //   (5)  {{l1},{r1}} >> {{l2,r2}}  <==>  l1>l2 & l1>r2
 //   (6)  {{l1},{r1}} << {{l2,r2}}  <==>  l1<=l2 v l1<=r2
 //
+//   Both equations are dereferenced with deref.
 //
 // Global Variables: -
 //
@@ -206,12 +209,13 @@ static CompareResult compare_pos_eqns(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
 //
 /----------------------------------------------------------------------*/
 
-static CompareResult compare_poseqn_negeqn(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
+static CompareResult compare_poseqn_negeqn(OCB_p ocb, Eqn_p eq1, Eqn_p eq2,
+                                           DerefType deref)
 {
    assert(EqnIsPositive(eq1));
    assert(!EqnIsPositive(eq2));
 
-   CompareResult l1l2 = TOCompare(ocb, eq1->lterm, eq2->lterm, DEREF_ALWAYS, DEREF_ALWAYS);
+   CompareResult l1l2 = TOCompare(ocb, eq1->lterm, eq2->lterm, deref, deref);
 
    if(EqnIsOriented(eq1))
    {
@@ -220,7 +224,7 @@ static CompareResult compare_poseqn_negeqn(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
          return to_lesser; /* Case (6) */
       }
 
-      CompareResult l1r2 = TOCompare(ocb, eq1->lterm, eq2->rterm, DEREF_ALWAYS, DEREF_ALWAYS);
+      CompareResult l1r2 = TOCompare(ocb, eq1->lterm, eq2->rterm, deref, deref);
 
       if((l1r2 == to_lesser) || (l1r2 == to_equal))
       {
@@ -236,15 +240,15 @@ static CompareResult compare_poseqn_negeqn(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
    {
       assert(!EqnIsOriented(eq1));
 
-      CompareResult l1r2 = TOCompare(ocb, eq1->lterm, eq2->rterm, DEREF_ALWAYS, DEREF_ALWAYS);
+      CompareResult l1r2 = TOCompare(ocb, eq1->lterm, eq2->rterm, deref, deref);
 
       if((l1l2 == to_greater) && (l1r2 == to_greater))
       {
          return to_greater; /* Case (2) */
       }
 
-      CompareResult r1l2 = TOCompare(ocb, eq1->rterm, eq2->lterm, DEREF_ALWAYS, DEREF_ALWAYS);
-      CompareResult r1r2 = TOCompare(ocb, eq1->rterm, eq2->rterm, DEREF_ALWAYS, DEREF_ALWAYS);
+      CompareResult r1l2 = TOCompare(ocb, eq1->rterm, eq2->lterm, deref, deref);
+      CompareResult r1r2 = TOCompare(ocb, eq1->rterm, eq2->rterm, deref, deref);
 
       if((r1l2 == to_greater) && (r1r2 == to_greater))
       {
@@ -1126,7 +1130,8 @@ Eqn_p EqnFlatCopy(Eqn_p eq)
 //
 // Function: EqnCopyRepl()
 //
-//   As EqnCopy(), but replace occurrences of old with repl.
+//   As EqnCopy(), but replace occurrences of old with repl. eq is
+//   dereferenced with deref.
 //
 // Global Variables: -
 //
@@ -1134,13 +1139,14 @@ Eqn_p EqnFlatCopy(Eqn_p eq)
 //
 /----------------------------------------------------------------------*/
 
-Eqn_p EqnCopyRepl(Eqn_p eq, TB_p bank, Term_p old, Term_p repl)
+Eqn_p EqnCopyRepl(Eqn_p eq, TB_p bank, Term_p old, Term_p repl,
+                  DerefType deref)
 {
    Eqn_p  handle;
    Term_p lterm, rterm;
 
-   lterm = TBInsertRepl(bank, eq->lterm, DEREF_ALWAYS, old, repl);
-   rterm = TBInsertRepl(bank, eq->rterm, DEREF_ALWAYS, old, repl);
+   lterm = TBInsertRepl(bank, eq->lterm, deref, old, repl);
+   rterm = TBInsertRepl(bank, eq->rterm, deref, old, repl);
 
    handle = EqnAlloc(lterm, rterm, bank, false); /* Properties will be
                                                     taken care of
@@ -1157,7 +1163,8 @@ Eqn_p EqnCopyRepl(Eqn_p eq, TB_p bank, Term_p old, Term_p repl)
 // Function: EqnCopyOpt()
 //
 //   Copy an instantiated equation into the same term bank (using the
-//   common optimizations possible in that case).
+//   common optimizations possible in that case). eq is dereferenced
+//   with deref.
 //
 // Global Variables: -
 //
@@ -1165,13 +1172,13 @@ Eqn_p EqnCopyRepl(Eqn_p eq, TB_p bank, Term_p old, Term_p repl)
 //
 /----------------------------------------------------------------------*/
 
-Eqn_p EqnCopyOpt(Eqn_p eq)
+Eqn_p EqnCopyOpt(Eqn_p eq, DerefType deref)
 {
    Eqn_p  handle;
    Term_p lterm, rterm;
 
-   lterm = TBInsertOpt(eq->bank, eq->lterm, DEREF_ALWAYS);
-   rterm = TBInsertOpt(eq->bank, eq->rterm, DEREF_ALWAYS);
+   lterm = TBInsertOpt(eq->bank, eq->lterm, deref);
+   rterm = TBInsertOpt(eq->bank, eq->rterm, deref);
 
    handle = EqnAlloc(lterm, rterm, eq->bank, false); /* Properties will be
                                                         taken care of
@@ -1221,17 +1228,18 @@ Eqn_p EqnCopyDisjoint(Eqn_p eq)
 // Function: EqnIsACTrivial()
 //
 //   Return true iff the two terms are AC-equal (with respect to the
-//   AC symbols specified in the signatrue).
+//   AC symbols specified in the signatrue). Uses the AC normal forms
+//   cached in the term bank.
 //
 // Global Variables: -
 //
-// Side Effects    : Memory operations
+// Side Effects    : Memory operations, fills eq->bank->ac_cache
 //
 /----------------------------------------------------------------------*/
 
 bool EqnIsACTrivial(Eqn_p eq)
 {
-   return TermACEqual(eq->bank->sig, eq->lterm, eq->rterm);
+   return TBTermACEqual(eq->bank, eq->lterm, eq->rterm);
 }
 
 
@@ -2007,7 +2015,7 @@ CompareResult EqnCompare(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
 {
    CompareResult res;
 
-   res = compare_pos_eqns(ocb, eq1, eq2);
+   res = compare_pos_eqns(ocb, eq1, eq2, DEREF_ALWAYS);
 
    return res;
 }
@@ -2059,6 +2067,7 @@ bool EqnGreater(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
 //
 //     Finally, pseudo-literals are smaller than all other literals.
 //
+//     Both literals are dereferenced with deref.
 //
 // Global Variables: -
 //
@@ -2066,7 +2075,8 @@ bool EqnGreater(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
 //
 /----------------------------------------------------------------------*/
 
-CompareResult LiteralCompare(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
+CompareResult LiteralCompare(OCB_p ocb, Eqn_p eq1, Eqn_p eq2,
+                             DerefType deref)
 {
    if(EqnQueryProp(eq1, EPPseudoLit) &&
       !(EqnQueryProp(eq2, EPPseudoLit)))
@@ -2106,17 +2116,17 @@ CompareResult LiteralCompare(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
    }
    if(PropsAreEquiv(eq1, eq2, EPIsPositive))
    {
-      return compare_pos_eqns(ocb, eq1, eq2);
+      return compare_pos_eqns(ocb, eq1, eq2, deref);
    }
    else if(EqnIsPositive(eq1))
    {   /* Exactly one of the equations is negative */
-      return compare_poseqn_negeqn(ocb, eq1, eq2);
+      return compare_poseqn_negeqn(ocb, eq1, eq2, deref);
    }
    else
    {
       /* eq1 is negative and eq2 is positive */
       return POInverseRelation(compare_poseqn_negeqn(ocb, eq2,
-                                                     eq1));
+                                                     eq1, deref));
    }
 }
 
@@ -2139,7 +2149,7 @@ bool LiteralGreater(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
 {
    bool res;
 
-   res = LiteralCompare(ocb, eq1, eq2) == to_greater;
+   res = LiteralCompare(ocb, eq1, eq2, DEREF_ALWAYS) == to_greater;
 
    return res;
 }
@@ -2151,6 +2161,7 @@ bool LiteralGreater(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
 //   Instantiate all variables in eq with normed variables. Returns
 //   the previous value of vars->v_count, i.e. the number of the first
 //   fresh variable used.
+//   eq is dereferenced with deref.
 //
 // Global Variables: -
 //
@@ -2158,12 +2169,13 @@ bool LiteralGreater(OCB_p ocb, Eqn_p eq1, Eqn_p eq2)
 //
 /----------------------------------------------------------------------*/
 
-PStackPointer SubstNormEqn(Eqn_p eq, Subst_p subst, VarBank_p vars)
+PStackPointer SubstNormEqn(Eqn_p eq, Subst_p subst, VarBank_p vars,
+                           DerefType deref)
 {
    PStackPointer res;
 
-   res = SubstNormTerm(eq->lterm, subst, vars);
-   SubstNormTerm(eq->rterm, subst, vars);
+   res = SubstNormTerm(eq->lterm, subst, vars, deref);
+   SubstNormTerm(eq->rterm, subst, vars, deref);
 
    return res;
 }
@@ -2207,7 +2219,8 @@ double EqnWeight(Eqn_p eq, double max_multiplier, long vweight, long
 // Function: EqnFunWeight()
 //
 //   As EqnWeight(), but use weighted FSum instead of plain term
-//   weight.
+//   weight. If cache is not NULL, it is used to look up and store
+//   the term weights.
 //
 // Global Variables:
 //
@@ -2216,18 +2229,22 @@ double EqnWeight(Eqn_p eq, double max_multiplier, long vweight, long
 /----------------------------------------------------------------------*/
 
 double EqnFunWeight(Eqn_p eq, double max_multiplier, long vweight,
-                    long flimit, long *fweights, long default_fweight)
+                    long flimit, long *fweights, long default_fweight,
+                    WeightCache_p cache)
 {
    double res;
 
-   res = (double)TermFsumWeight(eq->rterm, vweight, flimit, fweights, default_fweight);
+   res = (double)TermFsumWeightCached(cache, eq->bank, eq->rterm, vweight,
+                                      flimit, fweights, default_fweight);
 
    if(!EqnIsOriented(eq))
    {
       res *= max_multiplier;
    }
 
-   res += (double)TermFsumWeight(eq->lterm, vweight, flimit, fweights, default_fweight) * max_multiplier;
+   res += (double)TermFsumWeightCached(cache, eq->bank, eq->lterm, vweight,
+                                       flimit, fweights, default_fweight)
+      * max_multiplier;
 
    return res;
 }
@@ -2238,7 +2255,9 @@ double EqnFunWeight(Eqn_p eq, double max_multiplier, long vweight,
 // Function: EqnNonLinearWeight()
 //
 //   Compute the non-linear weight of an equation. Weights of
-//   potentially maximal sides are multiplied by max_multiplier.
+//   potentially maximal sides are multiplied by max_multiplier. If
+//   cache is not NULL, it is used to look up and store the term
+//   weights.
 //
 // Global Variables: -
 //
@@ -2247,21 +2266,25 @@ double EqnFunWeight(Eqn_p eq, double max_multiplier, long vweight,
 /----------------------------------------------------------------------*/
 
 double EqnNonLinearWeight(Eqn_p eq, double max_multiplier, long
-                          vlweight, long vweight, long fweight)
+                          vlweight, long vweight, long fweight,
+                          WeightCache_p cache)
 {
    double res;
 
    if(EqnIsOriented(eq))
    {
-      res = (double)TermNonLinearWeight(eq->rterm, vlweight, vweight, fweight);
+      res = (double)TermNonLinearWeightCached(cache, eq->bank, eq->rterm,
+                                              vlweight, vweight, fweight);
    }
    else
    {
-      res = (double)TermNonLinearWeight(eq->rterm, vlweight, vweight,
-                                        fweight) * max_multiplier;
+      res = (double)TermNonLinearWeightCached(cache, eq->bank, eq->rterm,
+                                              vlweight, vweight,
+                                              fweight) * max_multiplier;
    }
-   res += ((double)TermNonLinearWeight(eq->lterm, vlweight, vweight,
-                                       fweight) * max_multiplier);
+   res += ((double)TermNonLinearWeightCached(cache, eq->bank, eq->lterm,
+                                             vlweight, vweight,
+                                             fweight) * max_multiplier);
 
    return res;
 }
@@ -2271,7 +2294,8 @@ double EqnNonLinearWeight(Eqn_p eq, double max_multiplier, long
 //
 // Function: EqnSymTypeWeight()
 //
-//   Compute the symbol type weight of an equation.
+//   Compute the symbol type weight of an equation. If cache is not
+//   NULL, it is used to look up and store the term weights.
 //
 // Global Variables: -
 //
@@ -2281,22 +2305,25 @@ double EqnNonLinearWeight(Eqn_p eq, double max_multiplier, long
 
 double  EqnSymTypeWeight(Eqn_p eq, double max_multiplier, long
                          vweight, long fweight, long cweight, long
-                         pweight)
+                         pweight, WeightCache_p cache)
 {
    double res;
 
    if(EqnIsOriented(eq))
    {
-      res = (double)TermSymTypeWeight(eq->rterm, vweight, fweight,
-                                      cweight, pweight);
+      res = (double)TermSymTypeWeightCached(cache, eq->bank, eq->rterm,
+                                            vweight, fweight,
+                                            cweight, pweight);
    }
    else
    {
-      res = (double)TermSymTypeWeight(eq->rterm, vweight, fweight,
-                                      cweight, pweight) * max_multiplier;
+      res = (double)TermSymTypeWeightCached(cache, eq->bank, eq->rterm,
+                                            vweight, fweight,
+                                            cweight, pweight) * max_multiplier;
    }
-   res += ((double)TermSymTypeWeight(eq->lterm, vweight, fweight,
-                                     cweight, pweight) * max_multiplier);
+   res += ((double)TermSymTypeWeightCached(cache, eq->bank, eq->lterm,
+                                           vweight, fweight,
+                                           cweight, pweight) * max_multiplier);
 
    return res;
 }
@@ -2380,7 +2407,7 @@ double EqnCorrectedWeight(Eqn_p eq, double max_multiplier, long
 
 double EqnCorrectedNonLinearWeight(Eqn_p eq, double max_multiplier,
                                    long vlweight, long vweight, long
-                                   fweight)
+                                   fweight, WeightCache_p cache)
 {
    double res;
 
@@ -2388,13 +2415,13 @@ double EqnCorrectedNonLinearWeight(Eqn_p eq, double max_multiplier,
    {
       if(EqnIsOriented(eq))
       {
-         res = (double)TermNonLinearWeight(eq->rterm, vlweight,
-                                           vweight, fweight);
+         res = (double)TermNonLinearWeightCached(cache, eq->bank, eq->rterm,
+                                                 vlweight, vweight, fweight);
       }
       else
       {
-         res = (double)TermNonLinearWeight(eq->rterm, vlweight,
-                                           vweight, fweight) *
+         res = (double)TermNonLinearWeightCached(cache, eq->bank, eq->rterm,
+                                                 vlweight, vweight, fweight) *
             max_multiplier;
       }
       res += fweight; /* Count the equal-predicate */
@@ -2403,8 +2430,9 @@ double EqnCorrectedNonLinearWeight(Eqn_p eq, double max_multiplier,
    {
       res = 0;
    }
-   res += ((double)TermNonLinearWeight(eq->lterm, vlweight, vweight,
-                                       fweight) * max_multiplier);
+   res += ((double)TermNonLinearWeightCached(cache, eq->bank, eq->lterm,
+                                             vlweight, vweight,
+                                             fweight) * max_multiplier);
 
    return res;
 }
@@ -2520,12 +2548,13 @@ double  LiteralFunWeight(Eqn_p eq,
                          long vweight,
                          long flimit,
                          long *fweights,
-                         long default_fweight)
+                         long default_fweight,
+                         WeightCache_p cache)
 {
    double res;
 
    res = EqnFunWeight(eq, max_term_multiplier, vweight, flimit,
-                      fweights, default_fweight);
+                      fweights, default_fweight, cache);
 
    if(EqnIsMaximal(eq))
    {
@@ -2560,15 +2589,15 @@ double  LiteralNonLinearWeight(Eqn_p eq, double max_term_multiplier,
                                double max_literal_multiplier, double
                                pos_multiplier, long vlweight, long
                                vweight, long fweight, bool
-                               count_eq_encoding)
+                               count_eq_encoding, WeightCache_p cache)
 {
    double res;
 
    res = count_eq_encoding?
       EqnNonLinearWeight(eq, max_term_multiplier, vlweight, vweight,
-                         fweight):
+                         fweight, cache):
       EqnCorrectedNonLinearWeight(eq, max_term_multiplier, vlweight,
-                                  vweight, fweight);
+                                  vweight, fweight, cache);
 
 
    if(EqnIsMaximal(eq))
@@ -2602,12 +2631,13 @@ double  LiteralNonLinearWeight(Eqn_p eq, double max_term_multiplier,
 double LiteralSymTypeWeight(Eqn_p eq, double max_term_multiplier,
                             double max_literal_multiplier, double
                             pos_multiplier, long vweight, long
-                            fweight, long cweight, long pweight)
+                            fweight, long cweight, long pweight,
+                            WeightCache_p cache)
 {
    double res;
 
    res = EqnSymTypeWeight(eq, max_term_multiplier, vweight, fweight,
-                          cweight, pweight);
+                          cweight, pweight, cache);
 
 
    if(EqnIsMaximal(eq))
@@ -27,6 +27,7 @@
 #include <cte_match_mgu_1-1.h>
 #include <cte_replace.h>
 #include <cto_orderings.h>
+#include <cte_weightcache.h>
 
 
 
@@ -216,11 +217,12 @@ void    EqnRecordTermDates(Eqn_p eq);
 
 Eqn_p   EqnCopy(Eqn_p eq, TB_p bank);
 Eqn_p   EqnFlatCopy(Eqn_p eq);
-Eqn_p   EqnCopyRepl(Eqn_p eq, TB_p bank, Term_p old, Term_p repl);
+Eqn_p   EqnCopyRepl(Eqn_p eq, TB_p bank, Term_p old, Term_p repl,
+                    DerefType deref);
 #define EqnSkolemSubst(handle, subst, sig)                      \
    SubstSkolemizeTerm((handle)->lterm, (subst), (sig));         \
    SubstSkolemizeTerm((handle)->rterm, (subst), (sig))
-Eqn_p   EqnCopyOpt(Eqn_p eq);
+Eqn_p   EqnCopyOpt(Eqn_p eq, DerefType deref);
 Eqn_p   EqnCopyDisjoint(Eqn_p eq);
 
 #define EqnIsTrivial(eq) ((eq)->lterm == (eq)->rterm)
@@ -271,10 +273,12 @@ bool          EqnOrient(OCB_p ocb, Eqn_p eq);
 
 CompareResult EqnCompare(OCB_p ocb, Eqn_p eq1, Eqn_p eq2);
 bool          EqnGreater(OCB_p ocb, Eqn_p eq1, Eqn_p eq2);
-CompareResult LiteralCompare(OCB_p ocb, Eqn_p eq1, Eqn_p eq2);
+CompareResult LiteralCompare(OCB_p ocb, Eqn_p eq1, Eqn_p eq2,
+                             DerefType deref);
 bool          LiteralGreater(OCB_p ocb, Eqn_p eq1, Eqn_p eq2);
 
-PStackPointer SubstNormEqn(Eqn_p eq, Subst_p subst, VarBank_p vars);
+PStackPointer SubstNormEqn(Eqn_p eq, Subst_p subst, VarBank_p vars,
+                           DerefType deref);
 
 double  EqnWeight(Eqn_p eq, double max_multiplier, long vweight, long
                   fweight);
@@ -289,13 +293,15 @@ double  EqnWeight(Eqn_p eq, double max_multiplier, long vweight, long
 
 
 double EqnFunWeight(Eqn_p eq, double max_multiplier, long vweight,
-                    long flimit, long *fweights, long default_fweight);
+                    long flimit, long *fweights, long default_fweight,
+                    WeightCache_p cache);
 
 double  EqnNonLinearWeight(Eqn_p eq, double max_multiplier, long
-                           vlweight, long vweight, long fweight);
+                           vlweight, long vweight, long fweight,
+                           WeightCache_p cache);
 double  EqnSymTypeWeight(Eqn_p eq, double max_multiplier, long
                          vweight, long fweight, long cweight, long
-                         pweight);
+                         pweight, WeightCache_p cache);
 
 double  EqnMaxWeight(Eqn_p eq, long vweight, long fweight);
 
@@ -320,7 +326,8 @@ double  LiteralFunWeight(Eqn_p eq,
                          long vweight,
                          long flimit,
                          long *fweights,
-                         long default_fweight);
+                         long default_fweight,
+                         WeightCache_p cache);
 
 
 
@@ -328,11 +335,12 @@ double LiteralNonLinearWeight(Eqn_p eq, double max_term_multiplier,
                               double max_literal_multiplier, double
                               pos_multiplier, long vlweight, long
                               vweight, long fweight, bool
-                              count_eq_encoding);
+                              count_eq_encoding, WeightCache_p cache);
 double LiteralSymTypeWeight(Eqn_p eq, double max_term_multiplier,
                             double max_literal_multiplier, double
                             pos_multiplier, long vweight, long
-                            fweight, long cweight, long pweight);
+                            fweight, long cweight, long pweight,
+                            WeightCache_p cache);
 
 #define EqnCountMaximalLiterals(eqn) (EqnIsOriented(eqn)?1:2)
 
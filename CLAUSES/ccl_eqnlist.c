@@ -536,7 +536,7 @@ Eqn_p EqnListCopyOpt(Eqn_p list)
 
    while(list)
    {
-      *insert = EqnCopyOpt(list);
+      *insert = EqnCopyOpt(list, DEREF_ALWAYS);
       insert = &((*insert)->next);
       list = list->next;
    }
@@ -552,7 +552,7 @@ Eqn_p EqnListCopyOpt(Eqn_p list)
 //
 //   Copy an Eqnlist with one exception using the optimizations
 //   possible if all terms (source and target) are from the same term
-//   bank.
+//   bank. The list is dereferenced with deref.
 //
 // Global Variables: -
 //
@@ -560,7 +560,7 @@ Eqn_p EqnListCopyOpt(Eqn_p list)
 //
 /----------------------------------------------------------------------*/
 
-Eqn_p EqnListCopyOptExcept(Eqn_p list, Eqn_p except)
+Eqn_p EqnListCopyOptExcept(Eqn_p list, Eqn_p except, DerefType deref)
 {
    Eqn_p  newlist = NULL;
    EqnRef insert = &newlist;
@@ -569,7 +569,7 @@ Eqn_p EqnListCopyOptExcept(Eqn_p list, Eqn_p except)
    {
       if(list != except)
       {
-         *insert = EqnCopyOpt(list);
+         *insert = EqnCopyOpt(list, deref);
          insert = &((*insert)->next);
       }
       list = list->next;
@@ -617,7 +617,7 @@ Eqn_p EqnListCopyDisjoint(Eqn_p list)
 //
 //   Return a copy of the list with terms from bank, except that
 //   all occurances of "old" are replaced with repl (which has to be
-//   in bank).
+//   in bank). The list is dereferenced with deref.
 //
 // Global Variables: -
 //
@@ -625,14 +625,15 @@ Eqn_p EqnListCopyDisjoint(Eqn_p list)
 //
 /----------------------------------------------------------------------*/
 
-Eqn_p EqnListCopyRepl(Eqn_p list, TB_p bank, Term_p old, Term_p repl)
+Eqn_p EqnListCopyRepl(Eqn_p list, TB_p bank, Term_p old, Term_p repl,
+                      DerefType deref)
 {
    Eqn_p  newlist = NULL;
    EqnRef insert = &newlist;
 
    while(list)
    {
-      *insert = EqnCopyRepl(list, bank, old, repl);
+      *insert = EqnCopyRepl(list, bank, old, repl, deref);
       insert = &((*insert)->next);
       list = list->next;
    }
@@ -1065,7 +1066,7 @@ int EqnListMaximalLiterals(OCB_p ocb, Eqn_p list)
       {
          if(EqnIsMaximal(stepper) && EqnIsMaximal(handle))
          {
-            cmp = LiteralCompare(ocb, handle, stepper);
+            cmp = LiteralCompare(ocb, handle, stepper, DEREF_ALWAYS);
             switch(cmp)
             {
             case to_greater:
@@ -1098,7 +1099,8 @@ int EqnListMaximalLiterals(OCB_p ocb, Eqn_p list)
 //
 //   Return true if eqn is maximal with respect to list (i.e. if there
 //   are no equations that dominate it), false otherwise. As above,
-//   details of this may need change if the calculus changes.
+//   details of this may need change if the calculus changes. The
+//   literals are dereferenced with deref.
 //
 // Global Variables: -
 //
@@ -1106,7 +1108,8 @@ int EqnListMaximalLiterals(OCB_p ocb, Eqn_p list)
 //
 /----------------------------------------------------------------------*/
 
-bool EqnListEqnIsMaximal(OCB_p ocb, Eqn_p list, Eqn_p eqn)
+bool EqnListEqnIsMaximal(OCB_p ocb, Eqn_p list, Eqn_p eqn,
+                         DerefType deref)
 {
    Eqn_p handle;
    bool res = true;
@@ -1116,7 +1119,7 @@ bool EqnListEqnIsMaximal(OCB_p ocb, Eqn_p list, Eqn_p eqn)
    {
       if(handle!=eqn && EqnIsMaximal(handle))
       {
-         cmp = LiteralCompare(ocb, handle, eqn);
+         cmp = LiteralCompare(ocb, handle, eqn, deref);
 
          if(cmp == to_greater)
          {
@@ -1140,7 +1143,7 @@ bool EqnListEqnIsMaximal(OCB_p ocb, Eqn_p list, Eqn_p eqn)
 //   Return true if eqn is strictly maximal with respect to list
 //   (i.e. if there are no equations that dominate it), false
 //   otherwise. As above, details of this may need change if the
-//   calculus changes.
+//   calculus changes. The literals are dereferenced with deref.
 //
 // Global Variables: -
 //
@@ -1148,7 +1151,8 @@ bool EqnListEqnIsMaximal(OCB_p ocb, Eqn_p list, Eqn_p eqn)
 //
 /----------------------------------------------------------------------*/
 
-bool EqnListEqnIsStrictlyMaximal(OCB_p ocb, Eqn_p list, Eqn_p eqn)
+bool EqnListEqnIsStrictlyMaximal(OCB_p ocb, Eqn_p list, Eqn_p eqn,
+                                 DerefType deref)
 {
    Eqn_p handle;
    bool res = true;
@@ -1157,7 +1161,7 @@ bool EqnListEqnIsStrictlyMaximal(OCB_p ocb, Eqn_p list, Eqn_p eqn)
    {
       if(handle!=eqn && EqnIsMaximal(handle))
       {
-         switch(LiteralCompare(ocb, handle, eqn))
+         switch(LiteralCompare(ocb, handle, eqn, deref))
          {
          case to_equal:
          case to_greater:
@@ -1337,7 +1341,7 @@ Eqn_p EqnListParse(Scanner_p in, TB_p bank, TokenType sep)
 //
 //   Instantiate all variables in eqnlist (except for terms from
 //   except)  with fresh variables from vars. Returns the current
-//   position in subst.
+//   position in subst. The list is dereferenced with deref.
 //
 // Global Variables: -
 //
@@ -1346,7 +1350,7 @@ Eqn_p EqnListParse(Scanner_p in, TB_p bank, TokenType sep)
 /----------------------------------------------------------------------*/
 
 FunCode NormSubstEqnListExcept(Eqn_p list, Eqn_p except, Subst_p
-                               subst, VarBank_p vars)
+                               subst, VarBank_p vars, DerefType deref)
 {
    Eqn_p   handle;
    PStackPointer res = PStackGetSP(subst);
@@ -1355,7 +1359,7 @@ FunCode NormSubstEqnListExcept(Eqn_p list, Eqn_p except, Subst_p
    {
       if(handle!= except)
       {
-         SubstNormEqn(handle, subst, vars);
+         SubstNormEqn(handle, subst, vars, deref);
       }
    }
    return res;
@@ -68,9 +68,10 @@ Eqn_p   EqnListFlatCopy(Eqn_p list);
 Eqn_p   EqnListCopy(Eqn_p list, TB_p bank);
 Eqn_p   EqnListCopyExcept(Eqn_p list, Eqn_p except, TB_p bank);
 Eqn_p   EqnListCopyOpt(Eqn_p list);
-Eqn_p   EqnListCopyOptExcept(Eqn_p list, Eqn_p except);
+Eqn_p   EqnListCopyOptExcept(Eqn_p list, Eqn_p except, DerefType deref);
 Eqn_p   EqnListCopyDisjoint(Eqn_p list);
-Eqn_p   EqnListCopyRepl(Eqn_p list, TB_p bank, Term_p old, Term_p repl);
+Eqn_p   EqnListCopyRepl(Eqn_p list, TB_p bank, Term_p old, Term_p repl,
+                        DerefType deref);
 Eqn_p   EqnListNegateEqns(Eqn_p list);
 int     EqnListRemoveDuplicates(Eqn_p list);
 int     EqnListRemoveResolved(EqnRef list);
@@ -88,8 +89,10 @@ bool    EqnListIsPureEquational(Eqn_p list);
 
 int     EqnListOrient(OCB_p ocb, Eqn_p list);
 int     EqnListMaximalLiterals(OCB_p ocb, Eqn_p list);
-bool    EqnListEqnIsMaximal(OCB_p ocb, Eqn_p list, Eqn_p eqn);
-bool    EqnListEqnIsStrictlyMaximal(OCB_p ocb, Eqn_p list, Eqn_p eqn);
+bool    EqnListEqnIsMaximal(OCB_p ocb, Eqn_p list, Eqn_p eqn,
+                            DerefType deref);
+bool    EqnListEqnIsStrictlyMaximal(OCB_p ocb, Eqn_p list, Eqn_p eqn,
+                                    DerefType deref);
 void    EqnListDeleteTermProperties(Eqn_p list, TermProperties props);
 
 void    EqnListPrint(FILE* out, Eqn_p list, char* sep,
@@ -100,9 +103,9 @@ void    EqnListTSTPPrint(FILE* out, Eqn_p list, char* sep, bool fullterms);
 Eqn_p   EqnListParse(Scanner_p in, TB_p bank, TokenType sep);
 
 FunCode NormSubstEqnListExcept(Eqn_p list, Eqn_p except, Subst_p
-                               subst, VarBank_p vars);
+                               subst, VarBank_p vars, DerefType deref);
 #define NormSubstEqnList(list, subst, vars)                     \
-   NormSubstEqnListExcept((list), NULL, (subst), (vars))
+   NormSubstEqnListExcept((list), NULL, (subst), (vars), DEREF_ALWAYS)
 
 long    EqnListDepth(Eqn_p list);
 
@@ -75,9 +75,9 @@ Clause_p ComputeEqRes(TB_p bank, ClausePos_p pos, VarBank_p freshvars)
    if(unifies)
    {
       NormSubstEqnListExcept(pos->clause->literals, pos->literal,
-              subst, freshvars);
+              subst, freshvars, DEREF_ALWAYS);
       new_literals = EqnListCopyOptExcept(pos->clause->literals,
-                                          pos->literal);
+                                          pos->literal, DEREF_ALWAYS);
       EqnListRemoveResolved(&new_literals);
       EqnListRemoveDuplicates(new_literals);
       new_clause = ClauseAlloc(new_literals);
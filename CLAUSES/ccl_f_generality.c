@@ -18,6 +18,8 @@ Changes
 
 <1> Thu Jul  1 01:10:42 CEST 2010
     New
+<2> Mon Oct 19 17:21:05 CEST 2026
+    Added GenDistribGenerality() and GenDistribSortSymbols()
 
 -----------------------------------------------------------------------*/
 
@@ -692,6 +694,81 @@ void FormulaComputeDRel(GenDistrib_p generality,
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: GenDistribGenerality()
+//
+//   Return the generality of f_code under gentype.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+long GenDistribGenerality(GenDistrib_p generality,
+                          GeneralityMeasure gentype,
+                          FunCode f_code)
+{
+   assert(f_code < generality->size);
+
+   return extract_generality(&(generality->dist_array[f_code]), gentype);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GenDistribSortSymbols()
+//
+//   Sort the n function symbols in symbols by increasing generality
+//   under gentype (with the same tie-breaking as compute_d_rel()).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void GenDistribSortSymbols(GenDistrib_p generality,
+                           GeneralityMeasure gentype,
+                           FunCode *symbols,
+                           long n)
+{
+   PStack_p sort_stack;
+   FunGen_p gen;
+   long     i;
+
+   if(n < 2)
+   {
+      return;
+   }
+   sort_stack = PStackAlloc();
+   for(i=0; i<n; i++)
+   {
+      PStackPushP(sort_stack, &(generality->dist_array[symbols[i]]));
+   }
+   switch(gentype)
+   {
+   case GMTerms:
+         PStackSort(sort_stack, fun_gen_tg_cmp_wrapper);
+         break;
+   case GMFormulas:
+         PStackSort(sort_stack, fun_gen_cg_cmp_wrapper);
+         break;
+   default:
+         assert(false && "Unknown generality type");
+         break;
+   }
+   for(i=0; i<n; i++)
+   {
+      gen = PStackElementP(sort_stack, i);
+      symbols[i] = gen->f_code;
+   }
+   PStackFree(sort_stack);
+}
+
+
+
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
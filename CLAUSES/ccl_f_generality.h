@@ -121,6 +121,14 @@ void        FormulaComputeDRel(GenDistrib_p generality,
                                WFormula_p form,
                                PStack_p res);
 
+long        GenDistribGenerality(GenDistrib_p generality,
+                                 GeneralityMeasure gentype,
+                                 FunCode f_code);
+void        GenDistribSortSymbols(GenDistrib_p generality,
+                                  GeneralityMeasure gentype,
+                                  FunCode *symbols,
+                                  long n);
+
 #endif
 
 /*---------------------------------------------------------------------*/
@@ -149,12 +149,12 @@ Clause_p ComputeOrderedFactor(TB_p bank, OCB_p ocb, ClausePos_p pos1,
    if(unifies)
    {
       if(EqnListEqnIsMaximal(ocb, pos1->clause->literals,
-              pos1->literal))
+              pos1->literal, DEREF_ALWAYS))
       {
     NormSubstEqnListExcept(pos1->clause->literals, pos2->literal,
-            subst, freshvars);
+            subst, freshvars, DEREF_ALWAYS);
     new_literals = EqnListCopyOptExcept(pos1->clause->literals,
-                                             pos2->literal);
+                                             pos2->literal, DEREF_ALWAYS);
     EqnListRemoveResolved(&new_literals);
     EqnListRemoveDuplicates(new_literals);
     new_clause = ClauseAlloc(new_literals);
@@ -290,17 +290,17 @@ Clause_p ComputeEqualityFactor(TB_p bank, OCB_p ocb, ClausePos_p pos1,
       if(!TOGreater(ocb, min_term, max_term, DEREF_ALWAYS, DEREF_ALWAYS)
     &&
     EqnListEqnIsMaximal(ocb, pos1->clause->literals,
-              pos1->literal))
+              pos1->literal, DEREF_ALWAYS))
       {
     NormSubstEqnListExcept(pos1->clause->literals, pos2->literal,
-            subst, freshvars);
+            subst, freshvars, DEREF_ALWAYS);
           new_lside = TBInsertNoProps(bank, min_term, DEREF_ALWAYS);
     new_rside = TBInsertNoProps(bank,
                  ClausePosGetOtherSide(pos2),
                  DEREF_ALWAYS);
     new_condition = EqnAlloc(new_lside, new_rside, bank, false);
     new_literals = EqnListCopyOptExcept(pos1->clause->literals,
-                 pos1->literal);
+                 pos1->literal, DEREF_ALWAYS);
     EqnListInsertFirst(&new_literals, new_condition);
     EqnListRemoveResolved(&new_literals);
     EqnListRemoveDuplicates(new_literals);
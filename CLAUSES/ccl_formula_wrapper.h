@@ -54,6 +54,7 @@ typedef struct wformula_cell
 /*---------------------------------------------------------------------*/
 
 extern long FormulaIdentCounter;
+extern bool FormulasKeepInputNames;
 extern bool FormulaTermEncoding;
 extern long FormulaDefLimit;
 
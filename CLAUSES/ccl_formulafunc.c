@@ -442,6 +442,10 @@ long WFormulaCNF(WFormula_p form, ClauseSet_p set,
    if(form->is_clause)
    {
       Clause_p clause = WFormClauseToClause(form);
+      if(OutputLevel >= 2)
+      {
+         DocClauseFromForm(GlobalOut, OutputLevel, clause, form);
+      }
       ClausePushDerivation(clause, DCFofQuote, form, NULL);
       ClauseSetInsert(set, clause);
       return 1;
@@ -472,6 +476,10 @@ long WFormulaCNF2(WFormula_p form, ClauseSet_p set,
    if(form->is_clause)
    {
       Clause_p clause = WFormClauseToClause(form);
+      if(OutputLevel >= 2)
+      {
+         DocClauseFromForm(GlobalOut, OutputLevel, clause, form);
+      }
       ClausePushDerivation(clause, DCFofQuote, form, NULL);
       ClauseSetInsert(set, clause);
       return 1;
@@ -18,6 +18,8 @@ Changes
 
 <1> Sat Mar 20 09:55:09 CET 2010
     New
+<2> Mon Oct 19 10:12:31 CEST 2026
+    Generational collection with a growth-based policy
 
 -----------------------------------------------------------------------*/
 
@@ -40,6 +42,67 @@ Changes
 /*---------------------------------------------------------------------*/
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: gc_mark_all()
+//
+//   Mark the terms of all registered clause and formula sets.
+//
+// Global Variables: -
+//
+// Side Effects    : Marks terms
+//
+/----------------------------------------------------------------------*/
+
+static void gc_mark_all(GCAdmin_p gc)
+{
+   PTree_p entry;
+   PStack_p trav;
+
+   trav = PTreeTraverseInit(gc->clause_sets);
+   while((entry = PTreeTraverseNext(trav)))
+   {
+      ClauseSetGCMarkTerms(entry->key);
+   }
+   PTreeTraverseExit(trav);
+
+   trav = PTreeTraverseInit(gc->formula_sets);
+   while((entry = PTreeTraverseNext(trav)))
+   {
+      FormulaSetGCMarkCells(entry->key);
+   }
+   PTreeTraverseExit(trav);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gc_update_stats()
+//
+//   Update the collection statistics after a collection that started
+//   at CPU time start with the given term store size.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes gc
+//
+/----------------------------------------------------------------------*/
+
+static void gc_update_stats(GCAdmin_p gc, long long start,
+                            long old_entries, long old_args)
+{
+   TermCellStore_p store = &(gc->bank->term_store);
+   long long pause = GetUSecClock()-start;
+
+   gc->cells_reclaimed += old_entries-store->entries;
+   gc->bytes_reclaimed +=
+      (old_entries-store->entries)*(long long)TERMCELL_MEM+
+      (old_args-store->arg_count)*(long long)TERMARG_MEM;
+   gc->pause_total += pause;
+   gc->pause_max    = MAX(gc->pause_max, pause);
+}
+
+
 
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
@@ -66,6 +129,13 @@ GCAdmin_p GCAdminAlloc(TB_p bank)
    handle->bank         = bank;
    handle->clause_sets  = NULL;
    handle->formula_sets = NULL;
+   handle->major_base   = bank->term_store.entries;
+   handle->minor_count  = 0;
+   handle->major_count  = 0;
+   handle->cells_reclaimed = 0;
+   handle->bytes_reclaimed = 0;
+   handle->pause_total  = 0;
+   handle->pause_max    = 0;
    bank->gc             = handle;
 
    return handle;
@@ -177,37 +247,141 @@ void GCDeregisterClauseSet(GCAdmin_p gc, ClauseSet_p set)
 //
 // Function: GCCollect()
 //
-//   Perform garbage collection on gc->bank.
+//   Perform a (major) garbage collection on gc->bank. Return the
+//   number of term cells recovered.
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Memory operations
 //
 /----------------------------------------------------------------------*/
 
 long GCCollect(GCAdmin_p gc)
 {
-   PTree_p entry;
-   PStack_p trav;
+   long long start = GetUSecClock();
+   long entries, args, res;
 
    assert(gc);
    assert(gc->bank);
 
-   trav = PTreeTraverseInit(gc->clause_sets);
-   while((entry = PTreeTraverseNext(trav)))
+   entries = gc->bank->term_store.entries;
+   args    = gc->bank->term_store.arg_count;
+
+   gc_mark_all(gc);
+   res = TBGCSweep(gc->bank);
+
+   gc->major_count++;
+   gc->major_base = gc->bank->term_store.entries;
+   gc_update_stats(gc, start, entries, args);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GCCollectYoung()
+//
+//   Perform a minor garbage collection on gc->bank, i.e. free
+//   unused terms of the young generation. The literals of all
+//   registered sets are still visited, but marking stops at old
+//   terms, and the old part of the term store is never swept. Return
+//   the number of term cells recovered.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long GCCollectYoung(GCAdmin_p gc)
+{
+   long long start = GetUSecClock();
+   long entries, args, res;
+
+   assert(gc);
+   assert(gc->bank);
+
+   entries = gc->bank->term_store.entries;
+   args    = gc->bank->term_store.arg_count;
+
+   TBGCEnableGenerations(gc->bank);
+   TBGCStartMinor(gc->bank);
+   gc_mark_all(gc);
+   res = TBGCSweepYoung(gc->bank);
+
+   gc->minor_count++;
+   gc_update_stats(gc, start, entries, args);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: GCCollectByPolicy()
+//
+//   Check the growth of the term bank and perform a minor or major
+//   collection if necessary (see ccl_garbage_coll.h for the
+//   policy). This is cheap if nothing needs to be done and is
+//   intended to be called regularly at points where all live terms
+//   are reachable from the registered sets. Return the number of
+//   term cells recovered.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, enables generational
+//                   collection for the bank.
+//
+/----------------------------------------------------------------------*/
+
+long GCCollectByPolicy(GCAdmin_p gc)
+{
+   TB_p bank = gc->bank;
+   long young, old;
+
+   if(!bank->gc_young)
    {
-      ClauseSetGCMarkTerms(entry->key);
+      TBGCEnableGenerations(bank);
+      return 0;
    }
-   PTreeTraverseExit(trav);
-
-   trav = PTreeTraverseInit(gc->formula_sets);
-   while((entry = PTreeTraverseNext(trav)))
+   young = TBGCYoungTerms(bank);
+   old   = bank->term_store.entries-young;
+   if(young < GC_YOUNG_MIN || young < old/GC_YOUNG_FRACTION)
    {
-      FormulaSetGCMarkCells(entry->key);
+      return 0;
    }
-   PTreeTraverseExit(trav);
+   if(bank->term_store.entries > GC_MAJOR_GROWTH*gc->major_base)
+   {
+      return GCCollect(gc);
+   }
+   return GCCollectYoung(gc);
+}
 
-   return TBGCSweep(gc->bank);
+
+/*-----------------------------------------------------------------------
+//
+// Function: GCPrintStatistics()
+//
+//   Print collection statistics.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void GCPrintStatistics(FILE* out, GCAdmin_p gc)
+{
+   fprintf(out,
+           "# Term bank collections (minor/major)  : %ld/%ld\n",
+           gc->minor_count, gc->major_count);
+   fprintf(out,
+           "# Term cells reclaimed                 : %ld (%lld bytes)\n",
+           gc->cells_reclaimed, gc->bytes_reclaimed);
+   fprintf(out,
+           "# Collection pause time (total/max)    : %.3f/%.3f ms\n",
+           gc->pause_total/1000.0, gc->pause_max/1000.0);
 }
 
 
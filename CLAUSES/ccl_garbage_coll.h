@@ -10,6 +10,10 @@ Contents
   integrates a term bank and all clause- and formulasets which use
   terms from this bank.
 
+  Collection is generational: Terms created since the last
+  collection form a young generation that can be collected without
+  traversing or sweeping the (usually much larger) old generation.
+
   Copyright 2010 by the author.
   This code is released under the GNU General Public Licence and
   the GNU Lesser General Public License.
@@ -20,6 +24,8 @@ Changes
 
 <1> Sat Mar 20 09:26:51 CET 2010
     New
+<2> Mon Oct 19 10:12:31 CEST 2026
+    Generational collection with a growth-based policy
 
 -----------------------------------------------------------------------*/
 
@@ -37,11 +43,29 @@ Changes
 /*---------------------------------------------------------------------*/
 
 
+/* Policy for GCCollectByPolicy(): A minor collection of the young
+   generation is done when it has at least GC_YOUNG_MIN term cells and
+   at least 1/GC_YOUNG_FRACTION of the size of the old generation. A
+   major collection is done when the old generation has grown by a
+   factor of GC_MAJOR_GROWTH since the last major collection. */
+
+#define GC_YOUNG_MIN      200000
+#define GC_YOUNG_FRACTION 4
+#define GC_MAJOR_GROWTH   2
+
 typedef struct gc_admin_cell
 {
-   TB_p    bank;
-   PTree_p clause_sets;
-   PTree_p formula_sets;
+   TB_p      bank;
+   PTree_p   clause_sets;
+   PTree_p   formula_sets;
+   long      major_base;      /* Term cells after the last major
+                                 collection */
+   long      minor_count;     /* Statistics */
+   long      major_count;
+   long      cells_reclaimed;
+   long long bytes_reclaimed;
+   long long pause_total;     /* CPU time in microseconds */
+   long long pause_max;
 }GCAdminCell, *GCAdmin_p;
 
 
@@ -60,6 +84,9 @@ void      GCDeregisterFormulaSet(GCAdmin_p gc, FormulaSet_p set);
 void      GCDeregisterClauseSet(GCAdmin_p gc, ClauseSet_p set);
 
 long      GCCollect(GCAdmin_p gc);
+long      GCCollectYoung(GCAdmin_p gc);
+long      GCCollectByPolicy(GCAdmin_p gc);
+void      GCPrintStatistics(FILE* out, GCAdmin_p gc);
 
 #endif
 
@@ -31,6 +31,7 @@ Changes
 
 PERF_CTR_DEFINE(PMIndexTimer);
 PERF_CTR_DEFINE(BWRWIndexTimer);
+PERF_CTR_DEFINE(UnitSRIndexTimer);
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -63,6 +64,7 @@ PERF_CTR_DEFINE(BWRWIndexTimer);
 void GlobalIndicesNull(GlobalIndices_p indices)
 {
    indices->bw_rw_index   = NULL;
+   indices->unit_sr_index = NULL;
    indices->pm_into_index = NULL;
    indices->pm_negp_index = NULL;
    indices->pm_from_index = NULL;
@@ -97,6 +99,7 @@ void GlobalIndicesInit(GlobalIndices_p indices,
    if(indexfun)
    {
       indices->bw_rw_index = FPIndexAlloc(indexfun, sig, SubtermBWTreeFreeWrapper);
+      indices->unit_sr_index = FPIndexAlloc(indexfun, sig, SubtermBWTreeFreeWrapper);
    }
    indexfun = GetFPIndexFunction(pm_from_index_type);
    strcpy(indices->pm_from_index_type, pm_from_index_type);
@@ -138,6 +141,11 @@ void GlobalIndicesFreeIndices(GlobalIndices_p indices)
       FPIndexFree(indices->bw_rw_index);
       indices->bw_rw_index = NULL;
    }
+   if(indices->unit_sr_index)
+   {
+      FPIndexFree(indices->unit_sr_index);
+      indices->unit_sr_index = NULL;
+   }
    if(indices->pm_from_index)
    {
       FPIndexFree(indices->pm_from_index);
@@ -206,6 +214,12 @@ void GlobalIndicesInsertClause(GlobalIndices_p indices, Clause_p clause)
       SubtermIndexInsertClause(indices->bw_rw_index, clause);
       PERF_CTR_EXIT(BWRWIndexTimer);
    }
+   if(indices->unit_sr_index)
+   {
+      PERF_CTR_ENTRY(UnitSRIndexTimer);
+      SubtermIndexInsertLitTerms(indices->unit_sr_index, clause);
+      PERF_CTR_EXIT(UnitSRIndexTimer);
+   }
 
    if(indices->pm_into_index)
    {
@@ -252,6 +266,12 @@ void GlobalIndicesDeleteClause(GlobalIndices_p indices, Clause_p clause)
       SubtermIndexDeleteClause(indices->bw_rw_index, clause);
       PERF_CTR_EXIT(BWRWIndexTimer);
    }
+   if(indices->unit_sr_index)
+   {
+      PERF_CTR_ENTRY(UnitSRIndexTimer);
+      SubtermIndexDeleteLitTerms(indices->unit_sr_index, clause);
+      PERF_CTR_EXIT(UnitSRIndexTimer);
+   }
 
    if(indices->pm_into_index)
    {
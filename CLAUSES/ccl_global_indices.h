@@ -43,6 +43,7 @@ typedef struct global_indices_cell
    char              pm_negp_index_type[MAX_PM_INDEX_NAME_LEN];
    Sig_p             sig;
    SubtermIndex_p    bw_rw_index;
+   SubtermIndex_p    unit_sr_index; /* Top-level literal terms only */
    OverlapIndex_p    pm_from_index;
    OverlapIndex_p    pm_into_index;
    OverlapIndex_p    pm_negp_index;
@@ -55,6 +56,7 @@ typedef struct global_indices_cell
 
 PERF_CTR_DECL(PMIndexTimer);
 PERF_CTR_DECL(BWRWIndexTimer);
+PERF_CTR_DECL(UnitSRIndexTimer);
 
 
 void GlobalIndicesNull(GlobalIndices_p indices);
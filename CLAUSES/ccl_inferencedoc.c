@@ -22,6 +22,7 @@ Changes
 -----------------------------------------------------------------------*/
 
 #include "ccl_inferencedoc.h"
+#include "ccl_derivlog.h"
 
 
 
@@ -792,6 +793,82 @@ static void print_eq_unfold(FILE* out, Clause_p rewritten,
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: derivlog_clause_step()
+//
+//   Write a complete clause step with up to two side premises and an
+//   optional main premise old_id (0 for none) to the binary log.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void derivlog_clause_step(Clause_p clause, InfType op, long old_id,
+                                 Clause_p parent1, Clause_p parent2,
+                                 char* comment)
+{
+   DerivLogClauseBody(parent1);
+   DerivLogClauseBody(parent2);
+   DerivLogClauseStep(clause, op, comment);
+   if(op == inf_initial)
+   {
+      DerivLogSource(clause->info);
+   }
+   DerivLogParent(old_id);
+   if(parent1)
+   {
+      DerivLogParent(parent1->ident);
+   }
+   if(parent2)
+   {
+      DerivLogParent(parent2->ident);
+   }
+   DerivLogStepEnd();
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: derivlog_clause_chain()
+//
+//   Write a clause step that applies the clauses on stack (or, if
+//   repeat is positive, the single clause partner repeat times) to
+//   the main premise old_id, as for rewriting.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void derivlog_clause_chain(Clause_p clause, InfType op, long old_id,
+                                  PStack_p stack, Clause_p partner,
+                                  long repeat, char* comment)
+{
+   PStackPointer i;
+
+   DerivLogClauseBody(partner);
+   for(i=0; stack && i<PStackGetSP(stack); i++)
+   {
+      DerivLogClauseBody(PStackElementP(stack, i));
+   }
+   DerivLogClauseStep(clause, op, comment);
+   DerivLogParent(old_id);
+   for(i=0; stack && i<PStackGetSP(stack); i++)
+   {
+      DerivLogParent(((Clause_p)PStackElementP(stack, i))->ident);
+   }
+   for(i=0; i<repeat; i++)
+   {
+      DerivLogParent(partner->ident);
+   }
+   DerivLogStepEnd();
+}
+
+
 /*---------------------------------------------------------------------*/
 /*             Internal Functions -- Formulae                          */
 /*---------------------------------------------------------------------*/
@@ -1252,6 +1329,40 @@ static void print_var_rename(FILE* out, WFormula_p form,
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: derivlog_formula_step()
+//
+//   Write a complete formula step with an optional main premise
+//   old_id and the formula identifiers on the optional stack ids to
+//   the binary log, followed by the formula itself.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void derivlog_formula_step(WFormula_p form, InfType op, long old_id,
+                                  PStack_p ids, char* comment)
+{
+   PStackPointer i;
+
+   DerivLogFormulaStep(form, op, comment);
+   if(op == inf_initial)
+   {
+      DerivLogSource(form->info);
+   }
+   DerivLogParent(old_id);
+   for(i=0; ids && i<PStackGetSP(ids); i++)
+   {
+      DerivLogParent(((WFormula_p)PStackElementP(ids, i))->ident);
+   }
+   DerivLogStepEnd();
+   DerivLogFormulaBody(form);
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -1275,6 +1386,12 @@ void DocClauseCreation(FILE* out, long level, Clause_p clause,
 {
    if(level >= 2)
    {
+      if(DerivLogFile)
+      {
+         clause->ident = ++ClauseIdentCounter;
+         derivlog_clause_step(clause, op, 0, parent1, parent2, comment);
+         return;
+      }
       switch(op)
       {
       case inf_initial:
@@ -1345,6 +1462,13 @@ void DocClauseFromForm(FILE* out, long level, Clause_p clause,
    ClauseDelProp(clause, CPInputFormula);
    if(level >= 2)
    {
+      if(DerivLogFile)
+      {
+         clause->ident = ++ClauseIdentCounter;
+         derivlog_clause_step(clause, inf_split_conjunct, parent->ident,
+                              NULL, NULL, NULL);
+         return;
+      }
       switch(DocOutputFormat)
       {
       case pcl_format:
@@ -1391,6 +1515,25 @@ void DocClauseModification(FILE* out, long level, Clause_p clause, InfType
       assert(clause);
       old_id = clause->ident;
 
+      if(DerivLogFile)
+      {
+         clause->ident = ++ClauseIdentCounter;
+         if(op == inf_ac_resolution)
+         {
+            derivlog_clause_chain(clause, op, old_id, sig->ac_axioms,
+                                  NULL, 0, comment);
+         }
+         else if(op == inf_eres)
+         {
+            derivlog_clause_step(clause, op, old_id, NULL, NULL, comment);
+         }
+         else
+         {
+            derivlog_clause_step(clause, op, old_id, partner, NULL,
+                                 comment);
+         }
+         return;
+      }
       switch(op)
       {
       case inf_simplify_reflect:
@@ -1472,6 +1615,30 @@ void DocClauseQuote(FILE* out, long level, long target_level,
 
    if(level >= target_level)
    {
+      if(DerivLogFile)
+      {
+         DStr_p partner_comment = NULL;
+
+         if(opt_partner)
+         {
+            assert(comment);
+            partner_comment = DStrAlloc();
+            DStrAppendStr(partner_comment, comment);
+            DStrAppendStr(partner_comment, "(c_0_");
+            DStrAppendInt(partner_comment, opt_partner->ident);
+            DStrAppendChar(partner_comment, ')');
+            comment = DStrView(partner_comment);
+         }
+         clause->ident = ++ClauseIdentCounter;
+         derivlog_clause_step(clause, inf_quote, old_id, NULL, NULL,
+                              comment);
+         DerivLogClauseBody(clause);
+         if(partner_comment)
+         {
+            DStrFree(partner_comment);
+         }
+         return;
+      }
       switch(DocOutputFormat)
       {
       case pcl_format:
@@ -1541,6 +1708,19 @@ void DocClauseRewrite(FILE* out, long level, ClausePos_p rewritten,
       assert(rewritten->literal);
       old_id = rewritten->clause->ident;
       rewritten->clause->ident = ++ClauseIdentCounter;
+      if(DerivLogFile)
+      {
+         PStack_p rwsteps = PStackAlloc();
+         bool     tmp;
+
+         tmp = TermComputeRWSequence(rwsteps, old_term,
+                                     ClausePosGetSide(rewritten), 0);
+         UNUSED(tmp); assert(tmp);
+         derivlog_clause_chain(rewritten->clause, inf_rewrite, old_id,
+                               rwsteps, NULL, 0, comment);
+         PStackFree(rwsteps);
+         return;
+      }
       print_rewrite(out, rewritten, old_id, old_term, comment);
    }
 }
@@ -1570,6 +1750,13 @@ void DocClauseEqUnfold(FILE* out, long level, Clause_p rewritten,
       assert(rewritten);
       old_id = rewritten->ident;
       rewritten->ident = ++ClauseIdentCounter;
+      if(DerivLogFile)
+      {
+         derivlog_clause_chain(rewritten, inf_rewrite, old_id, NULL,
+                               demod->clause, PStackGetSP(demod_pos),
+                               "Unfolding");
+         return;
+      }
       print_eq_unfold(out, rewritten, old_id, demod, demod_pos);
    }
 
@@ -1593,6 +1780,13 @@ void DocFormulaCreation(FILE* out, long level, WFormula_p formula,
 {
    if(level >= 2)
    {
+      if(DerivLogFile)
+      {
+         formula->ident = ++ClauseIdentCounter;
+         derivlog_formula_step(formula, op, parent1?parent1->ident:0,
+                               NULL, comment);
+         return;
+      }
       switch(op)
       {
       case inf_initial:
@@ -1642,6 +1836,11 @@ void DocFormulaModification(FILE* out, long level, WFormula_p form,
       long old_id = form->ident;
 
       form->ident = ++ClauseIdentCounter;
+      if(DerivLogFile)
+      {
+         derivlog_formula_step(form, op, old_id, NULL, comment);
+         return;
+      }
       switch(op)
       {
       case inf_fof_simpl:
@@ -1699,6 +1898,12 @@ void DocFormulaIntroDefs(FILE* out, long level, WFormula_p form,
 
       form->ident = ++ClauseIdentCounter;
 
+      if(DerivLogFile)
+      {
+         derivlog_formula_step(form, inf_fof_apply_def, old_id, def_list,
+                               comment);
+         return;
+      }
       switch(DocOutputFormat)
       {
       case pcl_format:
@@ -1789,6 +1994,13 @@ void DocIntroSplitDefRest(FILE* out, long level, Clause_p clause,
    if(level >= 2)
    {
       assert(parent);
+      if(DerivLogFile)
+      {
+         clause->ident = ++ClauseIdentCounter;
+         derivlog_clause_step(clause, inf_fof_split_equiv, parent->ident,
+                              NULL, NULL, comment);
+         return;
+      }
       switch(DocOutputFormat)
       {
       case pcl_format:
@@ -1834,6 +2046,18 @@ void DocClauseApplyDefs(FILE* out, long level, Clause_p clause,
 
    if(level >= 2)
    {
+      if(DerivLogFile)
+      {
+         clause->ident = ++ClauseIdentCounter;
+         DerivLogClauseStep(clause, inf_fof_apply_def, "split");
+         DerivLogParent(parent_id);
+         for(i=0; i<PStackGetSP(def_ids); i++)
+         {
+            DerivLogParent(PStackElementInt(def_ids, i));
+         }
+         DerivLogStepEnd();
+         return;
+      }
       switch(DocOutputFormat)
       {
       case pcl_format:
@@ -63,7 +63,8 @@ typedef enum
    inf_eval_answers,
    inf_var_rename,
    inf_skolemize_out,
-   inf_neg_conjecture
+   inf_neg_conjecture,
+   inf_split_conjunct
 }InfType;
 
 typedef enum
@@ -18,6 +18,8 @@ Changes
 
 <1> Tue May 16 23:08:03 CEST 2006
     New (adapted ccl_evaluations.c)
+<2> Tue Oct 20 17:31:08 CEST 2026
+    EvalTreeBuild()
 
 -----------------------------------------------------------------------*/
 
@@ -29,6 +31,17 @@ Changes
 
 long EvaluationCounter = 0;
 
+/* Sort keys for EvalTreeBuild(), copied out of the evaluations for a
+   single position. */
+
+typedef struct eval_key_cell
+{
+   EvalPriority priority;
+   float        heuristic;
+   long         eval_count;
+   Eval_p       eval;
+}EvalKeyCell, *EvalKey_p;
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -150,6 +163,130 @@ static Eval_p splay_tree(Eval_p tree, Eval_p splay, int pos)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: eval_key_less()
+//
+//   Return true if the first key is smaller than the second one in
+//   the order defined by EvalCompare().
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ bool eval_key_less(EvalKey_p k1, EvalKey_p k2)
+{
+   if(k1->priority != k2->priority)
+   {
+      return k1->priority < k2->priority;
+   }
+   if(k1->eval_count == k2->eval_count)
+   {
+      return false;
+   }
+   if(k1->heuristic < k2->heuristic)
+   {
+      return true;
+   }
+   if(k1->heuristic > k2->heuristic)
+   {
+      return false;
+   }
+   return k1->eval_count < k2->eval_count;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: eval_keys_sort()
+//
+//   Sort the keys between start (inclusive) and end (exclusive),
+//   using tmp (of the same size as keys) as scratch space for the
+//   left halves. This is a
+//   merge sort that skips merging already ordered halves, so that
+//   (nearly) sorted input, as produced e.g. by FIFO evaluations, is
+//   handled in (nearly) linear time.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes keys and tmp
+//
+/----------------------------------------------------------------------*/
+
+static void eval_keys_sort(EvalKey_p keys, EvalKey_p tmp,
+                           long start, long end)
+{
+   long mid, i, j, k;
+
+   if(end-start < 2)
+   {
+      return;
+   }
+   mid = start+(end-start)/2;
+   eval_keys_sort(keys, tmp, start, mid);
+   eval_keys_sort(keys, tmp, mid, end);
+   if(!eval_key_less(&keys[mid], &keys[mid-1]))
+   {
+      return;
+   }
+   /* Merge the left half (moved to tmp) and the right half (in
+      place) */
+   memcpy(&tmp[start], &keys[start], (mid-start)*sizeof(EvalKeyCell));
+   i = start;
+   j = mid;
+   k = start;
+   while(i<mid && j<end)
+   {
+      if(eval_key_less(&keys[j], &tmp[i]))
+      {
+         keys[k++] = keys[j++];
+      }
+      else
+      {
+         keys[k++] = tmp[i++];
+      }
+   }
+   while(i<mid)
+   {
+      keys[k++] = tmp[i++];
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: eval_tree_build()
+//
+//   Build a balanced tree (at position pos) from the sorted keys
+//   between start (inclusive) and end (exclusive) and return its
+//   root.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the tree links of the evaluations
+//
+/----------------------------------------------------------------------*/
+
+static Eval_p eval_tree_build(EvalKey_p keys, long start, long end, int pos)
+{
+   long   mid;
+   Eval_p root;
+
+   if(start >= end)
+   {
+      return NULL;
+   }
+   mid  = start+(end-start)/2;
+   root = keys[mid].eval;
+   root->evals[pos].lson = eval_tree_build(keys, start, mid, pos);
+   root->evals[pos].rson = eval_tree_build(keys, mid+1, end, pos);
+
+   return root;
+}
+
+
 
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
@@ -582,6 +719,51 @@ Eval_p EvalTreeFindSmallest(Eval_p root, int pos)
    return root;
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: EvalTreeBuild()
+//
+//   Build a balanced tree at position pos from the n evaluations in
+//   evals (in any order) and return its root. This is equivalent to,
+//   but much faster than, n calls to EvalTreeInsert() into an empty
+//   tree. The array itself is not changed.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes the tree links of the
+//                   evaluations.
+//
+/----------------------------------------------------------------------*/
+
+Eval_p EvalTreeBuild(Eval_p *evals, long n, int pos)
+{
+   EvalKey_p keys, tmp;
+   Eval_p    root;
+   long      i;
+
+   if(!n)
+   {
+      return NULL;
+   }
+   keys = SecureMalloc(n*sizeof(EvalKeyCell));
+   tmp  = SecureMalloc(n*sizeof(EvalKeyCell));
+   for(i=0; i<n; i++)
+   {
+      assert(pos < evals[i]->eval_no);
+      keys[i].priority   = evals[i]->evals[pos].priority;
+      keys[i].heuristic  = evals[i]->evals[pos].heuristic;
+      keys[i].eval_count = evals[i]->eval_count;
+      keys[i].eval       = evals[i];
+   }
+   eval_keys_sort(keys, tmp, 0, n);
+   root = eval_tree_build(keys, 0, n, pos);
+   FREE(tmp);
+   FREE(keys);
+
+   return root;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: EvalTreeTraverseInit()
@@ -108,6 +108,7 @@ Eval_p   EvalTreeFind(Eval_p *root, Eval_p key, int pos);
 Eval_p   EvalTreeExtractEntry(Eval_p *root, Eval_p key, int pos);
 bool     EvalTreeDeleteEntry(Eval_p *root, Eval_p key, int pos);
 Eval_p   EvalTreeFindSmallest(Eval_p root, int pos);
+Eval_p   EvalTreeBuild(Eval_p *evals, long n, int pos);
 
 /* AVL_TRAVERSE_DECLARATION(EvalTree,Eval_p) */
 
@@ -18,6 +18,9 @@ Changes
 
 <1> Mon May 25 23:53:05 MET DST 1998
     New
+<2> Wed Oct 21 19:44:08 CEST 2026
+    Unify and instantiate with SubstComputeMguOffset(), so that the
+    given clause does not need to be copied.
 
 -----------------------------------------------------------------------*/
 
@@ -187,32 +190,34 @@ Clause_p ClausePlainParamodConstruct(ParamodInfo_p ol_desc)
 
    assert(TermStructEqualDeref(ClausePosGetSubterm(ol_desc->from_pos),
                                ClausePosGetSubterm(ol_desc->into_pos),
-                               DEREF_ALWAYS,
-                               DEREF_ALWAYS));
+                               ol_desc->deref_from,
+                               ol_desc->deref_into));
    assert(EqnIsPositive(ol_desc->from_pos->literal));
    assert(PStackEmpty(ol_desc->from_pos->pos));
 
 
    VarBankResetVCount(ol_desc->freshvars);
-   NormSubstEqnList(ol_desc->into->literals,
-                    subst, ol_desc->freshvars);
-   NormSubstEqnList(ol_desc->from->literals,
-                    subst, ol_desc->freshvars);
+   NormSubstEqnListExcept(ol_desc->into->literals, NULL,
+                          subst, ol_desc->freshvars, ol_desc->deref_into);
+   NormSubstEqnListExcept(ol_desc->from->literals, NULL,
+                          subst, ol_desc->freshvars, ol_desc->deref_from);
 
    from_rhs = ClausePosGetOtherSide(ol_desc->from_pos);
    into_rhs = ClausePosGetOtherSide(ol_desc->into_pos);
    new_lhs = TBTermPosReplace(ol_desc->bank, from_rhs,
                               ol_desc->into_pos->pos,
-                              DEREF_ALWAYS);
+                              ol_desc->deref_from,
+                              ol_desc->deref_into);
 
    new_rhs = TBInsertOpt(ol_desc->bank,
                          into_rhs,
-                         DEREF_ALWAYS);
+                         ol_desc->deref_into);
 
    if(!EqnIsPositive(ol_desc->into_pos->literal)||(new_lhs != new_rhs))
    {
       into_copy = EqnListCopyOptExcept(ol_desc->into->literals,
-                                       ol_desc->into_pos->literal);
+                                       ol_desc->into_pos->literal,
+                                       ol_desc->deref_into);
       if(EqnListFindTrue(into_copy))
       {
          EqnListFree(into_copy);
@@ -220,7 +225,8 @@ Clause_p ClausePlainParamodConstruct(ParamodInfo_p ol_desc)
       else
       {
          from_copy = EqnListCopyOptExcept(ol_desc->from->literals,
-                                    ol_desc->from_pos->literal);
+                                    ol_desc->from_pos->literal,
+                                    ol_desc->deref_from);
 
          if(EqnListFindTrue(from_copy))
          {
@@ -269,8 +275,8 @@ Clause_p ClauseSimParamodConstruct(ParamodInfo_p ol_desc)
 
    assert(TermStructEqualDeref(ClausePosGetSubterm(ol_desc->from_pos),
                                ClausePosGetSubterm(ol_desc->into_pos),
-                               DEREF_ALWAYS,
-                               DEREF_ALWAYS));
+                               ol_desc->deref_from,
+                               ol_desc->deref_into));
 
    VarBankResetVCount(ol_desc->freshvars);
    into_term = ClausePosGetSubterm(ol_desc->into_pos);
@@ -279,16 +285,17 @@ Clause_p ClauseSimParamodConstruct(ParamodInfo_p ol_desc)
       just build the clause.. */
 
    NormSubstEqnListExcept(ol_desc->into->literals, NULL,
-                          subst, ol_desc->freshvars);
+                          subst, ol_desc->freshvars, ol_desc->deref_into);
    NormSubstEqnListExcept(ol_desc->from->literals, NULL,
-                          subst, ol_desc->freshvars);
+                          subst, ol_desc->freshvars, ol_desc->deref_from);
    assert(ClausePosGetSide(ol_desc->from_pos)->sort == ClausePosGetOtherSide(ol_desc->from_pos)->sort);
 
    rhs_instance = TBInsertNoProps(ol_desc->bank,
                                   ClausePosGetOtherSide(ol_desc->from_pos),
-                                  DEREF_ALWAYS);
+                                  ol_desc->deref_from);
    into_copy = EqnListCopyRepl(ol_desc->into->literals,
-                               ol_desc->bank, into_term, rhs_instance);
+                               ol_desc->bank, into_term, rhs_instance,
+                               ol_desc->deref_into);
    if(EqnListFindTrue(into_copy))
    {
       EqnListFree(into_copy);
@@ -296,7 +303,8 @@ Clause_p ClauseSimParamodConstruct(ParamodInfo_p ol_desc)
    else
    {
       from_copy = EqnListCopyOptExcept(ol_desc->from->literals,
-                                       ol_desc->from_pos->literal);
+                                       ol_desc->from_pos->literal,
+                                       ol_desc->deref_from);
       if(EqnListFindTrue(from_copy))
       {
          EqnListFree(into_copy);
@@ -373,7 +381,8 @@ Clause_p ClauseParamodConstruct(ParamodInfo_p ol_desc, bool sim_pm)
 //   If the operation is successful, subst will contain the mgu, and
 //   the pointer to the new term, inserted into bank, will be
 //   returned. Otherwise, subst will be unchanged and NULL will be
-//   returned.
+//   returned. The clause of from is read with deref_from, into with
+//   deref_into.
 //
 // Global Variables: -
 //
@@ -384,7 +393,7 @@ Clause_p ClauseParamodConstruct(ParamodInfo_p ol_desc, bool sim_pm)
 
 Term_p ComputeOverlap(TB_p bank, OCB_p ocb, ClausePos_p from, Term_p
             into, TermPos_p pos,  Subst_p subst, VarBank_p
-            freshvars)
+            freshvars, DerefType deref_from, DerefType deref_into)
 {
    Term_p        new_rside = NULL, sub_into, max_side, rep_side;
    PStackPointer oldstate;
@@ -403,13 +412,14 @@ Term_p ComputeOverlap(TB_p bank, OCB_p ocb, ClausePos_p from, Term_p
 
    oldstate = PStackGetSP(subst);
 
-   unify_success = SubstComputeMgu(max_side, sub_into, subst);
+   unify_success = SubstComputeMguOffset(max_side, sub_into, subst,
+                                         deref_from, deref_into, bank);
 
    if(unify_success)
    {
       if(!EqnIsOriented(from->literal)
-    && TOGreater(ocb, rep_side, max_side, DEREF_ALWAYS,
-            DEREF_ALWAYS))
+    && TOGreater(ocb, rep_side, max_side, deref_from,
+            deref_from))
       {
     SubstBacktrackToPos(subst, oldstate);
       }
@@ -417,10 +427,10 @@ Term_p ComputeOverlap(TB_p bank, OCB_p ocb, ClausePos_p from, Term_p
       {
     /* We need to get consistent variables _before_ inserting the
        newly generated term into the term bank ! */
-    SubstNormTerm(into, subst, freshvars);
-    SubstNormTerm(rep_side, subst, freshvars);
+    SubstNormTerm(into, subst, freshvars, deref_into);
+    SubstNormTerm(rep_side, subst, freshvars, deref_from);
     new_rside = TBTermPosReplace(bank, rep_side, pos,
-                  DEREF_ALWAYS);
+                  deref_from, deref_into);
       }
    }
    return new_rside;
@@ -444,7 +454,7 @@ Term_p ComputeOverlap(TB_p bank, OCB_p ocb, ClausePos_p from, Term_p
 
 Eqn_p  EqnOrderedParamod(TB_p bank, OCB_p ocb, ClausePos_p from,
           ClausePos_p into, Subst_p subst, VarBank_p
-          freshvars)
+          freshvars, DerefType deref_from, DerefType deref_into)
 {
    Term_p        new_lside, new_rside, lside, rside;
    PStackPointer oldstate;
@@ -460,18 +470,18 @@ Eqn_p  EqnOrderedParamod(TB_p bank, OCB_p ocb, ClausePos_p from,
    oldstate = PStackGetSP(subst);
 
    new_lside = ComputeOverlap(bank, ocb, from, lside, into->pos,
-               subst, freshvars);
+               subst, freshvars, deref_from, deref_into);
    if(new_lside)
    {
       if((!EqnIsOriented(into->literal))
-    && TOGreater(ocb, rside, lside, DEREF_ALWAYS, DEREF_ALWAYS))
+    && TOGreater(ocb, rside, lside, deref_into, deref_into))
       {
     SubstBacktrackToPos(subst, oldstate);
       }
       else
       {
-    SubstNormTerm(rside, subst, freshvars);
-    new_rside = TBInsert(bank, rside, DEREF_ALWAYS);
+    SubstNormTerm(rside, subst, freshvars, deref_into);
+    new_rside = TBInsert(bank, rside, deref_into);
 
     /* Optimize away trivial paramods... */
     if(!EqnIsPositive(into->literal) || (new_lside != new_rside))
@@ -491,7 +501,8 @@ Eqn_p  EqnOrderedParamod(TB_p bank, OCB_p ocb, ClausePos_p from,
 // Function: ClauseOrderedParamod()
 //
 //   Given two clauses, try to perform an ordered paramodulation
-//   step. Return the clause if it works, NULL otherwise.
+//   step. Return the clause if it works, NULL otherwise. The from
+//   clause is read with deref_from, the into clause with deref_into.
 //
 // Global Variables: -
 //
@@ -500,7 +511,8 @@ Eqn_p  EqnOrderedParamod(TB_p bank, OCB_p ocb, ClausePos_p from,
 /----------------------------------------------------------------------*/
 
 Clause_p ClauseOrderedParamod(TB_p bank, OCB_p ocb, ClausePos_p from,
-               ClausePos_p into, VarBank_p freshvars)
+               ClausePos_p into, VarBank_p freshvars,
+               DerefType deref_from, DerefType deref_into)
 {
    Clause_p  new_clause = NULL;
    Eqn_p     new_literals, into_copy, from_copy;
@@ -539,13 +551,13 @@ Clause_p ClauseOrderedParamod(TB_p bank, OCB_p ocb, ClausePos_p from,
    subst = SubstAlloc();
    VarBankResetVCount(freshvars);
    new_literals = EqnOrderedParamod(bank, ocb, from, into, subst,
-                freshvars);
+                freshvars, deref_from, deref_into);
    if(new_literals)
    {
       if(((EqnIsPositive(into->literal)&&
       EqnListEqnIsStrictlyMaximal(ocb,
                    into->clause->literals,
-                   into->literal))
+                   into->literal, deref_into))
      ||
      (EqnIsNegative(into->literal)/* &&
       EqnListEqnIsMaximal(ocb,
@@ -554,20 +566,20 @@ Clause_p ClauseOrderedParamod(TB_p bank, OCB_p ocb, ClausePos_p from,
     &&
     EqnListEqnIsStrictlyMaximal(ocb,
                  from->clause->literals,
-                 from->literal)
+                 from->literal, deref_from)
     /* &&
             check_paramod_ordering_constraint(ocb, from, into)*/)
       {
     NormSubstEqnListExcept(into->clause->literals, into->literal,
-            subst, freshvars);
+            subst, freshvars, deref_into);
     NormSubstEqnListExcept(from->clause->literals, from->literal,
-            subst, freshvars);
+            subst, freshvars, deref_from);
     new_literals->next = NULL;
 
     into_copy = EqnListCopyOptExcept(into->clause->literals,
-                   into->literal);
+                   into->literal, deref_into);
     from_copy = EqnListCopyOptExcept(from->clause->literals,
-                   from->literal);
+                   from->literal, deref_from);
 
     EqnListDelProp(into_copy, EPFromClauseLit);
     EqnListSetProp(from_copy, EPFromClauseLit);
@@ -597,7 +609,8 @@ Clause_p ClauseOrderedParamod(TB_p bank, OCB_p ocb, ClausePos_p from,
 // Function: ClauseOrderedSimParamod()
 //
 //   Perform a simultaneous ordered simultaneous paramod step (if
-//   necessary).
+//   necessary). The from clause is read with deref_from, the into
+//   clause with deref_into.
 //
 // Global Variables: - (but reads term property TPPotentialParamod)
 //
@@ -607,7 +620,8 @@ Clause_p ClauseOrderedParamod(TB_p bank, OCB_p ocb, ClausePos_p from,
 
 Clause_p ClauseOrderedSimParamod(TB_p bank, OCB_p ocb, ClausePos_p
                                  from,ClausePos_p into, VarBank_p
-                                 freshvars)
+                                 freshvars, DerefType deref_from,
+                                 DerefType deref_into)
 {
    Clause_p  new_clause = NULL;
    Term_p    rhs_instance, from_term, into_term;
@@ -629,11 +643,12 @@ Clause_p ClauseOrderedSimParamod(TB_p bank, OCB_p ocb, ClausePos_p
    from_term = ClausePosGetSide(from);
    subst = SubstAlloc();
    VarBankResetVCount(freshvars);
-   unify_success = SubstComputeMgu(from_term, into_term, subst);
+   unify_success = SubstComputeMguOffset(from_term, into_term, subst,
+                                         deref_from, deref_into, bank);
    if(!unify_success ||
       (!EqnIsOriented(from->literal) &&
        TOGreater(ocb, ClausePosGetOtherSide(from), from_term,
-                 DEREF_ALWAYS, DEREF_ALWAYS)))
+                 deref_from, deref_from)))
    {
       /* Fail because of into-position invariant property of into-term
        * - either we don't unify, or the intantiated from-term is no
@@ -642,7 +657,7 @@ Clause_p ClauseOrderedSimParamod(TB_p bank, OCB_p ocb, ClausePos_p
    }
    else if(!EqnIsOriented(into->literal) &&
            TOGreater(ocb, ClausePosGetOtherSide(into), ClausePosGetSide(into),
-                     DEREF_ALWAYS, DEREF_ALWAYS))
+                     deref_into, deref_into))
    {
       /* Do nothing - we fail because of an into-property that is not
          invariant over positions (the instantiated into-position is no
@@ -650,7 +665,7 @@ Clause_p ClauseOrderedSimParamod(TB_p bank, OCB_p ocb, ClausePos_p
    }
    else if(!EqnListEqnIsStrictlyMaximal(ocb,
                                         from->clause->literals,
-                                        from->literal))
+                                        from->literal, deref_from))
    {
       /* Fail because of into-position invariant property of into-term
        * - the unifier causes the from-literal to be no longer
@@ -660,12 +675,12 @@ Clause_p ClauseOrderedSimParamod(TB_p bank, OCB_p ocb, ClausePos_p
    else if(!((EqnIsPositive(into->literal)&&
               EqnListEqnIsStrictlyMaximal(ocb,
                                           into->clause->literals,
-                                          into->literal))
+                                          into->literal, deref_into))
              ||
              (EqnIsNegative(into->literal) &&
               EqnListEqnIsMaximal(ocb,
                                   into->clause->literals,
-                                  into->literal)))
+                                  into->literal, deref_into)))
       )
    {
       /* Do nothing - we fail because of an into-property that is not
@@ -677,13 +692,16 @@ Clause_p ClauseOrderedSimParamod(TB_p bank, OCB_p ocb, ClausePos_p
       /* _all_ instances of into_term are handled */
       TermCellDelProp(into_term, TPPotentialParamod);
 
-      NormSubstEqnListExcept(into->clause->literals, NULL, subst, freshvars);
-      NormSubstEqnListExcept(from->clause->literals, NULL, subst, freshvars);
+      NormSubstEqnListExcept(into->clause->literals, NULL, subst,
+                             freshvars, deref_into);
+      NormSubstEqnListExcept(from->clause->literals, NULL, subst,
+                             freshvars, deref_from);
       rhs_instance = TBInsertNoProps(bank,
                                      ClausePosGetOtherSide(from),
-                                     DEREF_ALWAYS);
+                                     deref_from);
       into_copy = EqnListCopyRepl(into->clause->literals,
-                                  bank, into_term, rhs_instance);
+                                  bank, into_term, rhs_instance,
+                                  deref_into);
       if(EqnListFindTrue(into_copy))
       {
          EqnListFree(into_copy);
@@ -691,7 +709,7 @@ Clause_p ClauseOrderedSimParamod(TB_p bank, OCB_p ocb, ClausePos_p
       else
       {
          from_copy = EqnListCopyOptExcept(from->clause->literals,
-                                          from->literal);
+                                          from->literal, deref_from);
          if(EqnListFindTrue(from_copy))
          {
             EqnListFree(into_copy);
@@ -19,6 +19,8 @@ Changes
 
 <1> Wed May 20 15:14:26 MET DST 1998
     New
+<2> Wed Oct 21 19:44:08 CEST 2026
+    Read the two clauses with their own deref values.
 
 -----------------------------------------------------------------------*/
 
@@ -56,9 +58,11 @@ typedef struct
    Clause_p    from;
    CompactPos  from_cpos;
    ClausePos_p from_pos;
+   DerefType   deref_from; /* DEREF_OFFSET for the given clause */
    Clause_p    into;
    CompactPos  into_cpos;
    ClausePos_p into_pos;
+   DerefType   deref_into; /* DEREF_ALWAYS otherwise */
 }ParamodInfoCell, *ParamodInfo_p;
 
 
@@ -76,19 +80,20 @@ Clause_p ClauseParamodConstruct(ParamodInfo_p ol_desc, bool sim_pm);
 
 Term_p ComputeOverlap(TB_p bank, OCB_p ocb, ClausePos_p from, Term_p
             into, TermPos_p pos,  Subst_p subst, VarBank_p
-            freshvars);
+            freshvars, DerefType deref_from, DerefType deref_into);
 
 Eqn_p  EqnOrderedParamod(TB_p bank, OCB_p ocb, ClausePos_p from,
           ClausePos_p into, Subst_p subst, VarBank_p
-          freshvars);
+          freshvars, DerefType deref_from, DerefType deref_into);
 
 Clause_p ClauseOrderedParamod(TB_p bank, OCB_p ocb, ClausePos_p
                from,ClausePos_p into, VarBank_p
-               freshvars);
+               freshvars, DerefType deref_from, DerefType deref_into);
 
 Clause_p ClauseOrderedSimParamod(TB_p bank, OCB_p ocb, ClausePos_p
                                  from,ClausePos_p into, VarBank_p
-                                 freshvars);
+                                 freshvars, DerefType deref_from,
+                                 DerefType deref_into);
 
 Term_p   ClausePosFirstParamodInto(Clause_p clause, ClausePos_p pos,
                ClausePos_p from_pos, bool no_top,
@@ -0,0 +1,1096 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_problemcache.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Binary snapshots of parsed problems. See the header file for a
+  description of what is stored.
+
+  Numbers are written in a variable-length encoding (7 bits per
+  byte, sign folded into the lowest bit), so that the small numbers
+  that make up most of a snapshot need only one or two
+  bytes. Strings are written as their length (including the
+  terminating \0, -1 for NULL) followed by the characters. This
+  allows the reader to use strings directly from the loaded buffer.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 16:02:47 CEST 2026
+    New
+<2> Mon Oct 19 23:58:02 CEST 2026
+    Export the encoding and the reader for other binary formats,
+    optionally map files into memory.
+<3> Wed Oct 21 11:37:16 CEST 2026
+    Key snapshots by all files opened during parsing.
+
+-----------------------------------------------------------------------*/
+
+#include "ccl_problemcache.h"
+#include <sys/mman.h>
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* Term properties that are part of the parsed problem. Everything
+   else is either maintained by the term bank or transient. */
+#define SNAP_TERM_PROPS  (TPRestricted|TPTopPos|TPPredPos|    \
+                          TPIsFreeVar|TPPosPolarity|TPNegPolarity)
+
+#define SNAP_HASH_INIT   14695981039346656037ULL
+#define SNAP_HASH_PRIME  1099511628211ULL
+#define SNAP_BLOCK_SIZE  65536
+
+
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: file_content_hash()
+//
+//   Compute size and (64 bit FNV-1a) hash of the contents of the
+//   named file. Return false if the file cannot be read.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads the file
+//
+/----------------------------------------------------------------------*/
+
+static bool file_content_hash(char* name, long *size, uint64_t *hash)
+{
+   FILE*         in;
+   unsigned char block[SNAP_BLOCK_SIZE];
+   size_t        read, i;
+   uint64_t      res = SNAP_HASH_INIT;
+   long          len = 0;
+
+   in = fopen(name, "r");
+   if(!in)
+   {
+      return false;
+   }
+   while((read = fread(block, 1, SNAP_BLOCK_SIZE, in)))
+   {
+      for(i=0; i<read; i++)
+      {
+         res = (res ^ block[i]) * SNAP_HASH_PRIME;
+      }
+      len += read;
+   }
+   fclose(in);
+   *size = len;
+   *hash = res;
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: snap_source_index()
+//
+//   Return the index of source in the source table, adding it if
+//   necessary. NULL is mapped to -1.
+//
+// Global Variables: -
+//
+// Side Effects    : May extend table and index.
+//
+/----------------------------------------------------------------------*/
+
+static long snap_source_index(char* source, StrTree_p *index,
+                              PStack_p table)
+{
+   StrTree_p cell;
+   IntOrP    val;
+
+   if(!source)
+   {
+      return -1;
+   }
+   cell = StrTreeFind(index, source);
+   if(!cell)
+   {
+      val.i_val = PStackGetSP(table);
+      cell = StrTreeStore(index, source, val, val);
+      PStackPushP(table, cell->key);
+   }
+   return cell->val1.i_val;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: snap_write_info()
+//
+//   Write a (possibly NULL) clause info record.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void snap_write_info(FILE* out, ClauseInfo_p info,
+                            StrTree_p *index, PStack_p table)
+{
+   if(!info)
+   {
+      SnapWriteLong(out, 0);
+      return;
+   }
+   SnapWriteLong(out, 1);
+   SnapWriteStr(out, info->name);
+   SnapWriteLong(out, snap_source_index(info->source, index, table));
+   SnapWriteLong(out, info->line);
+   SnapWriteLong(out, info->column);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: snap_read_info()
+//
+//   Read a clause info record written by snap_write_info().
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static ClauseInfo_p snap_read_info(SnapReader_p in, char** sources,
+                                   long source_no)
+{
+   char *name, *source = NULL;
+   long idx, line, column;
+
+   if(!SnapReadLong(in))
+   {
+      return NULL;
+   }
+   name = SnapReadStr(in);
+   idx  = SnapReadLong(in);
+   if(idx != -1)
+   {
+      if(idx < 0 || idx >= source_no)
+      {
+         Error("%s: Problem cache is corrupted", FILE_ERROR, in->name);
+      }
+      source = sources[idx];
+   }
+   line   = SnapReadLong(in);
+   column = SnapReadLong(in);
+
+   return ClauseInfoAlloc(name, source, line, column);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: snap_collect_sources()
+//
+//   Build the table of all source files: The explicit inputs (in
+//   order), followed by all files opened while parsing (opened, may
+//   be NULL) and all other files mentioned in clause infos. Included
+//   files have to be recorded even if they contribute no formulas,
+//   as a changed include may well contribute some.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void snap_collect_sources(char* inputs[], PStack_p opened,
+                                 FormulaSet_p fset, ClauseSet_p wlset,
+                                 StrTree_p *index, PStack_p table)
+{
+   WFormula_p    form;
+   Clause_p      clause;
+   PStackPointer sp;
+   int           i;
+
+   for(i=0; inputs[i]; i++)
+   {
+      snap_source_index(inputs[i], index, table);
+   }
+   for(sp=0; opened && sp<PStackGetSP(opened); sp++)
+   {
+      snap_source_index(PStackElementP(opened, sp), index, table);
+   }
+   for(form = fset->anchor->succ; form!=fset->anchor; form = form->succ)
+   {
+      if(form->info)
+      {
+         snap_source_index(form->info->source, index, table);
+      }
+   }
+   for(clause = wlset->anchor->succ; clause!=wlset->anchor;
+       clause = clause->succ)
+   {
+      if(clause->info)
+      {
+         snap_source_index(clause->info->source, index, table);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: snap_write_term()
+//
+//   Write term and all of its (not yet written) subterms, arguments
+//   first. Return the position of the term in the term table. shared
+//   maps entry numbers and vars maps (negated) variable codes to
+//   positions+1, var_terms remembers which variable (of possibly
+//   several sorts) is at that position.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long snap_write_term(FILE* out, Term_p term, PDArray_p shared,
+                            PDArray_p vars, PDArray_p var_terms,
+                            long *count)
+{
+   long  idx, *args;
+   int   i;
+
+   if(TermIsVar(term))
+   {
+      idx = PDArrayElementInt(vars, -term->f_code);
+      if(idx && PDArrayElementP(var_terms, -term->f_code) == term)
+      {
+         return idx-1;
+      }
+      SnapWriteLong(out, term->f_code);
+      SnapWriteLong(out, term->sort);
+      PDArrayAssignInt(vars, -term->f_code, *count+1);
+      PDArrayAssignP(var_terms, -term->f_code, term);
+      return (*count)++;
+   }
+   assert(TermIsShared(term));
+   idx = PDArrayElementInt(shared, term->entry_no);
+   if(idx)
+   {
+      return idx-1;
+   }
+   args = NULL;
+   if(term->arity)
+   {
+      args = SizeMalloc(term->arity*sizeof(long));
+      for(i=0; i<term->arity; i++)
+      {
+         args[i] = snap_write_term(out, term->args[i], shared,
+                                   vars, var_terms, count);
+      }
+   }
+   SnapWriteLong(out, term->f_code);
+   SnapWriteLong(out, term->sort);
+   SnapWriteLong(out, term->properties&SNAP_TERM_PROPS);
+   SnapWriteLong(out, term->arity);
+   for(i=0; i<term->arity; i++)
+   {
+      SnapWriteLong(out, args[i]);
+   }
+   if(args)
+   {
+      SizeFree(args, term->arity*sizeof(long));
+   }
+   PDArrayAssignInt(shared, term->entry_no, *count+1);
+   return (*count)++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: snap_read_term()
+//
+//   Read one term record and insert the term into the bank. All
+//   arguments are already in table.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the term bank
+//
+/----------------------------------------------------------------------*/
+
+static Term_p snap_read_term(SnapReader_p in, TB_p bank, Term_p *table,
+                             long count)
+{
+   FunCode f_code = SnapReadLong(in);
+   long    sort = SnapReadLong(in);
+   long    props, arity;
+   int     i;
+   Term_p  t;
+
+   if(f_code < 0)
+   {
+      return VarBankVarAssertAlloc(bank->vars, f_code, sort);
+   }
+   props = SnapReadLong(in);
+   arity = SnapReadLong(in);
+   if(f_code == 0 || f_code > bank->sig->f_count ||
+      arity != SigFindArity(bank->sig, f_code))
+   {
+      Error("%s: Problem cache is corrupted", FILE_ERROR, in->name);
+   }
+   t = TermTopAlloc(f_code, arity);
+   t->sort = sort;
+   t->properties = props&SNAP_TERM_PROPS;
+   for(i=0; i<arity; i++)
+   {
+      t->args[i] = table[SnapReadIndex(in, count)];
+   }
+   return TBTermTopInsert(bank, t);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: snap_write_signature()
+//
+//   Write the sort table and the signature (with types).
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void snap_write_signature(FILE* out, Sig_p sig)
+{
+   SortTable_p sorts = sig->sort_table;
+   FunCode     f;
+   Type_p      type;
+   int         i;
+
+   SnapWriteLong(out, sorts->default_type);
+   SnapWriteLong(out, PStackGetSP(sorts->back_index));
+   for(i=0; i<PStackGetSP(sorts->back_index); i++)
+   {
+      SnapWriteStr(out, PStackElementP(sorts->back_index, i));
+   }
+   SnapWriteLong(out, sig->f_count);
+   SnapWriteLong(out, sig->skolem_count);
+   SnapWriteLong(out, sig->newpred_count);
+   for(f=1; f<=sig->f_count; f++)
+   {
+      SnapWriteStr(out, sig->f_info[f].name);
+      SnapWriteLong(out, sig->f_info[f].arity);
+      SnapWriteLong(out, sig->f_info[f].properties);
+      SnapWriteLong(out, sig->f_info[f].feature_offset);
+      type = sig->f_info[f].type;
+      if(!type)
+      {
+         SnapWriteLong(out, -1);
+         continue;
+      }
+      SnapWriteLong(out, type->arity);
+      SnapWriteLong(out, type->domain_sort);
+      for(i=0; i<type->arity; i++)
+      {
+         SnapWriteLong(out, type->args[i]);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: snap_read_signature()
+//
+//   Read sort table and signature into sig, which has to be fresh
+//   (i.e. contain only the internal symbols, and only predefined
+//   sorts).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes sig and its sort and type tables.
+//
+/----------------------------------------------------------------------*/
+
+static void snap_read_signature(SnapReader_p in, Sig_p sig)
+{
+   SortTable_p sorts = sig->sort_table;
+   long        i, sort_no, default_sort, f_count, type_arity, arity;
+   FunCode     f;
+   char        *name;
+   SortType    domain, *args;
+   Type_p      type;
+
+   default_sort = SnapReadLong(in);
+   sort_no = SnapReadLong(in);
+   for(i=0; i<sort_no; i++)
+   {
+      name = SnapReadStr(in);
+      if(!name || SortTableInsert(sorts, name) != i)
+      {
+         Error("%s: Problem cache does not match the sort table",
+               FILE_ERROR, in->name);
+      }
+   }
+   sorts->default_type = default_sort;
+
+   f_count = SnapReadLong(in);
+   sig->skolem_count = SnapReadLong(in);
+   sig->newpred_count = SnapReadLong(in);
+   for(f=1; f<=f_count; f++)
+   {
+      name  = SnapReadStr(in);
+      arity = SnapReadLong(in);
+      if(!name)
+      {
+         Error("%s: Problem cache is corrupted", FILE_ERROR, in->name);
+      }
+      if(f <= sig->f_count)
+      {
+         if(strcmp(name, sig->f_info[f].name)!=0 ||
+            arity != sig->f_info[f].arity)
+         {
+            Error("%s: Problem cache does not match the signature",
+                  FILE_ERROR, in->name);
+         }
+      }
+      else if(SigInsertId(sig, name, arity, false)!=f)
+      {
+         Error("%s: Problem cache is corrupted", FILE_ERROR, in->name);
+      }
+      sig->f_info[f].properties = SnapReadLong(in);
+      sig->f_info[f].feature_offset = SnapReadLong(in);
+      type_arity = SnapReadLong(in);
+      type = NULL;
+      if(type_arity == 0)
+      {
+         type = TypeNewConstant(sig->type_table, SnapReadLong(in));
+      }
+      else if(type_arity > 0)
+      {
+         domain = SnapReadLong(in);
+         args = TypeArgumentAlloc(type_arity);
+         for(i=0; i<type_arity; i++)
+         {
+            args[i] = SnapReadLong(in);
+         }
+         type = TypeNewFunction(sig->type_table, domain,
+                                type_arity, args);
+         TypeArgumentFree(args, type_arity);
+      }
+      sig->f_info[f].type = type;
+   }
+   sig->alpha_ranks_valid = false;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: snap_header_valid()
+//
+//   Check the header of a snapshot: Format, options, inputs and the
+//   content of all sources have to match. Reads the source table
+//   into sources (which has to be freed with FREE()).
+//
+// Global Variables: -
+//
+// Side Effects    : Reads the source files, advances the reader
+//
+/----------------------------------------------------------------------*/
+
+static bool snap_header_valid(SnapReader_p in, char* inputs[],
+                              long opt_key, IOFormat *in_format,
+                              char*** sources, long *source_no)
+{
+   char     *name;
+   long     i, n, size, file_size;
+   long     magic_len = strlen(PROBLEM_CACHE_MAGIC);
+   uint64_t hash, file_hash;
+
+   *sources = NULL;
+   if(in->size < magic_len ||
+      memcmp(in->buffer, PROBLEM_CACHE_MAGIC, magic_len)!=0)
+   {
+      return false;
+   }
+   in->pos += magic_len;
+   if(SnapReadLong(in) != PROBLEM_CACHE_VERSION ||
+      SnapReadLong(in) != opt_key)
+   {
+      return false;
+   }
+   *in_format = SnapReadLong(in);
+
+   n = SnapReadLong(in);
+   for(i=0; i<n; i++)
+   {
+      name = SnapReadStr(in);
+      if(!inputs[i] || !name || strcmp(inputs[i], name)!=0)
+      {
+         return false;
+      }
+   }
+   if(inputs[n])
+   {
+      return false;
+   }
+
+   n = SnapReadLong(in);
+   if(n < 0 || n > in->size)
+   {
+      return false;
+   }
+   *source_no = n;
+   *sources = SecureMalloc(MAX(n,1)*sizeof(char*));
+   for(i=0; i<n; i++)
+   {
+      name = SnapReadStr(in);
+      size = SnapReadLong(in);
+      hash = SnapReadFixed(in);
+      if(!name || !file_content_hash(name, &file_size, &file_hash) ||
+         file_size != size || file_hash != hash)
+      {
+         return false;
+      }
+      (*sources)[i] = name;
+   }
+   return true;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: SnapWriteLong()
+// Function: SnapWriteFixed()
+// Function: SnapWriteStr()
+//
+//   Write a number, a fixed-width (64 bit, for hashes and values
+//   patched in later) number, or a (possibly NULL) string to the
+//   snapshot.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void SnapWriteLong(FILE* out, long value)
+{
+   unsigned long bits = ((unsigned long)value<<1)^(value<0?~0UL:0UL);
+
+   while(bits >= 0x80)
+   {
+      putc((int)((bits&0x7f)|0x80), out);
+      bits >>= 7;
+   }
+   putc((int)bits, out);
+}
+
+void SnapWriteFixed(FILE* out, uint64_t value)
+{
+   int i;
+
+   for(i=0; i<8; i++)
+   {
+      putc((int)((value>>(8*i))&0xff), out);
+   }
+}
+
+void SnapWriteStr(FILE* out, char* str)
+{
+   long len = str?(long)strlen(str)+1:-1;
+
+   SnapWriteLong(out, len);
+   if(str)
+   {
+      fwrite(str, 1, len, out);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SnapReadLong()
+// Function: SnapReadFixed()
+// Function: SnapReadStr()
+//
+//   Read a number, a fixed-width number, or a string from the
+//   snapshot. Strings are returned as pointers into the buffer and
+//   must not be freed. Terminates with an error on truncated input.
+//
+// Global Variables: -
+//
+// Side Effects    : Advances the reader
+//
+/----------------------------------------------------------------------*/
+
+long SnapReadLong(SnapReader_p in)
+{
+   unsigned long bits = 0, byte;
+   int           shift = 0;
+
+   do
+   {
+      if(in->pos >= in->size || shift >= (int)(8*sizeof(long)))
+      {
+         Error("%s: Binary file is truncated", FILE_ERROR, in->name);
+      }
+      byte = (unsigned char)in->buffer[in->pos++];
+      bits |= (byte&0x7f)<<shift;
+      shift += 7;
+   }while(byte&0x80);
+
+   return (long)(bits>>1)^-(long)(bits&1);
+}
+
+uint64_t SnapReadFixed(SnapReader_p in)
+{
+   uint64_t res = 0;
+   int      i;
+
+   if(in->pos+8 > in->size)
+   {
+      Error("%s: Binary file is truncated", FILE_ERROR, in->name);
+   }
+   for(i=0; i<8; i++)
+   {
+      res |= (uint64_t)(unsigned char)in->buffer[in->pos++]<<(8*i);
+   }
+   return res;
+}
+
+char* SnapReadStr(SnapReader_p in)
+{
+   long  len = SnapReadLong(in);
+   char* res;
+
+   if(len == -1)
+   {
+      return NULL;
+   }
+   if(len < 1 || in->pos+len > in->size || in->buffer[in->pos+len-1])
+   {
+      Error("%s: Binary file is corrupted", FILE_ERROR, in->name);
+   }
+   res = in->buffer+in->pos;
+   in->pos += len;
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SnapReadIndex()
+//
+//   Read a reference to an earlier entry (terms, sources) and check
+//   that it is in range.
+//
+// Global Variables: -
+//
+// Side Effects    : Advances the reader
+//
+/----------------------------------------------------------------------*/
+
+long SnapReadIndex(SnapReader_p in, long limit)
+{
+   long res = SnapReadLong(in);
+
+   if(res < 0 || res >= limit)
+   {
+      Error("%s: Binary file is corrupted", FILE_ERROR, in->name);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SnapReaderOpen()
+//
+//   Make the complete file available to the reader, either mapped
+//   read-only into memory (if map is true) or with a single read.
+//   Mapped files are shared between all processes reading them.
+//   Return false if the file does not exist or cannot be read.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, input
+//
+/----------------------------------------------------------------------*/
+
+bool SnapReaderOpen(SnapReader_p in, char* name, bool map)
+{
+   FILE* file = fopen(name, "r");
+   long  size;
+   void* mem;
+
+   if(!file)
+   {
+      return false;
+   }
+   if(fseek(file, 0, SEEK_END)!=0 || (size = ftell(file)) < 0 ||
+      fseek(file, 0, SEEK_SET)!=0)
+   {
+      fclose(file);
+      return false;
+   }
+   in->name   = name;
+   in->size   = size;
+   in->pos    = 0;
+   in->mapped = false;
+   if(map && size)
+   {
+      mem = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fileno(file), 0);
+      if(mem != MAP_FAILED)
+      {
+         in->buffer = mem;
+         in->mapped = true;
+         fclose(file);
+         return true;
+      }
+   }
+   in->buffer = SecureMalloc(MAX(size,1));
+   if((long)fread(in->buffer, 1, size, file)!=size)
+   {
+      FREE(in->buffer);
+      fclose(file);
+      return false;
+   }
+   fclose(file);
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SnapReaderClose()
+//
+//   Release the memory of a reader opened with SnapReaderOpen().
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SnapReaderClose(SnapReader_p in)
+{
+   if(in->mapped)
+   {
+      munmap(in->buffer, in->size);
+   }
+   else
+   {
+      FREE(in->buffer);
+   }
+   in->buffer = NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ProblemCacheLoad()
+//
+//   Try to load the snapshot in cache_name into the (fresh) term
+//   bank and the sets. inputs is the NULL-terminated list of input
+//   files given by the user, opt_key encodes all options that
+//   influence parsing. in_format receives the format detected when
+//   the snapshot was written. Return true on success, false if the
+//   snapshot does not exist or is stale (in this case, nothing has
+//   been changed). Terminates with an error on corrupted snapshots.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, changes bank, signature and sets.
+//
+/----------------------------------------------------------------------*/
+
+bool ProblemCacheLoad(char* cache_name, char* inputs[], long opt_key,
+                      IOFormat *in_format, TB_p terms,
+                      FormulaSet_p fset, ClauseSet_p wlset)
+{
+   SnapReaderCell in;
+   char           **sources;
+   long           source_no, i, j, count, lit_no;
+   Term_p         *table;
+   WFormula_p     form;
+   Clause_p       clause;
+   Eqn_p          lits, lit;
+   FormulaProperties props;
+   EqnProperties  lit_props;
+   Term_p         lterm, rterm;
+
+   if(!SnapReaderOpen(&in, cache_name, false))
+   {
+      return false;
+   }
+   if(!snap_header_valid(&in, inputs, opt_key, in_format,
+                         &sources, &source_no))
+   {
+      VERBOUTARG("Ignoring stale problem cache ", cache_name);
+      if(sources)
+      {
+         FREE(sources);
+      }
+      SnapReaderClose(&in);
+      return false;
+   }
+   snap_read_signature(&in, terms->sig);
+   terms->vars->v_count = MAX(terms->vars->v_count, SnapReadLong(&in));
+
+   count = SnapReadFixed(&in);
+   if(count < 0 || count > in.size)
+   {
+      Error("%s: Problem cache is corrupted", FILE_ERROR, in.name);
+   }
+   table = SecureMalloc(MAX(count,1)*sizeof(Term_p));
+   for(i=0; i<count; i++)
+   {
+      table[i] = snap_read_term(&in, terms, table, i);
+   }
+
+   for(i=SnapReadLong(&in); i>0; i--)
+   {
+      props = SnapReadLong(&in);
+      form = WTFormulaAlloc(terms, table[SnapReadIndex(&in, count)]);
+      form->is_clause  = SnapReadLong(&in);
+      form->properties = props;
+      form->info       = snap_read_info(&in, sources, source_no);
+      FormulaSetInsert(fset, form);
+   }
+   for(i=SnapReadLong(&in); i>0; i--)
+   {
+      props  = SnapReadLong(&in);
+      lit_no = SnapReadLong(&in);
+      lits   = NULL;
+      for(j=0; j<lit_no; j++)
+      {
+         lit_props = SnapReadLong(&in);
+         lterm = table[SnapReadIndex(&in, count)];
+         rterm = table[SnapReadIndex(&in, count)];
+         lit = EqnAlloc(lterm, rterm, terms,
+                        lit_props & EPIsPositive);
+         lit->properties = lit_props;
+         EqnListAppend(&lits, lit);
+      }
+      clause = ClauseAlloc(lits);
+      clause->properties = props;
+      clause->info = snap_read_info(&in, sources, source_no);
+      ClauseSetInsert(wlset, clause);
+   }
+   if(in.pos != in.size)
+   {
+      Error("%s: Problem cache is corrupted", FILE_ERROR, in.name);
+   }
+   FREE(table);
+   FREE(sources);
+   SnapReaderClose(&in);
+   VERBOUTARG("Problem read from cache ", cache_name);
+
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ProblemCacheStore()
+//
+//   Write a snapshot of the freshly parsed problem (in terms, fset
+//   and wlset) to cache_name. The file is written under a temporary
+//   name and renamed, so that concurrent readers never see a partial
+//   snapshot. opened lists the names of all files opened during
+//   parsing (see StreamFileLog), or is NULL. Return true on
+//   success. Failure to write the cache is not fatal, but results in
+//   a warning.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+bool ProblemCacheStore(char* cache_name, char* inputs[],
+                       PStack_p opened, long opt_key,
+                       IOFormat in_format, TB_p terms,
+                       FormulaSet_p fset, ClauseSet_p wlset)
+{
+   DStr_p     tmp_name = DStrAlloc();
+   FILE*      out;
+   StrTree_p  source_index = NULL;
+   PStack_p   sources = PStackAlloc();
+   PDArray_p  shared, vars, var_terms;
+   long       i, input_no, count, count_pos, end_pos, lit_no;
+   long       size;
+   uint64_t   hash;
+   WFormula_p form;
+   Clause_p   clause;
+   Eqn_p      lit;
+   bool       res = false, failed;
+
+   DStrAppendStr(tmp_name, cache_name);
+   DStrAppendStr(tmp_name, ".tmp");
+   DStrAppendInt(tmp_name, getpid());
+
+   snap_collect_sources(inputs, opened, fset, wlset, &source_index,
+                        sources);
+
+   out = fopen(DStrView(tmp_name), "w");
+   if(!out)
+   {
+      TmpErrno = errno;
+      SysWarning("Cannot write problem cache %s", DStrView(tmp_name));
+      goto cleanup;
+   }
+   fputs(PROBLEM_CACHE_MAGIC, out);
+   SnapWriteLong(out, PROBLEM_CACHE_VERSION);
+   SnapWriteLong(out, opt_key);
+   SnapWriteLong(out, in_format);
+   for(input_no=0; inputs[input_no]; input_no++)
+   {
+      /* Just count */
+   }
+   SnapWriteLong(out, input_no);
+   for(i=0; inputs[i]; i++)
+   {
+      SnapWriteStr(out, inputs[i]);
+   }
+   SnapWriteLong(out, PStackGetSP(sources));
+   for(i=0; i<PStackGetSP(sources); i++)
+   {
+      if(!file_content_hash(PStackElementP(sources, i), &size, &hash))
+      {
+         Warning("Cannot read %s, problem not cached",
+                 (char*)PStackElementP(sources, i));
+         fclose(out);
+         FileRemove(DStrView(tmp_name));
+         goto cleanup;
+      }
+      SnapWriteStr(out, PStackElementP(sources, i));
+      SnapWriteLong(out, size);
+      SnapWriteFixed(out, hash);
+   }
+   snap_write_signature(out, terms->sig);
+   SnapWriteLong(out, terms->vars->v_count);
+
+   /* Terms are written in the order they are discovered, with the
+      final count patched in afterwards. */
+   shared    = PDIntArrayAlloc(TBNonVarTermNodes(terms)+1, 0);
+   vars      = PDIntArrayAlloc(64, 0);
+   var_terms = PDArrayAlloc(64, 0);
+   count     = 0;
+   count_pos = ftell(out);
+   SnapWriteFixed(out, 0);
+   for(form = fset->anchor->succ; form!=fset->anchor; form = form->succ)
+   {
+      snap_write_term(out, form->tformula, shared, vars, var_terms, &count);
+   }
+   for(clause = wlset->anchor->succ; clause!=wlset->anchor;
+       clause = clause->succ)
+   {
+      for(lit = clause->literals; lit; lit = lit->next)
+      {
+         snap_write_term(out, lit->lterm, shared, vars, var_terms, &count);
+         snap_write_term(out, lit->rterm, shared, vars, var_terms, &count);
+      }
+   }
+   end_pos = ftell(out);
+   fseek(out, count_pos, SEEK_SET);
+   SnapWriteFixed(out, count);
+   fseek(out, end_pos, SEEK_SET);
+
+   /* All terms are known now, so the lookups below just return the
+      positions. */
+   SnapWriteLong(out, fset->members);
+   for(form = fset->anchor->succ; form!=fset->anchor; form = form->succ)
+   {
+      SnapWriteLong(out, form->properties);
+      SnapWriteLong(out, snap_write_term(out, form->tformula, shared,
+                                           vars, var_terms, &count));
+      SnapWriteLong(out, form->is_clause);
+      snap_write_info(out, form->info, &source_index, sources);
+   }
+   SnapWriteLong(out, wlset->members);
+   for(clause = wlset->anchor->succ; clause!=wlset->anchor;
+       clause = clause->succ)
+   {
+      SnapWriteLong(out, clause->properties);
+      lit_no = 0;
+      for(lit = clause->literals; lit; lit = lit->next)
+      {
+         lit_no++;
+      }
+      SnapWriteLong(out, lit_no);
+      for(lit = clause->literals; lit; lit = lit->next)
+      {
+         SnapWriteLong(out, lit->properties);
+         SnapWriteLong(out, snap_write_term(out, lit->lterm, shared,
+                                              vars, var_terms, &count));
+         SnapWriteLong(out, snap_write_term(out, lit->rterm, shared,
+                                              vars, var_terms, &count));
+      }
+      snap_write_info(out, clause->info, &source_index, sources);
+   }
+   PDArrayFree(shared);
+   PDArrayFree(vars);
+   PDArrayFree(var_terms);
+
+   failed = ferror(out);
+   if(fclose(out)!=0)
+   {
+      failed = true;
+   }
+   if(failed)
+   {
+      TmpErrno = errno;
+      SysWarning("Cannot write problem cache %s", DStrView(tmp_name));
+      FileRemove(DStrView(tmp_name));
+   }
+   else if(rename(DStrView(tmp_name), cache_name)!=0)
+   {
+      TmpErrno = errno;
+      SysWarning("Cannot rename %s to %s", DStrView(tmp_name), cache_name);
+      FileRemove(DStrView(tmp_name));
+   }
+   else
+   {
+      VERBOUTARG("Problem written to cache ", cache_name);
+      res = true;
+   }
+
+cleanup:
+   StrTreeFree(source_index);
+   PStackFree(sources);
+   DStrFree(tmp_name);
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
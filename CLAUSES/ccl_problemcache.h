@@ -0,0 +1,96 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_problemcache.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Binary snapshots of parsed problems. A snapshot stores the sort
+  table, the types and symbols of the signature, all shared terms
+  reachable from the parsed formulas (in topological order, each
+  term referring to its arguments by position in the file), the
+  formulas with their clause info, and inline watchlist clauses.
+
+  Loading a snapshot replaces the character-level scanner and the
+  term parser with a single bulk read and one term bank insertion
+  per stored term. Snapshots are keyed by the names and content
+  hashes of the input files and of all files opened while parsing
+  them (including includes that contribute nothing), so stale
+  snapshots are detected and ignored. Snapshots are only valid for the E version that
+  wrote them.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 16:02:47 CEST 2026
+    New
+<2> Mon Oct 19 23:58:02 CEST 2026
+    Export the encoding and the reader.
+<3> Wed Oct 21 11:37:16 CEST 2026
+    Key snapshots by all files opened during parsing.
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCL_PROBLEMCACHE
+
+#define CCL_PROBLEMCACHE
+
+#include <stdint.h>
+#include <ccl_formulasets.h>
+#include <ccl_clausesets.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Bump this whenever the layout of a snapshot changes. */
+
+#define PROBLEM_CACHE_MAGIC   "ESNAP"
+#define PROBLEM_CACHE_VERSION 1
+
+/* Reading binary files (problem snapshots, compiled watchlists) */
+
+typedef struct snap_reader_cell
+{
+   char *name;
+   char *buffer;
+   long size;
+   long pos;
+   bool mapped; /* buffer is mmap()ed, not allocated */
+}SnapReaderCell, *SnapReader_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+void     SnapWriteLong(FILE* out, long value);
+void     SnapWriteFixed(FILE* out, uint64_t value);
+void     SnapWriteStr(FILE* out, char* str);
+long     SnapReadLong(SnapReader_p in);
+uint64_t SnapReadFixed(SnapReader_p in);
+char*    SnapReadStr(SnapReader_p in);
+long     SnapReadIndex(SnapReader_p in, long limit);
+bool     SnapReaderOpen(SnapReader_p in, char* name, bool map);
+void     SnapReaderClose(SnapReader_p in);
+
+bool ProblemCacheLoad(char* cache_name, char* inputs[], long opt_key,
+                      IOFormat *in_format, TB_p terms,
+                      FormulaSet_p fset, ClauseSet_p wlset);
+bool ProblemCacheStore(char* cache_name, char* inputs[],
+                       PStack_p opened, long opt_key,
+                       IOFormat in_format, TB_p terms,
+                       FormulaSet_p fset, ClauseSet_p wlset);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -28,6 +28,18 @@
 
 char* UseInlinedWatchList = WATCHLIST_INLINE_STRING;
 
+char* ProofStatePhaseNames[] =
+{
+   "clause selection",
+   "forward simplification",
+   "backward simplification",
+   "indexing",
+   "clause generation",
+   "new clause processing",
+   "unprocessed set cleanup",
+   "propositional checks"
+};
+
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
 /*---------------------------------------------------------------------*/
@@ -142,6 +154,7 @@ static void clause_set_pick_training_examples(ClauseSet_p set,
 ProofState_p ProofStateAlloc(FunctionProperties free_symb_prop)
 {
    ProofState_p handle = ProofStateCellAlloc();
+   int i;
 
    handle->sort_table           = DefaultSortTableAlloc();
    handle->signature            = SigAlloc(handle->sort_table);
@@ -217,6 +230,11 @@ ProofState_p ProofStateAlloc(FunctionProperties free_symb_prop)
    handle->resolv_count       = 0;
    handle->satcheck_count     = 0;
    handle->satcheck_success   = 0;
+   for(i=0; i<PSPhaseNumber; i++)
+   {
+      handle->phase_time[i]   = 0;
+   }
+   handle->phase_start        = 0;
    handle->gc_count           = 0;
    handle->gc_used_count      = 0;
 
@@ -234,7 +252,8 @@ ProofState_p ProofStateAlloc(FunctionProperties free_symb_prop)
 // Function: ProofStateLoadWatchlist()
 //
 //   Load the watchlist (if requested and not inline), remove it if
-//   not requested.
+//   not requested. Compiled watchlists (see ccl_wlindex.h) are
+//   recognized automatically.
 //
 // Global Variables: -
 //
@@ -252,7 +271,12 @@ void ProofStateLoadWatchlist(ProofState_p state,
 
    if(watchlist_filename)
    {
-      if(watchlist_filename!=UseInlinedWatchList)
+      if(watchlist_filename!=UseInlinedWatchList &&
+         WLIndexFileIsIndex(watchlist_filename))
+      {
+         WLIndexLoad(watchlist_filename, state->watchlist, state->terms);
+      }
+      else if(watchlist_filename!=UseInlinedWatchList)
       {
          in = CreateScanner(StreamTypeFile, watchlist_filename, true, NULL);
          ScannerSetFormat(in, parse_format);
@@ -563,6 +587,8 @@ void ProofStateTrain(ProofState_p state, bool print_pos, bool print_neg)
 
 void ProofStateStatisticsPrint(FILE* out, ProofState_p state)
 {
+   int i;
+
    fprintf(out, "# Initial clauses in saturation        : %ld\n",
       state->axioms->members);
    fprintf(out, "# Processed clauses                    : %ld\n",
@@ -623,6 +649,12 @@ void ProofStateStatisticsPrint(FILE* out, ProofState_p state)
    fprintf(out,
       "# Current number of archived clauses   : %ld\n",
       state->archive->members);
+   for(i=0; i<PSPhaseNumber; i++)
+   {
+      fprintf(out, "# Time in %-29s: %.3f s\n",
+              ProofStatePhaseNames[i], state->phase_time[i]/1000000.0);
+   }
+   GCPrintStatistics(out, state->gc_terms);
    if(ProofObjectRecordsGCSelection)
    {
       fprintf(out,
@@ -29,11 +29,30 @@
 #include <ccl_def_handling.h>
 #include <ccl_garbage_coll.h>
 #include <ccl_global_indices.h>
+#include <ccl_wlindex.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
 /*---------------------------------------------------------------------*/
 
+/* Phases of the given-clause loop, timed separately. The phase
+   timers use wall clock time (GetUSecTime()), as the CPU time clock
+   is a system call and too expensive to read several times per
+   given clause. */
+
+typedef enum
+{
+   PSPSelection,
+   PSPForwardSimp,
+   PSPBackwardSimp,
+   PSPIndexing,
+   PSPGeneration,
+   PSPNewClauses,
+   PSPCleanup,
+   PSPSATCheck,
+   PSPhaseNumber
+}ProofStatePhase;
+
 /* Proof state */
 
 typedef struct proofstatecell
@@ -94,6 +113,8 @@ typedef struct proofstatecell
    unsigned long resolv_count;
    unsigned long satcheck_count;
    unsigned long satcheck_success;
+   long long     phase_time[PSPhaseNumber]; /* Microseconds */
+   long long     phase_start; /* End of last timed phase */
 
    /* The following are only set by ProofStateAnalyse() after
       DerivationCompute() at the end of the proof search. */
@@ -140,6 +161,17 @@ void         ProofStateFree(ProofState_p junk);
     ClauseSetStorage((state)->archive)+                 \
     TBStorage((state)->terms))
 
+/* Account the time since the end of the previous phase to phase */
+
+#define      ProofStatePhaseStart(state)                 \
+   ((state)->phase_start = GetUSecTime())
+#define      ProofStatePhaseDone(state, phase)           \
+   do{                                                   \
+      long long now_ = GetUSecTime();                    \
+      (state)->phase_time[(phase)] += now_-(state)->phase_start; \
+      (state)->phase_start = now_;                       \
+   }while(0)
+
 #define      ProofStateProcCardinality(state)          \
    (ClauseSetCardinality((state)->processed_pos_rules)+   \
     ClauseSetCardinality((state)->processed_pos_eqns)+    \
@@ -168,6 +200,8 @@ void ProofStatePropDocQuote(FILE* out, int level,
 #define ProofStateAxNo(state) (ClauseSetCardinality((state)->axioms)+\
                                FormulaSetCardinality((state)->f_axioms))
 
+extern char* ProofStatePhaseNames[];
+
 #define WATCHLIST_INLINE_STRING "Use inline watchlist type"
 #define WATCHLIST_INLINE_QSTRING "'" WATCHLIST_INLINE_STRING "'"
 extern char* UseInlinedWatchList;
@@ -177,6 +177,7 @@ static RWResultType term_is_top_rewritable(TB_p bank, OCB_p ocb,
          {
             rterm = TBInsertInstantiated(bank, eqn->rterm);
             TermAddRWLink(term, rterm, new_demod, ClauseIsSOS(new_demod), res);
+            TBGCRememberRWLink(bank, term);
          }
       }
       SubstBacktrack(subst);
@@ -199,6 +200,7 @@ static RWResultType term_is_top_rewritable(TB_p bank, OCB_p ocb,
 
             rterm = TBInsertInstantiated(bank, eqn->lterm);
             TermAddRWLink(term, rterm, new_demod, ClauseIsSOS(new_demod), res);
+            TBGCRememberRWLink(bank, term);
     }
       }
    }
@@ -535,6 +537,7 @@ static Term_p rewrite_with_clause_set(OCB_p ocb, TB_p bank, Term_p term,
       assert(pos->clause->ident);
       TermAddRWLink(term, repl, pos->clause, ClauseIsSOS(pos->clause),
                     restricted_rw?RWAlwaysRewritable:RWLimitedRewritable);
+      TBGCRememberRWLink(bank, term);
       term = repl;
    }
    SubstDelete(subst);
@@ -622,6 +625,7 @@ static bool term_subterm_rewrite(RWDesc_p desc, Term_p *term)
       assert(new_term!=*term);
       TermAddRWLink(*term, new_term, REWRITE_AT_SUBTERM, false,
                     RWAlwaysRewritable);
+      TBGCRememberRWLink(desc->bank, *term);
       *term = new_term;
    }
    else
@@ -911,6 +915,7 @@ static long term_find_rw_clauses(Clause_p demod,
          {
             rterm = TBInsertInstantiated(eqn->bank, rterm);
             TermAddRWLink(term, rterm, demod, ClauseIsSOS(demod), rwres);
+            TBGCRememberRWLink(eqn->bank, term);
             //TermDeleteRWLink(term);
          }
       }
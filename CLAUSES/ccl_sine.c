@@ -18,6 +18,8 @@ Changes
 
 <1> Fri Jul  2 01:15:26 CEST 2010
     New
+<2> Mon Oct 19 17:21:05 CEST 2026
+    Persistent SinE indices
 
 -----------------------------------------------------------------------*/
 
@@ -39,6 +41,300 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: sine_index_add_axiom()
+//
+//   Create a SineAxiomCell for axiom and add it to the index and to
+//   the occurrence lists of its symbols. The symbols are not sorted
+//   yet. symbol_stack is an empty scratch stack.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void sine_index_add_axiom(SineIndex_p index, AxiomType type,
+                                 void* axiom, PStack_p symbol_stack)
+{
+   GenDistrib_p  generality = index->generality;
+   SineAxiom_p   handle = SineAxiomCellAlloc();
+   PStack_p      occ;
+   PStackPointer sp;
+   FunCode       f;
+   long          count = 0;
+
+   if(type == ATClause)
+   {
+      ClauseAddSymbolDistExist((Clause_p)axiom, generality->f_distrib,
+                               symbol_stack);
+   }
+   else
+   {
+      TermAddSymbolDistExist(((WFormula_p)axiom)->tformula,
+                             generality->f_distrib, symbol_stack);
+   }
+   for(sp=0; sp<PStackGetSP(symbol_stack); sp++)
+   {
+      f = PStackElementInt(symbol_stack, sp);
+      generality->f_distrib[f] = 0;
+      if(f >= generality->sig->internal_symbols)
+      {
+         count++;
+      }
+   }
+   handle->type    = type;
+   handle->axiom   = axiom;
+   handle->sym_no  = 0;
+   handle->symbols = count?SizeMalloc(count*sizeof(FunCode)):NULL;
+   handle->touched = false;
+
+   for(sp=0; sp<PStackGetSP(symbol_stack); sp++)
+   {
+      f = PStackElementInt(symbol_stack, sp);
+      if(f >= generality->sig->internal_symbols)
+      {
+         handle->symbols[handle->sym_no++] = f;
+         occ = PDArrayElementP(index->occurrences, f);
+         if(!occ)
+         {
+            occ = PStackAlloc();
+            PDArrayAssignP(index->occurrences, f, occ);
+         }
+         PStackPushP(occ, handle);
+      }
+   }
+   PStackReset(symbol_stack);
+   PStackPushP(index->axioms, handle);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sine_axiom_free()
+//
+//   Free a SineAxiomCell (but not the axiom).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void sine_axiom_free(SineAxiom_p junk)
+{
+   if(junk->symbols)
+   {
+      SizeFree(junk->symbols, junk->sym_no*sizeof(FunCode));
+   }
+   SineAxiomCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sine_index_changed_symbols()
+//
+//   Push the symbols of all indexed axioms from position start on
+//   onto res (without duplicates).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void sine_index_changed_symbols(SineIndex_p index, long start,
+                                       PStack_p res)
+{
+   long          *seen = index->generality->f_distrib;
+   SineAxiom_p   handle;
+   PStackPointer i, sp;
+   long          j;
+
+   for(i=start; i<PStackGetSP(index->axioms); i++)
+   {
+      handle = PStackElementP(index->axioms, i);
+      for(j=0; j<handle->sym_no; j++)
+      {
+         if(!seen[handle->symbols[j]])
+         {
+            seen[handle->symbols[j]] = 1;
+            PStackPushInt(res, handle->symbols[j]);
+         }
+      }
+   }
+   for(sp=0; sp<PStackGetSP(res); sp++)
+   {
+      seen[PStackElementInt(res, sp)] = 0;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sine_index_reorder()
+//
+//   Re-sort the symbols of all indexed axioms that contain one of the
+//   symbols in changed.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes index
+//
+/----------------------------------------------------------------------*/
+
+static void sine_index_reorder(SineIndex_p index, PStack_p changed)
+{
+   PStack_p      touched = PStackAlloc();
+   PStack_p      occ;
+   SineAxiom_p   handle;
+   PStackPointer i, j;
+
+   for(i=0; i<PStackGetSP(changed); i++)
+   {
+      occ = PDArrayElementP(index->occurrences,
+                            PStackElementInt(changed, i));
+      if(!occ)
+      {
+         continue;
+      }
+      for(j=0; j<PStackGetSP(occ); j++)
+      {
+         handle = PStackElementP(occ, j);
+         if(!handle->touched)
+         {
+            handle->touched = true;
+            PStackPushP(touched, handle);
+         }
+      }
+   }
+   while(!PStackEmpty(touched))
+   {
+      handle = PStackPopP(touched);
+      handle->touched = false;
+      GenDistribSortSymbols(index->generality, index->gentype,
+                            handle->symbols, handle->sym_no);
+   }
+   PStackFree(touched);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: drel_add_axiom()
+//
+//   Add axiom (of type type) to the D-Relation entry for f_code.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void drel_add_axiom(DRelation_p drel, FunCode f_code,
+                           AxiomType type, void* axiom)
+{
+   DRel_p rel = DRelationGetFEntry(drel, f_code);
+
+   if(type == ATClause)
+   {
+      PStackPushP(rel->d_clauses, axiom);
+   }
+   else
+   {
+      PStackPushP(rel->d_formulas, axiom);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: select_axioms_drel()
+//
+//   Select axioms from the sets based on the prepared D-Relation
+//   drel. See SelectAxioms().
+//
+// Global Variables: -
+//
+// Side Effects    : Changes activation bits in drel, see
+//                   SelectAxioms().
+//
+/----------------------------------------------------------------------*/
+
+static long select_axioms_drel(DRelation_p       drel,
+                               Sig_p             sig,
+                               PStack_p          clause_sets,
+                               PStack_p          formula_sets,
+                               PStackPointer     seed_start,
+                               AxFilter_p        ax_filter,
+                               PStack_p          res_clauses,
+                               PStack_p          res_formulas)
+{
+   long          res   = 0;
+   long          seeds = 0;
+   PQueue_p      selq  = PQueueAlloc();
+   PStackPointer i;
+   long          ax_cardinality, max_result_size;
+
+   assert(PStackGetSP(clause_sets)==PStackGetSP(formula_sets));
+
+   for(i=seed_start; i<PStackGetSP(clause_sets); i++)
+   {
+      seeds += ClauseSetFindAxSelectionSeeds(PStackElementP(clause_sets, i),
+                                             selq,
+                                             ax_filter->use_hypotheses);
+      seeds += FormulaSetFindAxSelectionSeeds(PStackElementP(formula_sets, i),
+                                              selq,
+                                              ax_filter->use_hypotheses);
+   }
+   /* fprintf(GlobalOut, "# Hypotheses found (%lld)\n",
+      GetSecTimeMod()); */
+   VERBOSE(fprintf(stderr, "# Found %ld seed clauses/formulas\n", seeds););
+   if(!seeds)
+   {
+      /* No goals-> the empty set contains all relevant clauses */
+   }
+   else
+   {
+      ax_cardinality =
+         FormulaSetStackCardinality(formula_sets)+
+         ClauseSetStackCardinality(clause_sets);
+      max_result_size = ax_filter->max_set_fraction*ax_cardinality;
+      if(ax_filter->max_set_size < max_result_size)
+      {
+         max_result_size = ax_filter->max_set_size;
+      }
+      if(true)
+         /* "true" may be exported as an option eventually */
+      {
+         DRel_p no_symbol_axioms = PDArrayElementP(drel->relation, 0);
+         if(no_symbol_axioms && ax_filter->add_no_symbol_axioms)
+         {
+            PStackPushStack(res_clauses,  no_symbol_axioms->d_clauses);
+            PStackPushStack(res_formulas, no_symbol_axioms->d_formulas);
+         }
+         res = PStackGetSP(res_clauses)+PStackGetSP(res_formulas);
+      }
+      res += SelectDefiningAxioms(drel,
+                                 sig,
+                                 ax_filter->max_recursion_depth,
+                                 max_result_size,
+                                 selq,
+                                 res_clauses,
+                                 res_formulas);
+   }
+   PStackFormulaDelProp(res_formulas, CPIsRelevant);
+   PStackClauseDelProp(res_clauses, CPIsRelevant);
+   /* fprintf(GlobalOut, "# Axioms selected (%lld)\n",
+      GetSecTimeMod()); */
+   PQueueFree(selq);
+
+   return res;
+}
+
+
 
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
@@ -394,6 +690,234 @@ void DRelationAddFormulaSets(DRelation_p drel,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: SineIndexAlloc()
+//
+//   Allocate an empty SinE index for the given distribution and
+//   generality measure.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+SineIndex_p SineIndexAlloc(GenDistrib_p generality,
+                           GeneralityMeasure gentype)
+{
+   SineIndex_p handle = SineIndexCellAlloc();
+
+   handle->generality  = generality;
+   handle->gentype     = gentype;
+   handle->axioms      = PStackAlloc();
+   handle->set_starts  = PStackAlloc();
+   handle->occurrences = PDArrayAlloc(1000, 0);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SineIndexFree()
+//
+//   Free a SinE index (but not the distribution or the axioms).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SineIndexFree(SineIndex_p index)
+{
+   long i;
+
+   while(!PStackEmpty(index->axioms))
+   {
+      sine_axiom_free(PStackPopP(index->axioms));
+   }
+   PStackFree(index->axioms);
+   PStackFree(index->set_starts);
+   for(i=0; i<index->occurrences->size; i++)
+   {
+      if(PDArrayElementP(index->occurrences, i))
+      {
+         PStackFree(PDArrayElementP(index->occurrences, i));
+      }
+   }
+   PDArrayFree(index->occurrences);
+   SineIndexCellFree(index);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SineIndexPushSets()
+//
+//   Add all sets from clause_sets/formula_sets that are not yet
+//   indexed to the index. The distribution has to include the new
+//   sets already. Old axioms sharing symbols with the new ones are
+//   reordered.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SineIndexPushSets(SineIndex_p index,
+                       PStack_p clause_sets,
+                       PStack_p formula_sets)
+{
+   PStack_p      scratch = PStackAlloc();
+   long          start = PStackGetSP(index->axioms);
+   ClauseSet_p   cset;
+   FormulaSet_p  fset;
+   Clause_p      clause;
+   WFormula_p    form;
+   PStackPointer i;
+
+   assert(PStackGetSP(clause_sets)==PStackGetSP(formula_sets));
+   assert(index->generality->size > index->generality->sig->f_count);
+
+   for(i=SineIndexSets(index); i<PStackGetSP(clause_sets); i++)
+   {
+      PStackPushInt(index->set_starts, PStackGetSP(index->axioms));
+      cset = PStackElementP(clause_sets, i);
+      for(clause = cset->anchor->succ;
+          clause != cset->anchor;
+          clause = clause->succ)
+      {
+         sine_index_add_axiom(index, ATClause, clause, scratch);
+      }
+      fset = PStackElementP(formula_sets, i);
+      for(form = fset->anchor->succ;
+          form != fset->anchor;
+          form = form->succ)
+      {
+         sine_index_add_axiom(index, ATFormula, form, scratch);
+      }
+   }
+   sine_index_changed_symbols(index, start, scratch);
+   sine_index_reorder(index, scratch);
+   PStackFree(scratch);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SineIndexPopSets()
+//
+//   Remove all sets from position sp on from the index. The
+//   distribution has to be backtracked already, but the sets must
+//   not be freed yet. Remaining axioms sharing symbols with the
+//   removed ones are reordered.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SineIndexPopSets(SineIndex_p index, PStackPointer sp)
+{
+   PStack_p    changed;
+   SineAxiom_p handle;
+   PStack_p    occ;
+   long        start, j;
+
+   if(sp >= SineIndexSets(index))
+   {
+      return;
+   }
+   changed = PStackAlloc();
+   start = PStackElementInt(index->set_starts, sp);
+   sine_index_changed_symbols(index, start, changed);
+
+   /* Axioms are removed in reverse order of insertion, so they are
+      always on top of the occurrence lists. */
+   while(PStackGetSP(index->axioms) > start)
+   {
+      handle = PStackPopP(index->axioms);
+      for(j=0; j<handle->sym_no; j++)
+      {
+         occ = PDArrayElementP(index->occurrences, handle->symbols[j]);
+         assert(PStackTopP(occ) == handle);
+         PStackDiscardTop(occ);
+      }
+      sine_axiom_free(handle);
+   }
+   while(SineIndexSets(index) > sp)
+   {
+      PStackDiscardTop(index->set_starts);
+   }
+   sine_index_reorder(index, changed);
+   PStackFree(changed);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SineIndexDRelation()
+//
+//   Extract the D-Relation for the given parameters from the index
+//   (compare compute_d_rel() in ccl_f_generality.c). As symbols are
+//   presorted, no terms are visited and nothing is sorted.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+DRelation_p SineIndexDRelation(SineIndex_p index,
+                               double benevolence,
+                               long generosity)
+{
+   DRelation_p   drel = DRelationAlloc();
+   GenDistrib_p  generality = index->generality;
+   SineAxiom_p   handle;
+   PStackPointer i;
+   long          j, least_gen, gen_limit, aux_gen_limit;
+
+   for(i=0; i<PStackGetSP(index->axioms); i++)
+   {
+      handle = PStackElementP(index->axioms, i);
+      j = 0;
+      if(handle->sym_no)
+      {
+         least_gen = GenDistribGenerality(generality, index->gentype,
+                                          handle->symbols[0]);
+         gen_limit = least_gen*benevolence;
+         aux_gen_limit = GenDistribGenerality(
+            generality, index->gentype,
+            handle->symbols[MIN(generosity, handle->sym_no-1)]);
+         if(aux_gen_limit < gen_limit)
+         {
+            gen_limit = aux_gen_limit;
+         }
+         for(j=0; j<handle->sym_no; j++)
+         {
+            if(GenDistribGenerality(generality, index->gentype,
+                                    handle->symbols[j]) > gen_limit)
+            {
+               break;
+            }
+            drel_add_axiom(drel, handle->symbols[j],
+                           handle->type, handle->axiom);
+         }
+      }
+      if(!j)
+      {
+         drel_add_axiom(drel, 0, handle->type, handle->axiom);
+      }
+   }
+   return drel;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: PQueueStoreClause()
@@ -641,14 +1165,8 @@ long SelectAxioms(GenDistrib_p      f_distrib,
                   PStack_p          res_clauses,
                   PStack_p          res_formulas)
 {
-   long          res   = 0;
-   long          seeds = 0;
+   long          res;
    DRelation_p   drel  = DRelationAlloc();
-   PQueue_p      selq  = PQueueAlloc();
-   PStackPointer i;
-   long          ax_cardinality, max_result_size;
-
-   assert(PStackGetSP(clause_sets)==PStackGetSP(formula_sets));
 
    /* fprintf(GlobalOut, "# Axiom selection starts (%lld)\n",
       GetSecTimeMod()); */
@@ -664,57 +1182,49 @@ long SelectAxioms(GenDistrib_p      f_distrib,
                            formula_sets);
    /* fprintf(GlobalOut, "# DRelation constructed (%lld)\n",
     * GetSecTimeMod()); */
+   res = select_axioms_drel(drel, f_distrib->sig,
+                            clause_sets, formula_sets, seed_start,
+                            ax_filter, res_clauses, res_formulas);
+   DRelationFree(drel);
 
-   for(i=seed_start; i<PStackGetSP(clause_sets); i++)
-   {
-      seeds += ClauseSetFindAxSelectionSeeds(PStackElementP(clause_sets, i),
-                                             selq,
-                                             ax_filter->use_hypotheses);
-      seeds += FormulaSetFindAxSelectionSeeds(PStackElementP(formula_sets, i),
-                                              selq,
-                                              ax_filter->use_hypotheses);
-   }
-   /* fprintf(GlobalOut, "# Hypotheses found (%lld)\n",
-      GetSecTimeMod()); */
-   VERBOSE(fprintf(stderr, "# Found %ld seed clauses/formulas\n", seeds););
-   if(!seeds)
-   {
-      /* No goals-> the empty set contains all relevant clauses */
-   }
-   else
-   {
-      ax_cardinality =
-         FormulaSetStackCardinality(formula_sets)+
-         ClauseSetStackCardinality(clause_sets);
-      max_result_size = ax_filter->max_set_fraction*ax_cardinality;
-      if(ax_filter->max_set_size < max_result_size)
-      {
-         max_result_size = ax_filter->max_set_size;
-      }
-      if(true)
-         /* "true" may be exported as an option eventually */
-      {
-         DRel_p no_symbol_axioms = PDArrayElementP(drel->relation, 0);
-         if(no_symbol_axioms && ax_filter->add_no_symbol_axioms)
-         {
-            PStackPushStack(res_clauses,  no_symbol_axioms->d_clauses);
-            PStackPushStack(res_formulas, no_symbol_axioms->d_formulas);
-         }
-         res = PStackGetSP(res_clauses)+PStackGetSP(res_formulas);
-      }
-      res += SelectDefiningAxioms(drel,
-                                 f_distrib->sig,
-                                 ax_filter->max_recursion_depth,
-                                 max_result_size,
-                                 selq,
-                                 res_clauses,
-                                 res_formulas);
-   }
-   PStackFormulaDelProp(res_formulas, CPIsRelevant);
-   PStackClauseDelProp(res_clauses, CPIsRelevant);
-   /* fprintf(GlobalOut, "# Axioms selected (%lld)\n",
-      GetSecTimeMod()); */
-   PQueueFree(selq);
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SelectAxiomsIndexed()
+//
+//   As SelectAxioms(), but take the D-Relation from index, which has
+//   to cover exactly clause_sets and formula_sets and has to use
+//   ax_filter->gen_measure.
+//
+// Global Variables: -
+//
+// Side Effects    : Many, none expected permanent.
+//
+/----------------------------------------------------------------------*/
+
+long SelectAxiomsIndexed(SineIndex_p       index,
+                         PStack_p          clause_sets,
+                         PStack_p          formula_sets,
+                         PStackPointer     seed_start,
+                         AxFilter_p        ax_filter,
+                         PStack_p          res_clauses,
+                         PStack_p          res_formulas)
+{
+   long          res;
+   DRelation_p   drel;
+
+   assert(index->gentype == ax_filter->gen_measure);
+   assert(SineIndexSets(index) == PStackGetSP(clause_sets));
+
+   drel = SineIndexDRelation(index,
+                             ax_filter->benevolence,
+                             ax_filter->generosity);
+   res = select_axioms_drel(drel, index->generality->sig,
+                            clause_sets, formula_sets, seed_start,
+                            ax_filter, res_clauses, res_formulas);
    DRelationFree(drel);
 
    return res;
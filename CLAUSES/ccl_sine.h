@@ -19,6 +19,8 @@ Changes
 
 <1> Fri Jul  2 00:55:03 CEST 2010
     New
+<2> Mon Oct 19 17:21:05 CEST 2026
+    Persistent SinE indices
 
 -----------------------------------------------------------------------*/
 
@@ -63,6 +65,37 @@ typedef enum
 }AxiomType;
 
 
+/* A single clause or formula in a SinE index, with the non-internal
+ * function symbols occuring in it, sorted by increasing generality. */
+
+typedef struct sine_axiom_cell
+{
+   AxiomType type;
+   void*     axiom;   /* Clause_p or WFormula_p */
+   long      sym_no;
+   FunCode*  symbols;
+   bool      touched;
+}SineAxiomCell, *SineAxiom_p;
+
+
+/* Persistent index over a stack of clause and formula sets for one
+ * generality measure. Sets contribute their clauses and formulas in
+ * order, so that a D-Relation extracted from the index is the same
+ * as one computed from the sets directly. Sets can be pushed and
+ * popped, and only axioms sharing a symbol with the pushed or popped
+ * sets (i.e. those symbols whose generality changes) are reordered.
+ * The owner has to keep the distribution in sync with the sets. */
+
+typedef struct sine_index_cell
+{
+   GenDistrib_p      generality;
+   GeneralityMeasure gentype;
+   PStack_p          axioms;      /* Of SineAxiom_p */
+   PStack_p          set_starts;  /* Position of first axiom of each set */
+   PDArray_p         occurrences; /* FunCode -> PStack_p of SineAxiom_p */
+}SineIndexCell, *SineIndex_p;
+
+
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
 /*---------------------------------------------------------------------*/
@@ -123,6 +156,24 @@ void DRelationAddFormulaSets(DRelation_p drel,
                              long generosity,
                              PStack_p sets);
 
+#define SineAxiomCellAlloc()    (SineAxiomCell*)SizeMalloc(sizeof(SineAxiomCell))
+#define SineAxiomCellFree(junk) SizeFree(junk, sizeof(SineAxiomCell))
+
+#define SineIndexCellAlloc()    (SineIndexCell*)SizeMalloc(sizeof(SineIndexCell))
+#define SineIndexCellFree(junk) SizeFree(junk, sizeof(SineIndexCell))
+
+SineIndex_p SineIndexAlloc(GenDistrib_p generality,
+                           GeneralityMeasure gentype);
+void        SineIndexFree(SineIndex_p index);
+#define     SineIndexSets(index) PStackGetSP((index)->set_starts)
+void        SineIndexPushSets(SineIndex_p index,
+                              PStack_p clause_sets,
+                              PStack_p formula_sets);
+void        SineIndexPopSets(SineIndex_p index, PStackPointer sp);
+DRelation_p SineIndexDRelation(SineIndex_p index,
+                               double benevolence,
+                               long generosity);
+
 void PQueueStoreClause(PQueue_p axioms, Clause_p clause);
 void PQueueStoreFormula(PQueue_p axioms, WFormula_p form);
 
@@ -150,6 +201,14 @@ long SelectAxioms(GenDistrib_p      f_distrib,
                   PStack_p          res_clauses,
                   PStack_p          res_formulas);
 
+long SelectAxiomsIndexed(SineIndex_p       index,
+                         PStack_p          clause_sets,
+                         PStack_p          formula_sets,
+                         PStackPointer     seed_start,
+                         AxFilter_p        ax_filter,
+                         PStack_p          res_clauses,
+                         PStack_p          res_formulas);
+
 long SelectThreshold(PStack_p          clause_sets,
                      PStack_p          formula_sets,
                      AxFilter_p        ax_filter,
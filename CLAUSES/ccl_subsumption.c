@@ -357,8 +357,8 @@ static Eqn_p find_spec_literal(Eqn_p lit, Eqn_p list)
 //
 // Function: check_subsumption_possibility()
 //
-//   Return true if each literal in subsumer is more general than a
-//   literal in sub_candidate.
+//   Return true if each literal in the literal list subsumer is more
+//   general than a literal in sub_candidate.
 //
 // Global Variables: -
 //
@@ -366,13 +366,13 @@ static Eqn_p find_spec_literal(Eqn_p lit, Eqn_p list)
 //
 /----------------------------------------------------------------------*/
 
-static bool check_subsumption_possibility(Clause_p subsumer, Clause_p
+static bool check_subsumption_possibility(Eqn_p subsumer, Clause_p
                                           sub_candidate)
 {
    bool    res = true;
    Eqn_p   sub_eqn;
 
-   for(sub_eqn = subsumer->literals; sub_eqn; sub_eqn = sub_eqn->next)
+   for(sub_eqn = subsumer; sub_eqn; sub_eqn = sub_eqn->next)
    {
       if(!find_spec_literal(sub_eqn, sub_candidate->literals))
       {
@@ -582,10 +582,12 @@ bool eqn_list_rec_subsume(Eqn_p subsum_list, Eqn_p sub_cand_list,
 
 /*-----------------------------------------------------------------------
 //
-// Function: clause_subsumes_clause()
+// Function: eqn_list_subsumes_clause()
 //
-//   Return true if subsumer subsumes sub_candidate. Assumes that
-//   weights are precomputed.
+//   Return true if the clause with the literals subsumer (with the
+//   given number of positive and negative literals and standard
+//   weight) subsumes sub_candidate. The literals of subsumer need not
+//   be in subsumption order.
 //
 // Global Variables: -
 //
@@ -593,8 +595,9 @@ bool eqn_list_rec_subsume(Eqn_p subsum_list, Eqn_p sub_cand_list,
 //
 /----------------------------------------------------------------------*/
 
-static bool clause_subsumes_clause(Clause_p subsumer, Clause_p
-                                   sub_candidate)
+static bool eqn_list_subsumes_clause(Eqn_p subsumer, int pos_lit_no,
+                                     int neg_lit_no, double weight,
+                                     Clause_p sub_candidate)
 {
    Subst_p subst;
    bool    res;
@@ -602,48 +605,30 @@ static bool clause_subsumes_clause(Clause_p subsumer, Clause_p
 
    PERF_CTR_ENTRY(SubsumeTimer);
 
-   /* if(!ClauseIsSubsumeOrdered(sub_candidate)) */
-   /* { */
-   /*    printf("# sub_candidate %p: ", sub_candidate->set);ClausePrint(stdout, sub_candidate, true); */
-   /*    printf("\n# subsumer     %p: ", subsumer->set);ClausePrint(stdout, subsumer, true); */
-   /*    printf("\n"); */
-
-   /*    printf("# %ld, %ld\n", EqnStandardWeight(sub_candidate->literals),EqnStandardWeight(sub_candidate->literals->next)); */
-   /*    printf("# EqnSubsumeInverseCompareRef()=%d\n", EqnSubsumeInverseCompareRef(&(sub_candidate->literals), &(sub_candidate->literals->next))); */
-   /*    printf("# EqnSubsumeQOrderCompare()=%d\n", EqnSubsumeQOrderCompare(sub_candidate->literals, sub_candidate->literals->next)); */
-   /*    ClauseSubsumeOrderSortLits(sub_candidate); */
-   /*    printf("# sub_candidate %p: ", sub_candidate->set);ClausePrint(stdout, sub_candidate, true); */
-   /*    printf("\n"); */
-   /* } */
-   assert(ClauseIsSubsumeOrdered(subsumer));
    assert(ClauseIsSubsumeOrdered(sub_candidate));
 
-   if(ClauseLiteralNumber(subsumer)==0)
+   if(pos_lit_no+neg_lit_no==0)
    {
       PERF_CTR_EXIT(SubsumeTimer);
       return true;
    }
-   if(ClauseLiteralNumber(subsumer)==1)
+   if(pos_lit_no+neg_lit_no==1)
    {
       PERF_CTR_EXIT(SubsumeTimer);
-      return UnitClauseSubsumesClause(subsumer, sub_candidate);
+      UnitClauseClauseSubsumptionCalls++;
+      return LiteralSubsumesClause(subsumer, sub_candidate);
    }
-   //printf("# sub_candidate %p: ", sub_candidate->set);ClausePrint(stdout, sub_candidate, true);
-   //printf("\n# subsumer     %p: ", subsumer->set);ClausePrint(stdout, subsumer, true);
-   //printf("\n");
-
    assert(sub_candidate->weight == ClauseStandardWeight(sub_candidate));
-   assert(subsumer->weight == ClauseStandardWeight(subsumer));
 
    ClauseClauseSubsumptionCalls++;
 
-   if((subsumer->pos_lit_no > sub_candidate->pos_lit_no) ||
-      (subsumer->neg_lit_no > sub_candidate->neg_lit_no))
+   if((pos_lit_no > sub_candidate->pos_lit_no) ||
+      (neg_lit_no > sub_candidate->neg_lit_no))
    {
       PERF_CTR_EXIT(SubsumeTimer);
       return false;
    }
-   if(subsumer->weight > sub_candidate->weight)
+   if(weight > sub_candidate->weight)
    {
       PERF_CTR_EXIT(SubsumeTimer);
       return false;
@@ -660,8 +645,7 @@ static bool clause_subsumes_clause(Clause_p subsumer, Clause_p
 
    pick_list = IntArrayAlloc(ClauseLiteralNumber(sub_candidate));
 
-   res = eqn_list_rec_subsume(subsumer->literals,
-                              sub_candidate->literals, subst,
+   res = eqn_list_rec_subsume(subsumer, sub_candidate->literals, subst,
                               pick_list);
    IntArrayFree(pick_list, ClauseLiteralNumber(sub_candidate));
 
@@ -676,6 +660,33 @@ static bool clause_subsumes_clause(Clause_p subsumer, Clause_p
    return res;
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: clause_subsumes_clause()
+//
+//   Return true if subsumer subsumes sub_candidate. Assumes that
+//   weights are precomputed.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool clause_subsumes_clause(Clause_p subsumer, Clause_p
+                                   sub_candidate)
+{
+   assert(ClauseIsSubsumeOrdered(subsumer));
+   assert(subsumer->weight == ClauseStandardWeight(subsumer));
+
+   return eqn_list_subsumes_clause(subsumer->literals,
+                                   subsumer->pos_lit_no,
+                                   subsumer->neg_lit_no,
+                                   subsumer->weight,
+                                   sub_candidate);
+}
+
 /*-----------------------------------------------------------------------
 //
 // Function: clause_set_subsumes_clause()
@@ -1395,6 +1406,44 @@ bool ClauseSubsumesClause(Clause_p subsumer, Clause_p sub_candidate)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: EqnListSubsumesClause()
+//
+//   Return true if the clause with the literals in list subsumes
+//   sub_candidate (which needs a correct weight). This gives the same
+//   result as ClauseSubsumesClause() on a clause made from list,
+//   without having to create (and subsumption-order) that clause.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool EqnListSubsumesClause(Eqn_p list, Clause_p sub_candidate)
+{
+   Eqn_p  handle;
+   int    pos_lit_no = 0, neg_lit_no = 0;
+   double weight = 0;
+
+   for(handle = list; handle; handle = handle->next)
+   {
+      if(EqnIsPositive(handle))
+      {
+         pos_lit_no++;
+      }
+      else
+      {
+         neg_lit_no++;
+      }
+      weight += EqnStandardWeight(handle);
+   }
+   return eqn_list_subsumes_clause(list, pos_lit_no, neg_lit_no, weight,
+                                   sub_candidate);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseSetSubsumesFVPackedClause()
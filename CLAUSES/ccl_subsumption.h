@@ -61,6 +61,7 @@ Clause_p ClauseSetFindUnitSubsumedClause(ClauseSet_p set, Clause_p
 
 bool     ClauseSubsumesClause(Clause_p subsumer, Clause_p
                               sub_candidate);
+bool     EqnListSubsumesClause(Eqn_p list, Clause_p sub_candidate);
 Clause_p ClauseSetSubsumesFVPackedClause(ClauseSet_p set,
                                          FVPackedClause_p sub_candidate);
 Clause_p ClauseSetSubsumesClause(ClauseSet_p set, Clause_p
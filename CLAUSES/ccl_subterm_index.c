@@ -163,6 +163,40 @@ static void subterm_index_delete_set(SubtermIndex_p index,
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: clause_collect_lit_terms()
+//
+//   Collect all non-variable top-level literal terms (i.e. the two
+//   sides of every literal) of clause into terms. Return number of
+//   new terms.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long clause_collect_lit_terms(Clause_p clause, PTree_p *terms)
+{
+   long  res = 0;
+   Eqn_p handle;
+
+   for(handle = clause->literals; handle; handle = handle->next)
+   {
+      if(!TermIsVar(handle->lterm) && PTreeStore(terms, handle->lterm))
+      {
+         res++;
+      }
+      if(!TermIsVar(handle->rterm) && PTreeStore(terms, handle->rterm))
+      {
+         res++;
+      }
+   }
+   return res;
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -314,6 +348,52 @@ void SubtermIndexDeleteClause(SubtermIndex_p index, Clause_p clause)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: SubtermIndexInsertLitTerms()
+//
+//   Insert the top-level literal terms of clause into the index. This
+//   is used to find candidates for backward unit simplify-reflect,
+//   which only ever applies at the top of a literal.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SubtermIndexInsertLitTerms(SubtermIndex_p index, Clause_p clause)
+{
+   PTree_p terms = NULL;
+
+   clause_collect_lit_terms(clause, &terms);
+   subterm_index_insert_set(index, clause, terms, false);
+   PTreeFree(terms);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SubtermIndexDeleteLitTerms()
+//
+//   Delete the top-level literal terms of clause from the index.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void SubtermIndexDeleteLitTerms(SubtermIndex_p index, Clause_p clause)
+{
+   PTree_p terms = NULL;
+
+   clause_collect_lit_terms(clause, &terms);
+   subterm_index_delete_set(index, clause, terms, false);
+   PTreeFree(terms);
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
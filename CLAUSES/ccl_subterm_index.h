@@ -54,6 +54,9 @@ long ClauseCollectIdxSubterms(Clause_p clause,
 void SubtermIndexInsertClause(SubtermIndex_p index, Clause_p clause);
 void SubtermIndexDeleteClause(SubtermIndex_p index, Clause_p clause);
 
+void SubtermIndexInsertLitTerms(SubtermIndex_p index, Clause_p clause);
+void SubtermIndexDeleteLitTerms(SubtermIndex_p index, Clause_p clause);
+
 #endif
 
 /*---------------------------------------------------------------------*/
@@ -48,6 +48,57 @@ char* UnitSimplifyNames[]=
 /*---------------------------------------------------------------------*/
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: occ_tree_collect_clauses()
+//
+//   Collect all clauses from set recorded in the subterm trees on
+//   termtrees for which the associated term is an instance of
+//   query into candidates.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void occ_tree_collect_clauses(PStack_p termtrees, ClauseSet_p set,
+                                     Term_p query, PTree_p *candidates)
+{
+   Subst_p       subst = SubstAlloc();
+   PStack_p      iterstack, clausestack;
+   SubtermTree_p cell;
+   SubtermOcc_p  occ;
+   PTree_p       clausecell;
+   Clause_p      clause;
+
+   while(!PStackEmpty(termtrees))
+   {
+      iterstack = PTreeTraverseInit(PStackPopP(termtrees));
+      while((cell = PTreeTraverseNext(iterstack)))
+      {
+         occ = cell->key;
+         if(SubstComputeMatch(query, occ->term, subst))
+         {
+            clausestack = PTreeTraverseInit(occ->pl.occs.rw_full);
+            while((clausecell = PTreeTraverseNext(clausestack)))
+            {
+               clause = clausecell->key;
+               if(clause->set == set)
+               {
+                  PTreeStore(candidates, clause);
+               }
+            }
+            PTreeTraverseExit(clausestack);
+         }
+         SubstBacktrack(subst);
+      }
+      PTreeTraverseExit(iterstack);
+   }
+   SubstDelete(subst);
+}
+
+
 
 
 
@@ -279,6 +330,84 @@ bool ClauseSimplifyWithUnitSet(Clause_p clause, ClauseSet_p unit_set,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: UnitSRIndexQueryable()
+//
+//   Return true if the unit clause simplifier can be used for an
+//   indexed search of simplify-reflect candidates, i.e. if at least
+//   one side of its literal is not a variable.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+bool UnitSRIndexQueryable(Clause_p simplifier)
+{
+   assert(ClauseIsUnit(simplifier));
+
+   return !(TermIsVar(simplifier->literals->lterm)&&
+            TermIsVar(simplifier->literals->rterm));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: UnitSRIndexFindSimplifiable()
+//
+//   Find all clauses from set that can be simplified by a
+//   top-simplify-reflect step with the unit clause simplifier, using
+//   an index of top-level literal terms. Since a literal s=t
+//   subsumed by l=r must have a side that is an instance of l (and
+//   one that is an instance of r), a single query with a non-variable
+//   side suffices. Push the clauses found onto res and return their
+//   number.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long UnitSRIndexFindSimplifiable(SubtermIndex_p index,
+                                 ClauseSet_p set,
+                                 Clause_p simplifier,
+                                 PStack_p res)
+{
+   Eqn_p    eqn = simplifier->literals;
+   Term_p   query;
+   PStack_p termtrees = PStackAlloc();
+   PStack_p iterstack;
+   PTree_p  candidates = NULL, cell;
+   Clause_p clause;
+   long     count = 0;
+
+   assert(UnitSRIndexQueryable(simplifier));
+
+   query = TermIsVar(eqn->lterm)?eqn->rterm:eqn->lterm;
+   FPIndexFindMatchable(index, query, termtrees);
+   occ_tree_collect_clauses(termtrees, set, query, &candidates);
+   PStackFree(termtrees);
+
+   iterstack = PTreeTraverseInit(candidates);
+   while((cell = PTreeTraverseNext(iterstack)))
+   {
+      clause = cell->key;
+      if(ClauseUnitSimplifyTest(clause, simplifier))
+      {
+         PStackPushP(res, clause);
+         count++;
+      }
+   }
+   PTreeTraverseExit(iterstack);
+   PTreeFree(candidates);
+
+   return count;
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
@@ -28,6 +28,7 @@ Changes
 #define CCL_UNIT_SIMPLIFY
 
 #include <ccl_clausefunc.h>
+#include <ccl_subterm_index.h>
 
 
 /*---------------------------------------------------------------------*/
@@ -61,6 +62,12 @@ ClausePos_p FindSimplifyingUnit(ClauseSet_p set, Term_p t1,
 bool        ClauseSimplifyWithUnitSet(Clause_p clause, ClauseSet_p
                                       unit_set, UnitSimplifyType how);
 
+bool        UnitSRIndexQueryable(Clause_p simplifier);
+long        UnitSRIndexFindSimplifiable(SubtermIndex_p index,
+                                        ClauseSet_p set,
+                                        Clause_p simplifier,
+                                        PStack_p res);
+
 #endif
 
 /*---------------------------------------------------------------------*/
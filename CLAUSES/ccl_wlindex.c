@@ -0,0 +1,558 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_wlindex.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Writing and loading compiled watchlists. See the header file for
+  a description.
+
+  Layout (all numbers in the encoding of ccl_problemcache.c):
+
+    Magic, version
+    Sorts:   <n> <name>*
+    Symbols: <n> (<name> <arity> <props> <type>)*, where <type> is -1
+             (untyped) or <arity> <domain sort> <arg sort>*
+    Terms:   <n> <term>*, where a <term> is either a negative variable
+             code and a sort, or a symbol and the positions of the
+             argument terms
+    Clauses: <n> (<props> <lit no> (<props> <lterm> <rterm>)* <info>)*
+
+  Symbols and sorts are identified by name, so a compiled watchlist
+  can be used with any problem with a compatible signature.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 00:21:35 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "ccl_wlindex.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* Symbol properties established by the parser (and not by the
+   type system or later processing). */
+#define WL_SYMBOL_PROPS (FPDistinctProp|FPInterpreted)
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: wl_write_signature()
+//
+//   Write the sort table and all symbols of sig (with types).
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void wl_write_signature(FILE* out, Sig_p sig)
+{
+   SortTable_p sorts = sig->sort_table;
+   FunCode     f;
+   Type_p      type;
+   int         i;
+
+   SnapWriteLong(out, PStackGetSP(sorts->back_index));
+   for(i=0; i<PStackGetSP(sorts->back_index); i++)
+   {
+      SnapWriteStr(out, PStackElementP(sorts->back_index, i));
+   }
+   SnapWriteLong(out, sig->f_count);
+   for(f=1; f<=sig->f_count; f++)
+   {
+      SnapWriteStr(out, sig->f_info[f].name);
+      SnapWriteLong(out, sig->f_info[f].arity);
+      SnapWriteLong(out, sig->f_info[f].properties&WL_SYMBOL_PROPS);
+      type = sig->f_info[f].type;
+      if(!type)
+      {
+         SnapWriteLong(out, -1);
+         continue;
+      }
+      SnapWriteLong(out, type->arity);
+      SnapWriteLong(out, type->domain_sort);
+      for(i=0; i<type->arity; i++)
+      {
+         SnapWriteLong(out, type->args[i]);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: wl_read_signature()
+//
+//   Read the sort table and symbols of a compiled watchlist and map
+//   them into sig. New symbols are added (with their types), for
+//   existing ones the arity has to match. Returns the symbol map
+//   (indexed by stored symbol, to be freed with FREE()) and the sort
+//   map (same).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes sig and its sort and type tables.
+//
+/----------------------------------------------------------------------*/
+
+static void wl_read_signature(SnapReader_p in, Sig_p sig,
+                              FunCode **fmap, long *f_no,
+                              SortType **smap, long *s_no)
+{
+   long     i, j, arity, type_arity;
+   FunCode  f;
+   char     *name;
+   SortType domain, *args;
+   Type_p   type;
+   FunctionProperties props;
+
+   *s_no = SnapReadLong(in);
+   if(*s_no < 0 || *s_no > in->size)
+   {
+      Error("%s: Compiled watchlist is corrupted", FILE_ERROR, in->name);
+   }
+   *smap = SecureMalloc(MAX(*s_no,1)*sizeof(SortType));
+   for(i=0; i<*s_no; i++)
+   {
+      name = SnapReadStr(in);
+      (*smap)[i] = name?SortTableInsert(sig->sort_table, name):STNoSort;
+   }
+
+   *f_no = SnapReadLong(in);
+   if(*f_no < 0 || *f_no > in->size)
+   {
+      Error("%s: Compiled watchlist is corrupted", FILE_ERROR, in->name);
+   }
+   *fmap = SecureMalloc((*f_no+1)*sizeof(FunCode));
+   (*fmap)[0] = 0;
+   for(i=1; i<=*f_no; i++)
+   {
+      name  = SnapReadStr(in);
+      arity = SnapReadLong(in);
+      props = SnapReadLong(in);
+      if(!name || arity < 0)
+      {
+         Error("%s: Compiled watchlist is corrupted", FILE_ERROR, in->name);
+      }
+      f = SigFindFCode(sig, name);
+      if(!f)
+      {
+         f = SigInsertId(sig, name, arity, false);
+         SigSetFuncProp(sig, f, props&WL_SYMBOL_PROPS);
+      }
+      else if(SigFindArity(sig, f)!=arity)
+      {
+         Error("%s: Arity of %s does not match the problem", FILE_ERROR,
+               in->name, name);
+      }
+      (*fmap)[i] = f;
+
+      type_arity = SnapReadLong(in);
+      if(type_arity < 0)
+      {
+         continue;
+      }
+      domain = (*smap)[SnapReadIndex(in, *s_no)];
+      args = NULL;
+      if(type_arity)
+      {
+         args = TypeArgumentAlloc(type_arity);
+         for(j=0; j<type_arity; j++)
+         {
+            args[j] = (*smap)[SnapReadIndex(in, *s_no)];
+         }
+      }
+      if(!SigGetType(sig, f))
+      {
+         type = type_arity?
+            TypeNewFunction(sig->type_table, domain, type_arity, args):
+            TypeNewConstant(sig->type_table, domain);
+         SigDeclareType(sig, f, type);
+      }
+      if(args)
+      {
+         TypeArgumentFree(args, type_arity);
+      }
+   }
+   sig->alpha_ranks_valid = false;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: wl_write_term()
+//
+//   Write term and all of its (not yet written) subterms, arguments
+//   first. Return the position of the term in the term table. shared
+//   maps entry numbers and vars maps (negated) variable codes to
+//   positions+1, var_terms remembers which variable (of possibly
+//   several sorts) is at that position.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long wl_write_term(FILE* out, Term_p term, PDArray_p shared,
+                          PDArray_p vars, PDArray_p var_terms,
+                          long *count)
+{
+   long  idx, *args;
+   int   i;
+
+   if(TermIsVar(term))
+   {
+      idx = PDArrayElementInt(vars, -term->f_code);
+      if(idx && PDArrayElementP(var_terms, -term->f_code) == term)
+      {
+         return idx-1;
+      }
+      SnapWriteLong(out, term->f_code);
+      SnapWriteLong(out, term->sort);
+      PDArrayAssignInt(vars, -term->f_code, *count+1);
+      PDArrayAssignP(var_terms, -term->f_code, term);
+      return (*count)++;
+   }
+   assert(TermIsShared(term));
+   idx = PDArrayElementInt(shared, term->entry_no);
+   if(idx)
+   {
+      return idx-1;
+   }
+   args = NULL;
+   if(term->arity)
+   {
+      args = SizeMalloc(term->arity*sizeof(long));
+      for(i=0; i<term->arity; i++)
+      {
+         args[i] = wl_write_term(out, term->args[i], shared,
+                                 vars, var_terms, count);
+      }
+   }
+   SnapWriteLong(out, term->f_code);
+   for(i=0; i<term->arity; i++)
+   {
+      SnapWriteLong(out, args[i]);
+   }
+   if(args)
+   {
+      SizeFree(args, term->arity*sizeof(long));
+   }
+   PDArrayAssignInt(shared, term->entry_no, *count+1);
+   return (*count)++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: wl_read_term()
+//
+//   Read one term record and insert the term into the bank. All
+//   arguments are already in table. Sorts of non-variable terms are
+//   inferred from the (mapped) symbol types on insertion.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the term bank
+//
+/----------------------------------------------------------------------*/
+
+static Term_p wl_read_term(SnapReader_p in, TB_p bank,
+                           FunCode *fmap, long f_no,
+                           SortType *smap, long s_no,
+                           Term_p *table, long count)
+{
+   long    code = SnapReadLong(in);
+   int     i;
+   Term_p  t;
+
+   if(code < 0)
+   {
+      bank->vars->v_count = MAX(bank->vars->v_count, -code);
+      return VarBankVarAssertAlloc(bank->vars, code,
+                                   smap[SnapReadIndex(in, s_no)]);
+   }
+   if(code == 0 || code > f_no)
+   {
+      Error("%s: Compiled watchlist is corrupted", FILE_ERROR, in->name);
+   }
+   t = TermTopAlloc(fmap[code], SigFindArity(bank->sig, fmap[code]));
+   for(i=0; i<t->arity; i++)
+   {
+      t->args[i] = table[SnapReadIndex(in, count)];
+   }
+   return TBTermTopInsert(bank, t);
+}
+
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: WLIndexFileIsIndex()
+//
+//   Return true if the named file is a compiled watchlist, false if
+//   it is not (or cannot be read).
+//
+// Global Variables: -
+//
+// Side Effects    : Input
+//
+/----------------------------------------------------------------------*/
+
+bool WLIndexFileIsIndex(char* name)
+{
+   FILE* file = fopen(name, "r");
+   char  buffer[sizeof(WL_INDEX_MAGIC)];
+   long  magic_len = strlen(WL_INDEX_MAGIC);
+   bool  res;
+
+   if(!file)
+   {
+      return false;
+   }
+   res = ((long)fread(buffer, 1, magic_len, file) == magic_len) &&
+      (memcmp(buffer, WL_INDEX_MAGIC, magic_len)==0);
+   fclose(file);
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WLIndexStore()
+//
+//   Write the (freshly parsed) clauses of set, which live in bank,
+//   as a compiled watchlist to the named file. Return true on
+//   success.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+bool WLIndexStore(char* name, ClauseSet_p set, TB_p bank)
+{
+   FILE*      out;
+   PDArray_p  shared, vars, var_terms;
+   long       count, count_pos, end_pos, lit_no;
+   Clause_p   clause;
+   Eqn_p      lit;
+   bool       failed;
+
+   out = fopen(name, "w");
+   if(!out)
+   {
+      TmpErrno = errno;
+      SysWarning("Cannot write compiled watchlist %s", name);
+      return false;
+   }
+   fputs(WL_INDEX_MAGIC, out);
+   SnapWriteLong(out, WL_INDEX_VERSION);
+   wl_write_signature(out, bank->sig);
+
+   /* Terms are written in the order they are discovered, with the
+      final count patched in afterwards. */
+   shared    = PDIntArrayAlloc(TBNonVarTermNodes(bank)+1, 0);
+   vars      = PDIntArrayAlloc(64, 0);
+   var_terms = PDArrayAlloc(64, 0);
+   count     = 0;
+   count_pos = ftell(out);
+   SnapWriteFixed(out, 0);
+   for(clause = set->anchor->succ; clause!=set->anchor;
+       clause = clause->succ)
+   {
+      for(lit = clause->literals; lit; lit = lit->next)
+      {
+         wl_write_term(out, lit->lterm, shared, vars, var_terms, &count);
+         wl_write_term(out, lit->rterm, shared, vars, var_terms, &count);
+      }
+   }
+   end_pos = ftell(out);
+   fseek(out, count_pos, SEEK_SET);
+   SnapWriteFixed(out, count);
+   fseek(out, end_pos, SEEK_SET);
+
+   /* All terms are known now, so the lookups below just return the
+      positions. */
+   SnapWriteLong(out, set->members);
+   for(clause = set->anchor->succ; clause!=set->anchor;
+       clause = clause->succ)
+   {
+      SnapWriteLong(out, clause->properties);
+      lit_no = ClauseLiteralNumber(clause);
+      SnapWriteLong(out, lit_no);
+      for(lit = clause->literals; lit; lit = lit->next)
+      {
+         SnapWriteLong(out, lit->properties);
+         SnapWriteLong(out, wl_write_term(out, lit->lterm, shared,
+                                          vars, var_terms, &count));
+         SnapWriteLong(out, wl_write_term(out, lit->rterm, shared,
+                                          vars, var_terms, &count));
+      }
+      if(clause->info)
+      {
+         SnapWriteLong(out, 1);
+         SnapWriteStr(out, clause->info->name);
+         SnapWriteStr(out, clause->info->source);
+         SnapWriteLong(out, clause->info->line);
+         SnapWriteLong(out, clause->info->column);
+      }
+      else
+      {
+         SnapWriteLong(out, 0);
+      }
+   }
+   PDArrayFree(shared);
+   PDArrayFree(vars);
+   PDArrayFree(var_terms);
+
+   failed = ferror(out);
+   if(fclose(out)!=0)
+   {
+      failed = true;
+   }
+   if(failed)
+   {
+      TmpErrno = errno;
+      SysWarning("Cannot write compiled watchlist %s", name);
+      return false;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WLIndexLoad()
+//
+//   Load the compiled watchlist in the named file into set, with
+//   terms in bank. Return the number of clauses read. Terminates
+//   with an error if the file cannot be read or is corrupted.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, changes bank, signature and set.
+//
+/----------------------------------------------------------------------*/
+
+long WLIndexLoad(char* name, ClauseSet_p set, TB_p bank)
+{
+   SnapReaderCell in;
+   long           i, j, count, lit_no, f_no, s_no, clause_no;
+   long           line, column;
+   FunCode        *fmap;
+   SortType       *smap;
+   Term_p         *table;
+   Clause_p       clause;
+   Eqn_p          lits, lit;
+   FormulaProperties props;
+   EqnProperties  lit_props;
+   Term_p         lterm, rterm;
+   char           *c_name, *source;
+   long           magic_len = strlen(WL_INDEX_MAGIC);
+
+   if(!SnapReaderOpen(&in, name, true))
+   {
+      TmpErrno = errno;
+      SysError("Cannot read compiled watchlist %s", FILE_ERROR, name);
+   }
+   if(in.size < magic_len ||
+      memcmp(in.buffer, WL_INDEX_MAGIC, magic_len)!=0)
+   {
+      Error("%s: Not a compiled watchlist", FILE_ERROR, name);
+   }
+   in.pos += magic_len;
+   if(SnapReadLong(&in) != WL_INDEX_VERSION)
+   {
+      Error("%s: Compiled watchlist has the wrong version, recompile it",
+            FILE_ERROR, name);
+   }
+   wl_read_signature(&in, bank->sig, &fmap, &f_no, &smap, &s_no);
+
+   count = SnapReadFixed(&in);
+   if(count < 0 || count > in.size)
+   {
+      Error("%s: Compiled watchlist is corrupted", FILE_ERROR, name);
+   }
+   table = SecureMalloc(MAX(count,1)*sizeof(Term_p));
+   for(i=0; i<count; i++)
+   {
+      table[i] = wl_read_term(&in, bank, fmap, f_no, smap, s_no,
+                              table, i);
+   }
+
+   clause_no = SnapReadLong(&in);
+   for(i=0; i<clause_no; i++)
+   {
+      props  = SnapReadLong(&in);
+      lit_no = SnapReadLong(&in);
+      lits   = NULL;
+      for(j=0; j<lit_no; j++)
+      {
+         lit_props = SnapReadLong(&in);
+         lterm = table[SnapReadIndex(&in, count)];
+         rterm = table[SnapReadIndex(&in, count)];
+         lit = EqnAlloc(lterm, rterm, bank,
+                        lit_props & EPIsPositive);
+         lit->properties = lit_props;
+         EqnListAppend(&lits, lit);
+      }
+      clause = ClauseAlloc(lits);
+      clause->properties = props;
+      if(SnapReadLong(&in))
+      {
+         c_name = SnapReadStr(&in);
+         source = SnapReadStr(&in);
+         line   = SnapReadLong(&in);
+         column = SnapReadLong(&in);
+         clause->info = ClauseInfoAlloc(c_name, source, line, column);
+      }
+      ClauseSetInsert(set, clause);
+   }
+   if(in.pos != in.size)
+   {
+      Error("%s: Compiled watchlist is corrupted", FILE_ERROR, name);
+   }
+   FREE(table);
+   FREE(fmap);
+   FREE(smap);
+   SnapReaderClose(&in);
+
+   return clause_no;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
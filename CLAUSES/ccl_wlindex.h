@@ -0,0 +1,67 @@
+/*-----------------------------------------------------------------------
+
+File  : ccl_wlindex.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Compiled watchlists. Large watchlists (e.g. lemmas extracted from
+  many earlier proofs) are parsed once by e_wlcompile and stored in
+  the binary encoding of the problem cache (see ccl_problemcache.h):
+  A symbol and sort table, the term DAG of all clauses (each term
+  stored once, in topological order, referring to its arguments by
+  position), and the clauses.
+
+  Loading maps the file read-only into memory (so that the page
+  cache is shared by all concurrent provers using the same
+  watchlist), maps each symbol into the signature once, and inserts
+  each stored term once into the term bank. No scanning, symbol
+  lookup by name for each occurrence, or term parsing is
+  necessary. Feature vectors and maximality depend on the ordering
+  and the feature vector index of the run, and are computed when
+  the watchlist is indexed, as for parsed watchlists.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 00:21:35 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef CCL_WLINDEX
+
+#define CCL_WLINDEX
+
+#include <ccl_problemcache.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Bump this whenever the layout of a compiled watchlist changes. */
+
+#define WL_INDEX_MAGIC   "EWLIX"
+#define WL_INDEX_VERSION 1
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+bool WLIndexFileIsIndex(char* name);
+bool WLIndexStore(char* name, ClauseSet_p set, TB_p bank);
+long WLIndexLoad(char* name, ClauseSet_p set, TB_p bank);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
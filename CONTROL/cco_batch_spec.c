@@ -18,6 +18,8 @@ Changes
 
 <1> Tue Jun 29 04:41:18 CEST 2010
     New
+<2> Mon Oct 19 17:21:05 CEST 2026
+    Use and maintain persistent SinE indices
 
 -----------------------------------------------------------------------*/
 
@@ -62,11 +64,13 @@ char* BatchFilters[] =
 //
 // Function: do_proof()
 //
-//   Re-run e as eproof and return the result.
+//   Re-run E with a binary inference log and return the proof
+//   extracted from the log.
 //
-// Global Variables:
+// Global Variables: -
 //
-// Side Effects    :
+// Side Effects    : Runs subprocesses, creates and removes a
+//                   temporary file.
 //
 /----------------------------------------------------------------------*/
 
@@ -75,7 +79,7 @@ void do_proof(DStr_p res, char *exec, char *pexec,
 {
    DStr_p         cmd = DStrAlloc();
    char           line[180];
-   char           *l;
+   char           *l, *log_name = TempFileName();
    FILE           *fp;
 
    DStrAppendStr(cmd, exec);
@@ -84,11 +88,14 @@ void do_proof(DStr_p res, char *exec, char *pexec,
    DStrAppendStr(cmd, " ");
    DStrAppendStr(cmd, E_OPTIONS);
    DStrAppendInt(cmd, cpu_limit);
-   DStrAppendStr(cmd, " -l4 ");
+   DStrAppendStr(cmd, " --derivation-log=");
+   DStrAppendStr(cmd, log_name);
+   DStrAppendStr(cmd, " ");
    DStrAppendStr(cmd, file);
-   DStrAppendStr(cmd, "|");
+   DStrAppendStr(cmd, " >/dev/null;");
    DStrAppendStr(cmd, pexec);
-   DStrAppendStr(cmd, " -f --competition-framing --tstp-out ");
+   DStrAppendStr(cmd, " -b --competition-framing ");
+   DStrAppendStr(cmd, log_name);
 
    /* fprintf(GlobalOut, "# Running %s\n", DStrView(cmd)); */
    fp = popen(DStrView(cmd), "r");
@@ -102,6 +109,8 @@ void do_proof(DStr_p res, char *exec, char *pexec,
       DStrAppendStr(res, l);
    }
    pclose(fp);
+   TempFileRemove(log_name);
+   FREE(log_name);
    DStrFree(cmd);
 }
 
@@ -486,7 +495,7 @@ long BatchStructFOFSpecInit(BatchSpec_p spec, StructFOFSpec_p ctrl)
 //
 //   Add a problem as one set of clauses and formulas, each. Note that
 //   this transfers the two sets into ctrl, which is responsible for
-//   freeing.
+//   freeing. Existing SinE indices are updated.
 //
 // Global Variables: -
 //
@@ -498,12 +507,21 @@ void StructFOFSpecAddProblem(StructFOFSpec_p ctrl,
                             ClauseSet_p clauses,
                             FormulaSet_p formulas)
 {
+   PStackPointer i;
+
    GenDistribSizeAdjust(ctrl->f_distrib, ctrl->sig);
    PStackPushP(ctrl->clause_sets, clauses);
    PStackPushP(ctrl->formula_sets, formulas);
 
    GenDistribAddClauseSet(ctrl->f_distrib, clauses, 1);
    GenDistribAddFormulaSet(ctrl->f_distrib, formulas, 1);
+
+   for(i=0; i<PStackGetSP(ctrl->sine_indices); i++)
+   {
+      SineIndexPushSets(PStackElementP(ctrl->sine_indices, i),
+                        ctrl->clause_sets,
+                        ctrl->formula_sets);
+   }
 }
 
 
@@ -512,7 +530,8 @@ void StructFOFSpecAddProblem(StructFOFSpec_p ctrl,
 // Function: StructFOFSpecBacktrackToSpec()
 //
 //   Backtrack the state to the spec state, i.e. backtrack the
-//   frequency count and free the extra clause sets.
+//   frequency count and the SinE indices and free the extra clause
+//   sets.
 //
 // Global Variables: -
 //
@@ -524,6 +543,7 @@ void StructFOFSpecBacktrackToSpec(StructFOFSpec_p ctrl)
 {
    ClauseSet_p clauses;
    FormulaSet_p formulas;
+   PStackPointer i;
 
    GenDistribBacktrackClauseSets(ctrl->f_distrib,
                                  ctrl->clause_sets,
@@ -531,6 +551,11 @@ void StructFOFSpecBacktrackToSpec(StructFOFSpec_p ctrl)
    GenDistribBacktrackFormulaSets(ctrl->f_distrib,
                                   ctrl->formula_sets,
                                   ctrl->shared_ax_sp);
+   for(i=0; i<PStackGetSP(ctrl->sine_indices); i++)
+   {
+      SineIndexPopSets(PStackElementP(ctrl->sine_indices, i),
+                       ctrl->shared_ax_sp);
+   }
     while(PStackGetSP(ctrl->clause_sets)>ctrl->shared_ax_sp)
     {
        clauses = PStackPopP(ctrl->clause_sets);
@@ -564,13 +589,14 @@ long StructFOFSpecGetProblem(StructFOFSpec_p ctrl,
    switch(ax_filter->type)
    {
    case AFGSinE:
-         res = SelectAxioms(ctrl->f_distrib,
-                            ctrl->clause_sets,
-                            ctrl->formula_sets,
-                            ctrl->shared_ax_sp,
-                            ax_filter,
-                            res_clauses,
-                            res_formulas);
+         res = SelectAxiomsIndexed(
+            StructFOFSpecGetSineIndex(ctrl, ax_filter->gen_measure),
+            ctrl->clause_sets,
+            ctrl->formula_sets,
+            ctrl->shared_ax_sp,
+            ax_filter,
+            res_clauses,
+            res_formulas);
          break;
    case AFThreshold:
          res = SelectThreshold(ctrl->clause_sets,
@@ -574,6 +574,7 @@ char* unstage_command(InteractiveSpec_p interactive, DStr_p axiom_set)
       {
          GenDistribAddFormulaSet(interactive->ctrl->f_distrib, fhandle, -1);
          GenDistribAddClauseSet(interactive->ctrl->f_distrib, chandle, -1);
+         StructFOFSpecResetSineIndices(interactive->ctrl);
          found = 1;
          break;
       }
@@ -17,6 +17,8 @@ Changes
 
 <1> Thu Mar 17 01:08:00 CET 2011
     New
+<2> Tue Oct 20 10:12:37 CEST 2026
+    Event loop based on TCPMux instead of select()
 
 -----------------------------------------------------------------------*/
 
@@ -39,6 +41,32 @@ Changes
 /*---------------------------------------------------------------------*/
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: eserver_drop_session()
+//
+//   Remove the session from the server, close its connection, and
+//   free it.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, drops connection
+//
+/----------------------------------------------------------------------*/
+
+static void eserver_drop_session(EServer_p server, ESession_p session)
+{
+   int sock = session->channel->sock;
+
+   assert(sock >= 0);
+   assert(PDArrayElementP(server->sessions, sock) == session);
+
+   TCPMuxRemove(server->mux, sock);
+   PDArrayAssignP(server->sessions, sock, NULL);
+   ESessionFree(session);
+   server->session_no--;
+}
+
 
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
@@ -60,8 +88,10 @@ EServer_p EServerAlloc(void)
 {
    EServer_p handle = EServerCellAlloc();
 
-   handle->listening = -1;
-   handle->sessions  = PQueueAlloc();
+   handle->listening  = -1;
+   handle->mux        = TCPMuxAlloc();
+   handle->sessions   = PDArrayAlloc(64, GROW_EXPONENTIAL);
+   handle->session_no = 0;
 
    return handle;
 }
@@ -71,7 +101,8 @@ EServer_p EServerAlloc(void)
 //
 // Function: EServerFree()
 //
-//   Free an EServer.
+//   Free an EServer, closing all connections and the listening
+//   socket.
 //
 // Global Variables: -
 //
@@ -81,6 +112,15 @@ EServer_p EServerAlloc(void)
 
 void EServerFree(EServer_p junk)
 {
+   EServerReset(junk);
+   if(junk->listening != -1)
+   {
+      TCPMuxRemove(junk->mux, junk->listening);
+      close(junk->listening);
+   }
+   TCPMuxFree(junk->mux);
+   PDArrayFree(junk->sessions);
+   EServerCellFree(junk);
 }
 
 
@@ -98,6 +138,18 @@ void EServerFree(EServer_p junk)
 
 void EServerReset(EServer_p server)
 {
+   long i;
+   ESession_p handle;
+
+   for(i=0; server->session_no && i<PDArraySize(server->sessions); i++)
+   {
+      handle = PDArrayElementP(server->sessions, i);
+      if(handle)
+      {
+         eserver_drop_session(server, handle);
+      }
+   }
+   assert(server->session_no == 0);
 }
 
 
@@ -123,7 +175,9 @@ bool EServerListen(EServer_p server, int port)
    {
       return false;
    }
+   SetNonBlocking(server->listening);
    Listen(server->listening);
+   TCPMuxAdd(server->mux, server->listening, MuxRead, NULL);
 
    return true;
 }
@@ -133,9 +187,9 @@ bool EServerListen(EServer_p server, int port)
 //
 // Function: EServerAccept()
 //
-//   Accept a new connection on the listening port and queue it in the
-//   connection queue. This assumes that there is a pending connection
-//   (e.g. indicated via select). Return success or failure.
+//   Accept all pending connections on the listening port and
+//   register a new session for each. Return true if at least one
+//   connection has been accepted.
 //
 // Global Variables: -
 //
@@ -146,67 +200,88 @@ bool EServerListen(EServer_p server, int port)
 bool EServerAccept(EServer_p server)
 {
    struct sockaddr addr;
-   socklen_t       addr_len = sizeof(addr);
+   socklen_t       addr_len;
    int             sock;
    ESession_p      session;
+   bool            res = false;
 
    assert(server->listening != -1);
 
-   sock = accept(server->listening, &addr, &addr_len);
-
-   if(sock == -1)
+   while(true)
    {
-      TmpErrno = errno;
-      SysWarning("Failure to accept connection");
-      return false;
+      addr_len = sizeof(addr);
+      sock = accept(server->listening, &addr, &addr_len);
+      if(sock == -1)
+      {
+         if(errno == EINTR || errno == ECONNABORTED)
+         {
+            continue;
+         }
+         if(errno != EAGAIN && errno != EWOULDBLOCK)
+         {
+            TmpErrno = errno;
+            SysWarning("Failure to accept connection");
+         }
+         break;
+      }
+      session = ESessionAlloc(sock);
+      ESessionSetState(session, ESWaiting);
+      PDArrayAssignP(server->sessions, sock, session);
+      TCPMuxAddChannel(server->mux, session->channel, session);
+      server->session_no++;
+      res = true;
    }
-   session = ESessionAlloc(sock);
-   PQueueStoreP(server->sessions, session);
-
-   return true;
+   return res;
 }
 
 
 /*-----------------------------------------------------------------------
 //
-// Function: EServerInitFDSet()
+// Function: EServerDispatch()
 //
-//   Set the fd bits for all file descriptors relevant to the
-//   server. Return largest fd.
+//   Wait for at most timeout milliseconds (forever if negative) for
+//   activity on the sockets of the server, and handle it: Accept new
+//   connections, process requests and send replies, and drop closed
+//   connections. Return number of events handled, or -1 on failure.
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : IO, memory operations
 //
 /----------------------------------------------------------------------*/
 
-int EServerInitFDSet(EServer_p server,
-                     fd_set *rd_fds,
-                     fd_set *wr_fds)
+long EServerDispatch(EServer_p server, int timeout)
 {
-   long index;
-   int tmp, max_fd = 0;
-   ESession_p handle;
+   long          i, events;
+   TCPMuxEvent_p event;
+   ESession_p    session;
 
-   for(index = PQueueTailIndex(server->sessions);
-       index != -1;
-       index =  PQueueIncIndex(server->sessions, index))
+   events = TCPMuxWait(server->mux, timeout);
+   for(i=0; i<events; i++)
    {
-      handle = PQueueElementP(server->sessions, index);
-      tmp = ESessionInitFDSet(handle, rd_fds, wr_fds);
-      max_fd = MAX(max_fd, tmp);
+      event = TCPMuxEvent(server->mux, i);
+      if(event->fd == server->listening)
+      {
+         EServerAccept(server);
+         continue;
+      }
+      session = event->data;
+      ESessionDoIO(session, event->events);
+      if(session->state == ESStale)
+      {
+         eserver_drop_session(server, session);
+      }
+      else
+      {
+         TCPMuxUpdateChannel(server->mux, session->channel);
+      }
    }
-   max_fd = MAX(max_fd, server->listening);
-   FD_SET(server->listening, rd_fds);
-
-   return max_fd;
+   return events;
 }
 
 
 
 
-
-
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
@@ -17,6 +17,8 @@ Changes
 
 <1> Thu Mar 17 01:08:00 CET 2011
     New
+<2> Tue Oct 20 10:12:37 CEST 2026
+    Event loop based on TCPMux instead of select()
 
 -----------------------------------------------------------------------*/
 
@@ -37,7 +39,9 @@ Changes
 typedef struct eserver_cell
 {
    int         listening;  /* Socket for connections */
-   PQueue_p    sessions;   /* Connections - head is active */
+   TCPMux_p    mux;        /* Watches all sockets */
+   PDArray_p   sessions;   /* Connections, indexed by socket */
+   long        session_no;
 }EServerCell, *EServer_p;
 
 
@@ -63,10 +67,7 @@ void       EServerReset(EServer_p server);
 bool       EServerListen(EServer_p server, int port);
 
 bool       EServerAccept(EServer_p server);
-
-int        EServerInitFDSet(EServer_p server,
-                            fd_set *rd_fds,
-                            fd_set *wr_fds);
+long       EServerDispatch(EServer_p server, int timeout);
 
 
 
@@ -17,6 +17,8 @@ Changes
 
 <1> Fri Apr 22 15:23:07 CEST 2011
     New
+<2> Tue Oct 20 10:12:37 CEST 2026
+    Event driven I/O
 
 -----------------------------------------------------------------------*/
 
@@ -91,52 +93,15 @@ void ESessionFree(ESession_p junk)
 }
 
 
-/*-----------------------------------------------------------------------
-//
-// Function: ESessionInitFDSet()
-//
-//   Set the fd bits for all file descriptors relevant to the
-//   server. Return largest fd.
-//
-// Global Variables: -
-//
-// Side Effects    : -
-//
-/----------------------------------------------------------------------*/
-
-int ESessionInitFDSet(ESession_p session,
-                     fd_set *rd_fds,
-                     fd_set *wr_fds)
-{
-   int tmp, max_fd;
-
-   if(session->state==ESNoState || session->state==ESStale)
-   {
-      return 0;
-   }
-   assert(session->channel->sock >=0);
-
-   max_fd = session->channel->sock;
-
-   FD_SET(session->channel->sock, rd_fds);
-   if(TCPChannelHasOutMsg(session->channel))
-   {
-      FD_SET(session->channel->sock, wr_fds);
-   }
-   if(session->running)
-   {
-      tmp = EPCtrlSetFDSet(session->running, rd_fds);
-      max_fd = MAX(max_fd, tmp);
-   }
-   return max_fd;
-}
-
-
 /*-----------------------------------------------------------------------
 //
 // Function: ESessionDoIO()
 //
-//   Perform I/O on all connections of the session.
+//   Perform I/O on the connection of the session, given the events
+//   (a MuxEventType mask) reported for it: Read all available
+//   messages, process them, and send as much of the output as
+//   possible. If the connection fails or is closed, the session
+//   becomes stale.
 //
 // Global Variables: -
 //
@@ -144,9 +109,7 @@ int ESessionInitFDSet(ESession_p session,
 //
 /----------------------------------------------------------------------*/
 
-void ESessionDoIO(ESession_p session,
-                  fd_set *rd_fds,
-                  fd_set *wr_fds)
+void ESessionDoIO(ESession_p session, int events)
 {
    MsgStatus res;
 
@@ -159,39 +122,28 @@ void ESessionDoIO(ESession_p session,
       return;
    }
    assert(session->channel->sock >=0);
-   if(FD_ISSET(session->channel->sock, rd_fds))
+   if(events & (MuxRead|MuxError))
    {
       res = TCPChannelRead(session->channel);
       switch(res)
       {
       case NWConnClosed:
       case NWError:
-            TCPChannelClose(session->channel);
             session->state = ESStale;
-            break;
+            return;
       case NWSuccess:
-            TCPChannelSendStr(session->channel, "wait");
+            ESessionProcessCmds(session);
             break;
       default:
             break;
       }
    }
-   if(session->state==ESNoState || session->state==ESStale)
-   {
-      return;
-   }
-   if(FD_ISSET(session->channel->sock, wr_fds))
+   if(TCPChannelHasOutMsg(session->channel))
    {
       res = TCPChannelWrite(session->channel);
-      switch(res)
+      if(res == NWError)
       {
-      case NWConnClosed:
-      case NWError:
-            TCPChannelClose(session->channel);
-            session->state = ESStale;
-            break;
-      default:
-            break;
+         session->state = ESStale;
       }
    }
 }
@@ -201,11 +153,12 @@ void ESessionDoIO(ESession_p session,
 //
 // Function: ESessionProcessCmds()
 //
-//   Process the messages stored in the input queue of the channel.
+//   Process the messages stored in the input queue of the channel,
+//   queuing the replies.
 //
 // Global Variables: -
 //
-// Side Effects    : IO
+// Side Effects    : Memory
 //
 /----------------------------------------------------------------------*/
 
@@ -218,7 +171,16 @@ void ESessionProcessCmds(ESession_p session)
    {
       msg = TCPChannelGetInMsg(session->channel);
       str = TCPMsgUnpack(msg);
-      printf("Received: %s\n", str);
+      VERBOSE(fprintf(stderr, "Received: %s\n", str););
+      if(strncmp(str, ESESSION_ECHO, strlen(ESESSION_ECHO))==0)
+      {
+         TCPChannelSendStr(session->channel, str+strlen(ESESSION_ECHO));
+      }
+      else
+      {
+         TCPChannelSendStr(session->channel, "wait");
+         TCPChannelSendStr(session->channel, "ready");
+      }
       FREE(str);
    }
 }
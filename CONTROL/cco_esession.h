@@ -19,6 +19,8 @@ Changes
 
 <1> Fri Apr 22 15:08:31 CEST 2011
     New
+<2> Tue Oct 20 10:12:37 CEST 2026
+    Event driven I/O (ESessionDoIO() takes MuxEventType mask)
 
 -----------------------------------------------------------------------*/
 
@@ -35,6 +37,11 @@ Changes
 /*                    Data type declarations                           */
 /*---------------------------------------------------------------------*/
 
+/* Messages starting with this are answered with the rest of the
+   message (for testing the connection) */
+
+#define ESESSION_ECHO "echo "
+
 typedef enum
 {
    ESNoState,  /* Default */
@@ -70,15 +77,10 @@ void   XXXFree(XXX_p junk);
 ESession_p  ESessionAlloc(int sock);
 void        ESessionFree(ESession_p junk);
 
-int         ESessionInitFDSet(ESession_p session,
-                              fd_set *rd_fds,
-                              fd_set *wr_fds);
-
-#define     ESessionSetState(session, state) (session)->state = state
+#define     ESessionSetState(session, new_state) \
+            (session)->state = (new_state)
 
-void        ESessionDoIO(ESession_p session,
-                         fd_set *rd_fds,
-                         fd_set *wr_fds);
+void        ESessionDoIO(ESession_p session, int events);
 
 void        ESessionProcessCmds(ESession_p session);
 
@@ -28,6 +28,23 @@
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+/* How ClauseSetReweight() treats a single evaluation tree */
+
+typedef enum
+{
+   RWKeep,    /* No changes, keep tree */
+   RWUpdate,  /* Reinsert the changed entries */
+   RWRebuild  /* Rebuild the tree from scratch */
+}ReweightMode;
+
+/* New values computed by ClauseSetReweight() */
+
+typedef struct reweight_value_cell
+{
+   EvalPriority priority;
+   float        heuristic;
+}ReweightValueCell, *ReweightValue_p;
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -339,9 +356,18 @@ Clause_p ForwardContractSet(ProofState_p state, ProofControl_p
 //
 // Function: ClauseSetReweight()
 //
-//   Re-Evaluate all clauses in set.
+//   Re-Evaluate all clauses in set. The result is the same as that
+//   of removing all evaluations and evaluating and reinserting the
+//   clauses in order (in particular, the FIFO counters of the new
+//   evaluations follow the order of the clauses in the set), but the
+//   existing evaluation cells are reused, and each evaluation tree is
+//   handled separately: If the old FIFO counters already follow the
+//   order of the set, a tree in which no value changes is kept as it
+//   is, and a tree in which only a few values change is updated by
+//   removing and reinserting only those clauses. All other trees are
+//   rebuilt in bulk.
 //
-// Global Variables: -
+// Global Variables: EvaluationCounter
 //
 // Side Effects    : Memory operations
 //
@@ -349,34 +375,171 @@ Clause_p ForwardContractSet(ProofState_p state, ProofControl_p
 
 void ClauseSetReweight(HCB_p heuristic, ClauseSet_p set)
 {
-   Clause_p    handle;
-   ClauseSet_p tmp_set;
+   Clause_p         handle;
+   Eval_p           old, scratch, *root, *evals = NULL;
+   ReweightValue_p  values, value;
+   ReweightMode     *mode;
+   long             *changes;
+   PStack_p         moved;
+   long             n = 0, k, base, last_count = -1;
+   bool             in_order = true, reuse = true, rebuild = false;
+   int              eval_no = heuristic->wfcb_no, i;
 
    assert(heuristic);
    assert(set);
    assert(!set->demod_index);
 
+   if(ClauseSetEmpty(set))
+   {
+      return;
+   }
+   values  = SecureMalloc(set->members*eval_no*sizeof(ReweightValueCell));
+   changes = SecureMalloc(eval_no*sizeof(long));
+   mode    = SecureMalloc(eval_no*sizeof(ReweightMode));
+   for(i=0; i<eval_no; i++)
+   {
+      changes[i] = 0;
+   }
+   scratch = EvalCellAlloc(eval_no);
+   scratch->eval_no = eval_no;
+
+   /* Evaluate everything, and find out what changes */
+   base = EvaluationCounter;
+   for(handle = set->anchor->succ; handle!=set->anchor;
+       handle=handle->succ)
+   {
+      old = handle->evaluations;
+      handle->evaluations = scratch;
+      HCBClauseReevaluate(heuristic, handle);
+      handle->evaluations = old;
+      EvaluationCounter++;
+
+      if(!old || old->eval_no != eval_no)
+      {
+         reuse = false;
+      }
+      else if(old->eval_count <= last_count)
+      {
+         in_order = false;
+      }
+      else
+      {
+         last_count = old->eval_count;
+      }
+      value = &(values[n*eval_no]);
+      for(i=0; i<eval_no; i++)
+      {
+         value[i].priority  = scratch->evals[i].priority;
+         value[i].heuristic = scratch->evals[i].heuristic;
+         if(reuse &&
+            (old->evals[i].priority != value[i].priority ||
+             old->evals[i].heuristic != value[i].heuristic))
+         {
+            changes[i]++;
+         }
+      }
+      n++;
+   }
+   EvalsFree(scratch);
+
+   for(i=0; i<eval_no; i++)
+   {
+      if(!reuse || !in_order ||
+         changes[i]*REWEIGHT_REBUILD_FRACTION > n)
+      {
+         mode[i] = RWRebuild;
+         rebuild = true;
+      }
+      else
+      {
+         mode[i] = changes[i]? RWUpdate : RWKeep;
+      }
+   }
+
+   /* Take out changed entries while all keys are still the old ones */
+   moved = PStackAlloc();
+   for(handle = set->anchor->succ, k = 0; handle!=set->anchor;
+       handle=handle->succ, k++)
+   {
+      value = &(values[k*eval_no]);
+      for(i=0; i<eval_no; i++)
+      {
+         if(mode[i] == RWUpdate &&
+            (handle->evaluations->evals[i].priority != value[i].priority ||
+             handle->evaluations->evals[i].heuristic != value[i].heuristic))
+         {
+            root = (void*)&PDArrayElementP(set->eval_indices, i);
+            EvalTreeExtractEntry(root, handle->evaluations, i);
+            PStackPushP(moved, handle);
+            PStackPushInt(moved, i);
+         }
+      }
+   }
 
-   ClauseSetRemoveEvaluations(set);
-   tmp_set = ClauseSetAlloc();
+   /* Store new values and counters. The counters of the remaining
+      entries keep their relative order. */
+   if(rebuild)
+   {
+      evals = SecureMalloc(n*sizeof(Eval_p));
+   }
+   for(handle = set->anchor->succ, k = 0; handle!=set->anchor;
+       handle=handle->succ, k++)
+   {
+      if(!reuse)
+      {
+         EvalsFree(handle->evaluations);
+         ClauseAddEvalCell(handle, EvalCellAlloc(eval_no));
+         handle->evaluations->eval_no = eval_no;
+      }
+      old   = handle->evaluations;
+      value = &(values[k*eval_no]);
+      old->eval_count = base+k;
+      for(i=0; i<eval_no; i++)
+      {
+         old->evals[i].priority  = value[i].priority;
+         old->evals[i].heuristic = value[i].heuristic;
+      }
+      if(evals)
+      {
+         evals[k] = old;
+      }
+   }
 
-   while(!ClauseSetEmpty(set))
+   while(!PStackEmpty(moved))
    {
-      ClauseSetInsert(tmp_set, ClauseSetExtractFirst(set));
+      i      = PStackPopInt(moved);
+      handle = PStackPopP(moved);
+      root   = (void*)&PDArrayElementP(set->eval_indices, i);
+      EvalTreeInsert(root, handle->evaluations, i);
    }
+   if(!reuse)
+   {
+      for(i=0; i<set->eval_indices->size; i++)
+      {
+         PDArrayAssignP(set->eval_indices, i, NULL);
+      }
+   }
+   for(i=0; i<eval_no; i++)
+   {
+      if(mode[i] == RWRebuild)
+      {
+         PDArrayAssignP(set->eval_indices, i, EvalTreeBuild(evals, n, i));
+      }
+   }
+   set->eval_no = MAX(eval_no, set->eval_no);
 
-   while(!ClauseSetEmpty(tmp_set))
+   PStackFree(moved);
+   if(evals)
    {
-      handle = ClauseSetExtractFirst(tmp_set);
-      HCBClauseEvaluate(heuristic, handle);
-      ClauseSetInsert(set, handle);
+      FREE(evals);
    }
-   ClauseSetFree(tmp_set);
+   FREE(mode);
+   FREE(changes);
+   FREE(values);
 }
 
 
 
-
 /*-----------------------------------------------------------------------
 //
 // Function:  ForwardContractSetReweight()
@@ -45,6 +45,12 @@
 
 #define DEFAULT_FILTER_DESCRIPTOR "Fc"
 
+/* ClauseSetReweight() rebuilds an evaluation tree from scratch if
+   more than 1/REWEIGHT_REBUILD_FRACTION of the clauses change their
+   value in this tree. */
+
+#define REWEIGHT_REBUILD_FRACTION 8
+
 bool ForwardModifyClause(ProofState_p state,
                          ProofControl_p control,
                          Clause_p clause,
@@ -18,6 +18,8 @@ Changes
 
 <1> Mon Jun  8 18:26:14 MET DST 1998
     New
+<2> Wed Oct 21 19:58:40 CEST 2026
+    Read the given clause with DEREF_OFFSET instead of copying it.
 
 -----------------------------------------------------------------------*/
 
@@ -44,8 +46,8 @@ Changes
 //
 // Function: sim_paramod_q()
 //
-//   Given frompos (instantiated) and pm_type, determine wether to use
-//   normal or simultaneous paramodulation.
+//   Given frompos (instantiated, read with deref) and pm_type,
+//   determine wether to use normal or simultaneous paramodulation.
 //
 // Global Variables: -
 //
@@ -53,7 +55,8 @@ Changes
 //
 /----------------------------------------------------------------------*/
 
-static bool sim_paramod_q(OCB_p ocb, ClausePos_p frompos, ParamodulationType pm_type)
+static bool sim_paramod_q(OCB_p ocb, ClausePos_p frompos,
+                          ParamodulationType pm_type, DerefType deref)
 {
    bool res;
    Term_p max_side, rep_side;
@@ -72,7 +75,7 @@ static bool sim_paramod_q(OCB_p ocb, ClausePos_p frompos, ParamodulationType pm_
    case ParamodDecreasingSim:
          max_side = ClausePosGetSide(frompos);
          rep_side = ClausePosGetOtherSide(frompos);
-         res = TOGreater(ocb, max_side, rep_side, DEREF_ALWAYS, DEREF_ALWAYS);
+         res = TOGreater(ocb, max_side, rep_side, deref, deref);
          break;
    case ParamodSizeDecreasingSim:
          max_side = ClausePosGetSide(frompos);
@@ -93,7 +96,8 @@ static bool sim_paramod_q(OCB_p ocb, ClausePos_p frompos, ParamodulationType pm_
 // Function: variable_paramod()
 //
 //   Perform paramodulation or simulated paramodulation as
-//   requested. Return result (if any)
+//   requested. Return result (if any). The from clause is read with
+//   deref_from, the into clause with deref_into.
 //
 // Global Variables: -
 //
@@ -103,21 +107,24 @@ static bool sim_paramod_q(OCB_p ocb, ClausePos_p frompos, ParamodulationType pm_
 
 static Clause_p variable_paramod(TB_p bank, OCB_p ocb, ClausePos_p from,
                           ClausePos_p into, VarBank_p freshvars,
-                          ParamodulationType pm_type, InfType *inf)
+                          ParamodulationType pm_type, InfType *inf,
+                          DerefType deref_from, DerefType deref_into)
 {
    Clause_p paramod = NULL;
 
-   if(sim_paramod_q(ocb, from, pm_type))
+   if(sim_paramod_q(ocb, from, pm_type, deref_from))
    {
       paramod = ClauseOrderedSimParamod(bank, ocb, from, into,
-                                        freshvars);
+                                        freshvars, deref_from,
+                                        deref_into);
       *inf = inf_sim_paramod;
 
    }
    else
    {
       paramod = ClauseOrderedParamod(bank, ocb, from, into,
-                                     freshvars);
+                                     freshvars, deref_from,
+                                     deref_into);
       *inf = inf_paramod;
 
    }
@@ -220,18 +227,21 @@ static long compute_into_pm_pos_clause(ParamodInfo_p pminfo,
       rside = ClausePosGetOtherSide(pminfo->into_pos);
 
       if((EqnIsOriented(pminfo->into_pos->literal)
-          ||!TOGreater(pminfo->ocb, rside, lside, DEREF_ALWAYS, DEREF_ALWAYS))
+          ||!TOGreater(pminfo->ocb, rside, lside,
+                       pminfo->deref_into, pminfo->deref_into))
          &&
          ((EqnIsPositive(pminfo->into_pos->literal)&&
            EqnListEqnIsStrictlyMaximal(pminfo->ocb,
                                        pminfo->into->literals,
-                                       pminfo->into_pos->literal))
+                                       pminfo->into_pos->literal,
+                                       pminfo->deref_into))
      ||
           (EqnIsNegative(pminfo->into_pos->literal)
            &&
            EqnListEqnIsMaximal(pminfo->ocb,
                                pminfo->into->literals,
-                               pminfo->into_pos->literal))))
+                               pminfo->into_pos->literal,
+                               pminfo->deref_into))))
       {
          /* printf("# compute_into_pm_pos_clause\n");  */
          clause = ClauseParamodConstruct(pminfo, sim_pm);
@@ -287,7 +297,9 @@ long compute_pos_into_pm_term(ParamodInfo_p pminfo,
    bool             sim_pm;
 
    /*printf("\n@i %ld\n", DebugCount); */
-   if(SubstComputeMgu(olterm, into_clauses->term, subst))
+   if(SubstComputeMguOffset(olterm, into_clauses->term, subst,
+                            pminfo->deref_from, pminfo->deref_into,
+                            pminfo->bank))
    {
       /* Check from-clause ordering constraints */
       /* printf("# Mgu into:\n");
@@ -298,15 +310,17 @@ long compute_pos_into_pm_term(ParamodInfo_p pminfo,
       rep_side = ClausePosGetOtherSide(pminfo->from_pos);
 
       if((EqnIsOriented(pminfo->from_pos->literal) ||
-          !TOGreater(pminfo->ocb, rep_side, max_side, DEREF_ALWAYS,
-                     DEREF_ALWAYS))
+          !TOGreater(pminfo->ocb, rep_side, max_side, pminfo->deref_from,
+                     pminfo->deref_from))
          &&
          EqnListEqnIsStrictlyMaximal(pminfo->ocb,
                  pminfo->from->literals,
-                 pminfo->from_pos->literal))
+                 pminfo->from_pos->literal,
+                 pminfo->deref_from))
       {
          /* printf("compute_pos_into_pm_term() oc ok\n"); */
-         sim_pm = sim_paramod_q(pminfo->ocb, pminfo->from_pos, type);
+         sim_pm = sim_paramod_q(pminfo->ocb, pminfo->from_pos, type,
+                                pminfo->deref_from);
          /* Iterate over all the into-clauses   */
          iterstack = PTreeTraverseInit(into_clauses->pl.pos.clauses);
          while ((cell = PTreeTraverseNext(iterstack)))
@@ -441,16 +455,19 @@ static long compute_from_pm_pos_clause(ParamodInfo_p pminfo,
          break;
       }
       pminfo->from_pos  = UnpackClausePos(cell->key, pminfo->from);
-      sim_pm = sim_paramod_q(pminfo->ocb, pminfo->from_pos, type);
+      sim_pm = sim_paramod_q(pminfo->ocb, pminfo->from_pos, type,
+                             pminfo->deref_from);
       lside = ClausePosGetSide(pminfo->from_pos);
       rside = ClausePosGetOtherSide(pminfo->from_pos);
 
       if((EqnIsOriented(pminfo->from_pos->literal)
-          ||!TOGreater(pminfo->ocb, rside, lside, DEREF_ALWAYS, DEREF_ALWAYS))
+          ||!TOGreater(pminfo->ocb, rside, lside,
+                       pminfo->deref_from, pminfo->deref_from))
          &&
          (EqnListEqnIsStrictlyMaximal(pminfo->ocb,
                                       pminfo->from->literals,
-                                      pminfo->from_pos->literal)))
+                                      pminfo->from_pos->literal,
+                                      pminfo->deref_from)))
       {
          /* printf("# compute_from_pm_pos_clause\n");  */
          clause = ClauseParamodConstruct(pminfo, sim_pm);
@@ -509,7 +526,9 @@ long compute_pos_from_pm_term(ParamodInfo_p pminfo,
    Term_p           max_side, min_side;
 
    /*printf("\n@f %ld\n", DebugCount); */
-   if(SubstComputeMgu(olterm, from_clauses->term, subst))
+   if(SubstComputeMguOffset(olterm, from_clauses->term, subst,
+                            pminfo->deref_into, pminfo->deref_from,
+                            pminfo->bank))
    {
       /* Check into-clause ordering constraints */
       /* printf("# Mgu from:\n");
@@ -520,18 +539,20 @@ long compute_pos_from_pm_term(ParamodInfo_p pminfo,
       min_side = ClausePosGetOtherSide(pminfo->into_pos);
 
       if((EqnIsOriented(pminfo->into_pos->literal) ||
-          !TOGreater(pminfo->ocb, min_side, max_side, DEREF_ALWAYS,
-                     DEREF_ALWAYS))
+          !TOGreater(pminfo->ocb, min_side, max_side, pminfo->deref_into,
+                     pminfo->deref_into))
          &&
          ((EqnIsPositive(pminfo->into_pos->literal)&&
            EqnListEqnIsStrictlyMaximal(pminfo->ocb,
                                        pminfo->into->literals,
-                                       pminfo->into_pos->literal))
+                                       pminfo->into_pos->literal,
+                                       pminfo->deref_into))
           ||
           (EqnIsNegative(pminfo->into_pos->literal) &&
            EqnListEqnIsMaximal(pminfo->ocb,
                                pminfo->into->literals,
-                               pminfo->into_pos->literal))))
+                               pminfo->into_pos->literal,
+                               pminfo->deref_into))))
       {
          /* printf("compute_pos_from_pm_term() oc ok\n"); */
          /* Iterate over all the into-clauses   */
@@ -634,7 +655,8 @@ static long compute_pos_from_pm(ParamodInfo_p pminfo,
 //
 //   Compute all (simultaneous) paramodulants between clause and with,
 //   with terms from bank, and put them into store. Returns number of
-//   paramodulants.
+//   paramodulants. clause is read with DEREF_OFFSET, so it does not
+//   need to be variable-disjoint from with (and may be with).
 //
 // Global Variables: -
 //
@@ -643,8 +665,7 @@ static long compute_pos_from_pm(ParamodInfo_p pminfo,
 /----------------------------------------------------------------------*/
 
 long ComputeClauseClauseParamodulants(TB_p bank, OCB_p ocb, Clause_p
-                                      clause, Clause_p parent_alias,
-                                      Clause_p with, ClauseSet_p
+                                      clause, Clause_p with, ClauseSet_p
                                       store, VarBank_p freshvars,
                                       ParamodulationType pm_type)
 {
@@ -656,9 +677,6 @@ long ComputeClauseClauseParamodulants(TB_p bank, OCB_p ocb, Clause_p
 
 
    assert(EqnListQueryPropNumber(clause->literals, EPIsMaximal));
-   assert(EqnListQueryPropNumber(clause->literals, EPIsMaximal)
-          ==
-          EqnListQueryPropNumber(parent_alias->literals, EPIsMaximal));
    assert(EqnListQueryPropNumber(with->literals, EPIsMaximal));
 
    if(ClauseQueryProp(clause, CPNoGeneration)||
@@ -678,23 +696,24 @@ long ComputeClauseClauseParamodulants(TB_p bank, OCB_p ocb, Clause_p
 
       /* printf("\n@i %ld\n", DebugCount); */
       paramod = variable_paramod(bank, ocb, pos1, pos2,
-                                 freshvars, pm_type, &inf_type);
+                                 freshvars, pm_type, &inf_type,
+                                 DEREF_OFFSET, DEREF_ALWAYS);
 
       if(paramod)
       {
     paramod_count++;
-    paramod->parent1 = parent_alias;
+    paramod->parent1 = clause;
     paramod->proof_size  =
-       parent_alias->proof_size+with->proof_size+1;
-    paramod->proof_depth = MAX(parent_alias->proof_depth,
+       clause->proof_size+with->proof_size+1;
+    paramod->proof_depth = MAX(clause->proof_depth,
                 with->proof_depth)+1;
     ClauseSetTPTPType(paramod,
-            ClauseQueryTPTPType(parent_alias));
+            ClauseQueryTPTPType(clause));
     ClauseSetProp(paramod,
-             ClauseGiveProps(parent_alias, CPIsSOS)|
+             ClauseGiveProps(clause, CPIsSOS)|
              ClauseGiveProps(with, CPIsSOS));
-    ClauseRegisterChild(parent_alias, paramod);
-    if(parent_alias!=with)
+    ClauseRegisterChild(clause, paramod);
+    if(clause!=with)
     {
        paramod->parent2 = with;
 
@@ -706,17 +725,17 @@ long ComputeClauseClauseParamodulants(TB_p bank, OCB_p ocb, Clause_p
        ClauseRegisterChild(with, paramod);
     }
     DocClauseCreationDefault(paramod, inf_type, with,
-              parent_alias);
-         ClausePushDerivation(clause,
+              clause);
+         ClausePushDerivation(paramod,
                               inf_type==inf_sim_paramod?DCSimParamod:DCParamod,
-                              with, parent_alias);
+                              with, clause);
     ClauseSetInsert(store, paramod);
       }
       test = ClausePosNextParamodPair(pos1, pos2, false, pm_type != ParamodPlain);
    }
    /* Paramod clause into with - no top positions this time ;-) */
 
-   if(parent_alias==with)
+   if(clause==with)
    {
       /* Both clauses are identical, i.e. both cases are
     symmetric. Ergo do nothing... */
@@ -731,34 +750,35 @@ long ComputeClauseClauseParamodulants(TB_p bank, OCB_p ocb, Clause_p
     assert(TermPosIsTopPos(pos1->pos));
          /*printf("\n@f %ld\n", DebugCount);*/
          paramod = variable_paramod(bank, ocb, pos1, pos2,
-                                    freshvars, pm_type, &inf_type);
+                                    freshvars, pm_type, &inf_type,
+                                    DEREF_ALWAYS, DEREF_OFFSET);
     if(paramod)
     {
        paramod_count++;
        paramod->parent1 = with;
        paramod->proof_size  =
-          parent_alias->proof_size+with->proof_size+1;
-       paramod->proof_depth = MAX(parent_alias->proof_depth,
+          clause->proof_size+with->proof_size+1;
+       paramod->proof_depth = MAX(clause->proof_depth,
                    with->proof_depth)+1;
        ClauseSetTPTPType(paramod,
                ClauseQueryTPTPType(with));
        ClauseSetProp(paramod,
-           ClauseGiveProps(parent_alias, CPIsSOS)|
+           ClauseGiveProps(clause, CPIsSOS)|
            ClauseGiveProps(with, CPIsSOS));
        ClauseRegisterChild(with, paramod);
-       if(parent_alias!=with)
+       if(clause!=with)
        {
-          paramod->parent2 = parent_alias;
+          paramod->parent2 = clause;
           ClauseSetTPTPType(paramod,
              TPTPTypesCombine(
                 ClauseQueryTPTPType(paramod),
-                ClauseQueryTPTPType(parent_alias)));
-          ClauseRegisterChild(parent_alias, paramod);
+                ClauseQueryTPTPType(clause)));
+          ClauseRegisterChild(clause, paramod);
        }
-       DocClauseCreationDefault(paramod, inf_type, parent_alias, with);
-            ClausePushDerivation(clause,
+       DocClauseCreationDefault(paramod, inf_type, clause, with);
+            ClausePushDerivation(paramod,
                                  inf_type==inf_sim_paramod?DCSimParamod:DCParamod,
-                                 parent_alias, with);
+                                 clause, with);
        ClauseSetInsert(store, paramod);
     }
     test = ClausePosNextParamodPair(pos1, pos2, true, pm_type != ParamodPlain);
@@ -785,8 +805,7 @@ long ComputeClauseClauseParamodulants(TB_p bank, OCB_p ocb, Clause_p
 /----------------------------------------------------------------------*/
 
 long ComputeAllParamodulants(TB_p bank, OCB_p ocb, Clause_p clause,
-              Clause_p parent_alias, ClauseSet_p
-              with_set, ClauseSet_p store, VarBank_p
+              ClauseSet_p with_set, ClauseSet_p store, VarBank_p
               freshvars, ParamodulationType pm_type)
 {
    Clause_p handle;
@@ -796,8 +815,7 @@ long ComputeAllParamodulants(TB_p bank, OCB_p ocb, Clause_p clause,
        handle = handle->succ)
    {
       paramod_count +=
-    ComputeClauseClauseParamodulants(bank, ocb, clause,
-                                          parent_alias, handle,
+    ComputeClauseClauseParamodulants(bank, ocb, clause, handle,
                                           store, freshvars, pm_type);
    }
    return paramod_count;
@@ -809,7 +827,8 @@ long ComputeAllParamodulants(TB_p bank, OCB_p ocb, Clause_p clause,
 // Function: ComputeIntoParamodulants()
 //
 //   Compute all paramodulants from clause into clauses in
-//   into_index.
+//   into_index. clause is read with DEREF_OFFSET, the clauses in the
+//   index with DEREF_ALWAYS.
 //
 // Global Variables: -
 //
@@ -831,7 +850,9 @@ long ComputeIntoParamodulants(ParamodInfo_p pminfo,
    CompactPos    pos;
 
    ClauseCollectFromTermsPos(clause, pos_stack);
-   pminfo->from = clause;
+   pminfo->from       = clause;
+   pminfo->deref_from = DEREF_OFFSET;
+   pminfo->deref_into = DEREF_ALWAYS;
 
    while(!PStackEmpty(pos_stack))
    {
@@ -856,7 +877,8 @@ long ComputeIntoParamodulants(ParamodInfo_p pminfo,
 // Function: ComputeFromParamodulants()
 //
 //   Compute all paramodulants from clauses in from_index into
-//   clause.
+//   clause. clause is read with DEREF_OFFSET, the clauses in the
+//   index with DEREF_ALWAYS.
 //
 // Global Variables: -
 //
@@ -876,7 +898,9 @@ long ComputeFromParamodulants(ParamodInfo_p pminfo,
    CompactPos    pos;
 
    ClauseCollectIntoTermsPos(clause, pos_stack);
-   pminfo->into = clause;
+   pminfo->into       = clause;
+   pminfo->deref_into = DEREF_OFFSET;
+   pminfo->deref_from = DEREF_ALWAYS;
 
    while(!PStackEmpty(pos_stack))
    {
@@ -905,7 +929,8 @@ long ComputeFromParamodulants(ParamodInfo_p pminfo,
 // Function: ComputeFromSimParamodulants()
 //
 //   Compute all simultaneouss paramodulants from clauses in
-//   from_index into clause.
+//   from_index into clause. clause is read with DEREF_OFFSET, the
+//   clauses in the index with DEREF_ALWAYS.
 //
 // Global Variables: -
 //
@@ -930,7 +955,9 @@ long ComputeFromSimParamodulants(ParamodInfo_p pminfo,
    */
    ClauseCollectIntoTermsPos(clause, pos_stack);
 
-   pminfo->into = clause;
+   pminfo->into       = clause;
+   pminfo->deref_into = DEREF_OFFSET;
+   pminfo->deref_from = DEREF_ALWAYS;
 
    /*
    // Here: Iterate over the terms, and inside the terms over the
@@ -964,7 +991,8 @@ long ComputeFromSimParamodulants(ParamodInfo_p pminfo,
 //
 //   Compute all paramodulants (of the right pm_type) between clause
 //   and clauses in the indices. Put them into store. Return number of
-//   clauses generated.
+//   clauses generated. clause is read with DEREF_OFFSET, so it may
+//   itself be in the indices.
 //
 // Global Variables: -
 //
@@ -975,7 +1003,6 @@ long ComputeFromSimParamodulants(ParamodInfo_p pminfo,
 long ComputeAllParamodulantsIndexed(TB_p bank, OCB_p ocb,
                                     VarBank_p freshvars,
                                     Clause_p clause,
-                                    Clause_p parent_alias,
                                     OverlapIndex_p into_index,
                                     OverlapIndex_p negp_index,
                                     OverlapIndex_p from_index,
@@ -988,7 +1015,7 @@ long ComputeAllParamodulantsIndexed(TB_p bank, OCB_p ocb,
    pminfo.bank      = bank;
    pminfo.freshvars = freshvars;
    pminfo.ocb       = ocb;
-   pminfo.new_orig  = parent_alias;
+   pminfo.new_orig  = clause;
 
    res += ComputeIntoParamodulants(&pminfo,
                                    pm_type,
@@ -43,14 +43,12 @@ Changes
 
 
 long ComputeClauseClauseParamodulants(TB_p bank, OCB_p ocb, Clause_p
-                  clause, Clause_p parent_alias,
-                  Clause_p with, ClauseSet_p
+                  clause, Clause_p with, ClauseSet_p
                   store, VarBank_p freshvars,
                                       ParamodulationType pm_type);
 
 long ComputeAllParamodulants(TB_p bank, OCB_p ocb, Clause_p clause,
-              Clause_p parent_alias, ClauseSet_p
-              with_set, ClauseSet_p store, VarBank_p
+              ClauseSet_p with_set, ClauseSet_p store, VarBank_p
               freshvars, ParamodulationType pm_type);
 
 
@@ -77,7 +75,6 @@ long ComputeFromSimParamodulants(ParamodInfo_p pminfo,
 long ComputeAllParamodulantsIndexed(TB_p bank, OCB_p ocb,
                                     VarBank_p freshvars,
                                     Clause_p clause,
-                                    Clause_p parent_alias,
                                     OverlapIndex_p into_index,
                                     OverlapIndex_p negp_index,
                                     OverlapIndex_p from_index,
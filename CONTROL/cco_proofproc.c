@@ -397,7 +397,7 @@ void check_watchlist(GlobalIndices_p indices, ClauseSet_p watchlist,
    {
       Clause_p subsumed;
 
-      subsumed = ClauseSetFindFirstSubsumedClause(watchlist, clause);
+      subsumed = ClauseSetFindFirstFVSubsumedClause(watchlist, pclause);
       if(subsumed)
       {
          ClauseSetProp(clause, CPSubsumesWatch);
@@ -511,7 +511,7 @@ void simplify_watchlist(ProofState_p state, ProofControl_p control,
 /----------------------------------------------------------------------*/
 
 static void generate_new_clauses(ProofState_p state, ProofControl_p
-                                 control, Clause_p clause, Clause_p tmp_copy)
+                                 control, Clause_p clause)
 {
    if(control->heuristic_parms.enable_eq_factoring)
    {
@@ -534,7 +534,6 @@ static void generate_new_clauses(ProofState_p state, ProofControl_p
             ComputeAllParamodulantsIndexed(state->terms,
                                            control->ocb,
                                            state->freshvars,
-                                           tmp_copy,
                                            clause,
                                            state->gindices.pm_into_index,
                                            state->gindices.pm_negp_index,
@@ -546,13 +545,13 @@ static void generate_new_clauses(ProofState_p state, ProofControl_p
       {
          state->paramod_count+=
             ComputeAllParamodulants(state->terms, control->ocb,
-                                    tmp_copy, clause,
+                                    clause,
                                     state->processed_pos_rules,
                                     state->tmp_store, state->freshvars,
                                     control->heuristic_parms.pm_type);
          state->paramod_count+=
             ComputeAllParamodulants(state->terms, control->ocb,
-                                    tmp_copy, clause,
+                                    clause,
                                     state->processed_pos_eqns,
                                     state->tmp_store, state->freshvars,
                                     control->heuristic_parms.pm_type);
@@ -561,14 +560,14 @@ static void generate_new_clauses(ProofState_p state, ProofControl_p
          { /* We never need to try to overlap purely negative clauses! */
             state->paramod_count+=
                ComputeAllParamodulants(state->terms, control->ocb,
-                                       tmp_copy, clause,
+                                       clause,
                                        state->processed_neg_units,
                                        state->tmp_store, state->freshvars,
                                        control->heuristic_parms.pm_type);
          }
          state->paramod_count+=
             ComputeAllParamodulants(state->terms, control->ocb,
-                                    tmp_copy, clause,
+                                    clause,
                                     state->processed_non_units,
                                     state->tmp_store, state->freshvars,
                                     control->heuristic_parms.pm_type);
@@ -754,6 +753,7 @@ Clause_p replacing_inferences(ProofState_p state, ProofControl_p
 //   - Simplify all unprocessed clauses
 //   - Reweigh all unprocessed clauses
 //   - Delete "bad" clauses to avoid running out of memories.
+//   - Collect unused term cells if the term bank has grown enough.
 //   Simplification can find the empty clause, which is then
 //   returned.
 //
@@ -845,6 +845,7 @@ static Clause_p cleanup_unprocessed_clauses(ProofState_p state,
       filter_base = MIN(filter_base, current_storage);
       filter_copies_base = MIN(filter_copies_base, current_storage);
    }
+   GCCollectByPolicy(state->gc_terms);
    return unsatisfiable;
 }
 
@@ -1373,12 +1374,13 @@ void ProofStateInit(ProofState_p state, ProofControl_p control)
 Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
                        long answer_limit)
 {
-   Clause_p         clause, resclause, tmp_copy, empty, arch_copy = NULL;
+   Clause_p         clause, resclause, empty, arch_copy = NULL;
    FVPackedClause_p pclause;
    SysDate          clausedate;
 
    clause = control->hcb->hcb_select(control->hcb,
                                      state->unprocessed);
+   ProofStatePhaseDone(state, PSPSelection);
    //EvalListPrintComment(GlobalOut, clause->evaluations); printf("\n");
    if(OutputLevel==1)
    {
@@ -1400,11 +1402,13 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
       arch_copy = ClauseArchive(state->archive, clause);
    }
 
-   if(!(pclause = ForwardContractClause(state, control,
-                                        clause, true,
-                                        control->heuristic_parms.forward_context_sr,
-                                        control->heuristic_parms.condensing,
-                                        FullRewrite)))
+   pclause = ForwardContractClause(state, control,
+                                   clause, true,
+                                   control->heuristic_parms.forward_context_sr,
+                                   control->heuristic_parms.condensing,
+                                   FullRewrite);
+   ProofStatePhaseDone(state, PSPForwardSimp);
+   if(!pclause)
    {
       if(arch_copy)
       {
@@ -1433,6 +1437,7 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
    state->proc_non_trivial_count++;
 
    resclause = replacing_inferences(state, control, pclause);
+   ProofStatePhaseDone(state, PSPForwardSimp);
    if(!resclause || ClauseIsEmpty(resclause))
    {
       if(resclause)
@@ -1457,12 +1462,11 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
    eliminate_unit_simplified_clauses(state, pclause->clause);
    eliminate_context_sr_clauses(state, control, pclause->clause);
    ClauseSetSetProp(state->tmp_store, CPIsIRVictim);
+   ProofStatePhaseDone(state, PSPBackwardSimp);
 
    clause = pclause->clause;
 
    ClauseNormalizeVars(clause, state->freshvars);
-   tmp_copy = ClauseCopyDisjoint(clause);
-   tmp_copy->ident = clause->ident;
 
    clause->date = clausedate;
    ClauseSetProp(clause, CPLimitedRW);
@@ -1499,15 +1503,16 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
    {
       simplify_watchlist(state, control, clause);
    }
+   ProofStatePhaseDone(state, PSPIndexing);
    if(control->heuristic_parms.selection_strategy != SelectNoGeneration)
    {
-      generate_new_clauses(state, control, clause, tmp_copy);
+      generate_new_clauses(state, control, clause);
    }
-   ClauseFree(tmp_copy);
    if(TermCellStoreNodes(&(state->tmp_terms->term_store))>TMPBANK_GC_LIMIT)
    {
       TBGCSweep(state->tmp_terms);
    }
+   ProofStatePhaseDone(state, PSPGeneration);
 #ifdef PRINT_SHARING
    print_sharing_factor(state);
 #endif
@@ -1518,7 +1523,9 @@ Clause_p ProcessClause(ProofState_p state, ProofControl_p control,
    {
       ClauseSetSort(state->tmp_store, ClauseCmpByStructWeight);
    }
-   if((empty = insert_new_clauses(state, control)))
+   empty = insert_new_clauses(state, control);
+   ProofStatePhaseDone(state, PSPNewClauses);
+   if(empty)
    {
       PStackPushP(state->extract_roots, empty);
       return empty;
@@ -1552,6 +1559,7 @@ Clause_p Saturate(ProofState_p state, ProofControl_p control, long
       sat_check_size_limit = control->heuristic_parms.sat_check_size_limit,
       sat_check_step_limit = control->heuristic_parms.sat_check_step_limit;
 
+   ProofStatePhaseStart(state);
    while(!TimeIsUp &&
          !ClauseSetEmpty(state->unprocessed) &&
          step_limit   > count &&
@@ -1570,6 +1578,7 @@ Clause_p Saturate(ProofState_p state, ProofControl_p control, long
          break;
       }
       unsatisfiable = cleanup_unprocessed_clauses(state, control);
+      ProofStatePhaseDone(state, PSPCleanup);
       if(unsatisfiable)
       {
          break;
@@ -1589,6 +1598,7 @@ Clause_p Saturate(ProofState_p state, ProofControl_p control, long
             unsatisfiable = SATCheck(state, control);
             sat_check_step_limit += control->heuristic_parms.sat_check_step_limit;
          }
+         ProofStatePhaseDone(state, PSPSATCheck);
          if(unsatisfiable)
          {
             PStackPushP(state->extract_roots, unsatisfiable);
@@ -111,9 +111,14 @@ void ScheduleTimesInit(ScheduleCell sched[], double time_used)
 //
 // Function:  ExecuteSchedule()
 //
-//   Execute the hard-coded strategy schedule.
+//   Execute the hard-coded strategy schedule. Each strategy runs in
+//   a forked child that inherits (copy-on-write) the proof state as
+//   prepared by the parent, so strategy-independent preprocessing
+//   should be done before calling this. Each child continues the
+//   derivation log (if any) from the state at the time of the call,
+//   so the log only contains the steps of the last strategy tried.
 //
-// Global Variables: SilentTimeOut
+// Global Variables: SilentTimeOut, DerivLogFile
 //
 // Side Effects    : Forks, the child runs the proof search, re-sets
 //                   time limits, sets heuristic parameters
@@ -127,8 +132,10 @@ pid_t ExecuteSchedule(ScheduleCell strats[],
    int raw_status, status = OTHER_ERROR, i;
    pid_t pid       = 0, respid;
    double run_time = GetTotalCPUTime();
+   long log_mark;
 
    ScheduleTimesInit(strats, run_time);
+   log_mark = DerivLogForkMark();
 
    for(i=0; strats[i].heu_name; i++)
    {
@@ -143,6 +150,7 @@ pid_t ExecuteSchedule(ScheduleCell strats[],
       {
          /* Child */
          SilentTimeOut = true;
+         DerivLogForkReset(log_mark);
          if(strats[i].time_absolute!=RLIM_INFINITY)
          {
             SetSoftRlimit(RLIMIT_CPU, strats[i].time_absolute);
@@ -29,6 +29,7 @@ Changes
 #include <sys/wait.h>
 #include <cio_signals.h>
 #include <che_hcb.h>
+#include <ccl_derivlog.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -160,7 +160,9 @@ bool RemoveRewritableClausesIndexed(OCB_p ocb, ClauseSet_p into,
 //
 //   Try to simplify all clauses in set by performing matching unit
 //   resolution with simplifier. Move affected clauses from set into
-//   tmp_set. Return number of clauses moved.
+//   tmp_set. Return number of clauses moved. If the global indices
+//   provide a unit simplification index, use it to find the affected
+//   clauses instead of scanning the whole set.
 //
 // Global Variables: -
 //
@@ -174,7 +176,47 @@ long ClauseSetUnitSimplify(ClauseSet_p set, Clause_p simplifier,
 {
    Clause_p handle, move;
    long res = 0,tmp;
+   PStack_p stack;
 
+   if(gindices && gindices->unit_sr_index &&
+      UnitSRIndexQueryable(simplifier))
+   {
+      stack = PStackAlloc();
+      tmp = UnitSRIndexFindSimplifiable(gindices->unit_sr_index, set,
+                                        simplifier, stack);
+      if(tmp > 1)
+      {
+         /* Move the clauses in set order (as the scan below does),
+            since the order of tmp_set influences the further
+            search. */
+         while(!PStackEmpty(stack))
+         {
+            move = PStackPopP(stack);
+            ClauseSetProp(move, CPOpFlag);
+         }
+         handle = set->anchor->succ;
+         while(res < tmp)
+         {
+            assert(handle!=set->anchor);
+            move = handle;
+            handle = handle->succ;
+            if(ClauseQueryProp(move, CPOpFlag))
+            {
+               ClauseDelProp(move, CPOpFlag);
+               ClauseMoveSimplified(gindices, move, tmp_set, archive);
+               res++;
+            }
+         }
+      }
+      else if(tmp == 1)
+      {
+         move = PStackPopP(stack);
+         ClauseMoveSimplified(gindices, move, tmp_set, archive);
+         res++;
+      }
+      PStackFree(stack);
+      return res;
+   }
    handle = set->anchor->succ;
    while(handle!=set->anchor)
    {
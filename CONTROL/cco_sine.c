@@ -17,6 +17,8 @@ Changes
 
 <1> Thu May 10 15:39:26 CEST 2012
     New
+<2> Mon Oct 19 17:21:05 CEST 2026
+    Persistent SinE indices
 
 -----------------------------------------------------------------------*/
 
@@ -315,6 +317,7 @@ StructFOFSpec_p StructFOFSpecCreate(TB_p terms)
    handle->parsed_includes = NULL;
    handle->f_distrib       = GenDistribAlloc(handle->sig);
    handle->shared_ax_sp    = 0;
+   handle->sine_indices    = PStackAlloc();
 
    return handle;
 }
@@ -371,6 +374,9 @@ void StructFOFSpecFree(StructFOFSpec_p ctrl)
    FormulaSet_p fset;
    ClauseSet_p  cset;
 
+   StructFOFSpecResetSineIndices(ctrl);
+   PStackFree(ctrl->sine_indices);
+
    while(!PStackEmpty(ctrl->clause_sets))
    {
       cset = PStackPopP(ctrl->clause_sets);
@@ -513,6 +519,68 @@ void StructFOFSpecInitDistrib(StructFOFSpec_p ctrl)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: StructFOFSpecGetSineIndex()
+//
+//   Return the SinE index for gentype over all sets in ctrl. The
+//   index is created on first use and afterwards maintained by
+//   StructFOFSpecAddProblem() and StructFOFSpecBacktrackToSpec(), so
+//   that the library is only analyzed once. f_distrib has to be
+//   initialized.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+SineIndex_p StructFOFSpecGetSineIndex(StructFOFSpec_p ctrl,
+                                      GeneralityMeasure gentype)
+{
+   SineIndex_p   index;
+   PStackPointer i;
+
+   for(i=0; i<PStackGetSP(ctrl->sine_indices); i++)
+   {
+      index = PStackElementP(ctrl->sine_indices, i);
+      if(index->gentype == gentype)
+      {
+         SineIndexPushSets(index, ctrl->clause_sets, ctrl->formula_sets);
+         return index;
+      }
+   }
+   GenDistribSizeAdjust(ctrl->f_distrib, ctrl->sig);
+   index = SineIndexAlloc(ctrl->f_distrib, gentype);
+   SineIndexPushSets(index, ctrl->clause_sets, ctrl->formula_sets);
+   PStackPushP(ctrl->sine_indices, index);
+
+   return index;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StructFOFSpecResetSineIndices()
+//
+//   Drop all SinE indices. This is necessary if sets are removed
+//   other than via StructFOFSpecBacktrackToSpec().
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void StructFOFSpecResetSineIndices(StructFOFSpec_p ctrl)
+{
+   while(!PStackEmpty(ctrl->sine_indices))
+   {
+      SineIndexFree(PStackPopP(ctrl->sine_indices));
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ProofStateSinE()
@@ -18,6 +18,8 @@ Changes
 
 <1> Thu May 10 08:35:26 CEST 2012
     New
+<2> Mon Oct 19 17:21:05 CEST 2026
+    Persistent SinE indices
 
 -----------------------------------------------------------------------*/
 
@@ -47,6 +49,7 @@ typedef struct strtuctured_FOF_spec_cell
    StrTree_p     parsed_includes;
    PStackPointer shared_ax_sp;
    GenDistrib_p  f_distrib;
+   PStack_p      sine_indices; /* SineIndex_p, one per gen. measure */
 }StructFOFSpecCell, *StructFOFSpec_p;
 
 
@@ -66,6 +69,9 @@ long           StructFOFSpecParseAxioms(StructFOFSpec_p ctrl,
 #define       StructFOFSpecResetShared(ctrl) (ctrl)->shared_ax_sp = 0
 
 void           StructFOFSpecInitDistrib(StructFOFSpec_p ctrl);
+SineIndex_p    StructFOFSpecGetSineIndex(StructFOFSpec_p ctrl,
+                                         GeneralityMeasure gentype);
+void           StructFOFSpecResetSineIndices(StructFOFSpec_p ctrl);
 
 void StructFOFSpecAddProblem(StructFOFSpec_p ctrl,
                              ClauseSet_p clauses,
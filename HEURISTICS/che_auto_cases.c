@@ -7,7 +7,8 @@ Author: Stephan Schulz
 Contents
 
   Case distinction for auto mode, included by both auto heuristic
-  selection and auto ordering selection
+  selection and auto ordering selection. The table for the mode is
+  selected by the CHE_HEURISTICS_AUTO* define of the includer.
 
   Copyright 1998-2013 by the author.
   This code is released under the GNU General Public Licence and
@@ -19,61 +20,69 @@ Changes
 
 <1> Tue May  2 22:07:17 GMT 2000
     Extracted from che_heuristics.c
+<2> Tue Oct 20 03:41:09 CEST 2026
+    Select strategies from the tables in che_autotable.c.
 
 -----------------------------------------------------------------------*/
 
 
-{
-SpecFeaturesAddEval(spec, limits);
-if(OutputLevel)
-{
-   fprintf(GlobalOut, "# Problem is type ");
-   SpecTypePrint(GlobalOut, spec, DEFAULT_CLASS_MASK);
-   fputc('\n', GlobalOut);
-}
-if(false)
-{
-   assert(false);
-}
+
 #ifdef CHE_HEURISTICS_AUTO
-#include "che_X_____auto.c"
+#define AUTO_TABLE_NAME "Auto"
 #endif
 #ifdef CHE_HEURISTICS_AUTO_CASC
-#include "che_X_____auto_casc.c"
+#define AUTO_TABLE_NAME "AutoCASC"
 #endif
 #ifdef CHE_HEURISTICS_AUTO_DEV
-#include "che_X_____auto_dev.c"
+#define AUTO_TABLE_NAME "AutoDev"
 #endif
-
 #ifdef CHE_HEURISTICS_AUTO_SCHED0
-#include "che_X_auto_sched0.c"
+#define AUTO_TABLE_NAME "AutoSched0"
 #endif
 #ifdef CHE_HEURISTICS_AUTO_SCHED1
-#include "che_X_auto_sched1.c"
+#define AUTO_TABLE_NAME "AutoSched1"
 #endif
 #ifdef CHE_HEURISTICS_AUTO_SCHED2
-#include "che_X_auto_sched2.c"
+#define AUTO_TABLE_NAME "AutoSched2"
 #endif
 #ifdef CHE_HEURISTICS_AUTO_SCHED3
-#include "che_X_auto_sched3.c"
+#define AUTO_TABLE_NAME "AutoSched3"
 #endif
 #ifdef CHE_HEURISTICS_AUTO_SCHED4
-#include "che_X_auto_sched4.c"
+#define AUTO_TABLE_NAME "AutoSched4"
 #endif
 #ifdef CHE_HEURISTICS_AUTO_SCHED5
-#include "che_X_auto_sched5.c"
+#define AUTO_TABLE_NAME "AutoSched5"
 #endif
 #ifdef CHE_HEURISTICS_AUTO_SCHED6
-#include "che_X_auto_sched6.c"
+#define AUTO_TABLE_NAME "AutoSched6"
 #endif
 #ifdef CHE_HEURISTICS_AUTO_SCHED7
-#include "che_X_auto_sched7.c"
+#define AUTO_TABLE_NAME "AutoSched7"
 #endif
 
+{
+AutoStrategy_p auto_strat;
 
-
+SpecFeaturesAddEval(spec, limits);
+if(OutputLevel)
+{
+   fprintf(GlobalOut, "# Problem is type ");
+   SpecTypePrint(GlobalOut, spec, DEFAULT_CLASS_MASK);
+   fputc('\n', GlobalOut);
+}
+auto_strat = AutoTableSelect(AutoTableFind(AUTO_TABLE_NAME), spec);
+#ifdef CHE_HEURISTICS_INTERNAL
+res = auto_strat->name;
+AutoStrategySetHeuristicParms(auto_strat, &(control->heuristic_parms));
+#endif
+#ifdef TO_ORDERING_INTERNAL
+AutoStrategySetOrderParms(auto_strat, &oparms);
+#endif
 }
 
+#undef AUTO_TABLE_NAME
+
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
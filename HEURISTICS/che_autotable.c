@@ -0,0 +1,1171 @@
+/*-----------------------------------------------------------------------
+
+File  : che_autotable.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Table-driven selection of heuristic and ordering parameters for the
+  automatic modes.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 03:02:44 CEST 2026
+    New
+<2> Wed Oct 21 10:14:37 CEST 2026
+    Added AutoParmsAddAssignments()
+
+-----------------------------------------------------------------------*/
+
+#include "che_autotable.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+/* Types of fields that can be set by a strategy */
+
+typedef enum
+{
+   AFBool,
+   AFLong,
+   AFLitSel,
+   AFParamod,
+   AFACHandling,
+   AFRewriteLevel,
+   AFSplitClass,
+   AFSplitMethod,
+   AFOrdering,
+   AFWeightGen,
+   AFPrecGen
+}AutoFieldType;
+
+typedef struct auto_field_cell
+{
+   char          *name;
+   AutoFieldType type;
+   size_t        offset;
+}AutoFieldCell, *AutoField_p;
+
+#define HFIELD(field, type) \
+   {#field, type, offsetof(HeuristicParmsCell, field)}
+#define OFIELD(field, type) \
+   {#field, type, offsetof(OrderParmsCell, field)}
+
+static AutoFieldCell heuristic_fields[] =
+{
+   HFIELD(prefer_initial_clauses,        AFBool),
+   HFIELD(selection_strategy,            AFLitSel),
+   HFIELD(neg_lit_sel_min,               AFLong),
+   HFIELD(select_on_proc_only,           AFBool),
+   HFIELD(inherit_paramod_lit,           AFBool),
+   HFIELD(inherit_goal_pm_lit,           AFBool),
+   HFIELD(inherit_conj_pm_lit,           AFBool),
+   HFIELD(pm_type,                       AFParamod),
+   HFIELD(ac_handling,                   AFACHandling),
+   HFIELD(ac_res_aggressive,             AFBool),
+   HFIELD(forward_context_sr,            AFBool),
+   HFIELD(forward_context_sr_aggressive, AFBool),
+   HFIELD(backward_context_sr,           AFBool),
+   HFIELD(forward_demod,                 AFRewriteLevel),
+   HFIELD(prefer_general,                AFBool),
+   HFIELD(condensing,                    AFBool),
+   HFIELD(condensing_aggressive,         AFBool),
+   HFIELD(er_varlit_destructive,         AFBool),
+   HFIELD(er_strong_destructive,         AFBool),
+   HFIELD(er_aggressive,                 AFBool),
+   HFIELD(split_clauses,                 AFSplitClass),
+   HFIELD(split_method,                  AFSplitMethod),
+   HFIELD(split_aggressive,              AFBool),
+   HFIELD(split_fresh_defs,              AFBool),
+   HFIELD(use_tptp_sos,                  AFBool),
+   HFIELD(presat_interreduction,         AFBool),
+   {NULL, AFBool, 0}
+};
+
+static AutoFieldCell order_fields[] =
+{
+   OFIELD(ordertype,       AFOrdering),
+   OFIELD(to_weight_gen,   AFWeightGen),
+   OFIELD(to_prec_gen,     AFPrecGen),
+   OFIELD(no_lit_cmp,      AFBool),
+   OFIELD(to_const_weight, AFLong),
+   {NULL, AFBool, 0}
+};
+
+/* Values for enumerations without a name table of their own */
+
+static char* paramod_names[] =
+{
+   "Plain",        /* ParamodPlain */
+   "AlwaysSim",    /* ParamodAlwaysSim */
+   "OrientedSim",  /* ParamodOrientedSim */
+   NULL
+};
+
+static char* ac_handling_names[] =
+{
+   "None",           /* NoACHandling */
+   "DiscardAll",     /* ACDiscardAll */
+   "KeepUnits",      /* ACKeepUnits */
+   "KeepOrientable", /* ACKeepOrientable */
+   NULL
+};
+
+/* Possible values of each position of a class string, in the order
+   of SpecTypePrint(). The digit of a value in a class key is its
+   index+1, 0 is used for ignored positions, so a key is a 13 digit
+   base-5 number. Only 3*2*3*3*2*3*3*3*3*4*4*3*3 = 1259712 of these
+   are keys of complete classes. */
+
+static char* class_values[SPEC_CLASS_LEN] =
+{
+   "UHG",   /* Axioms unit, non-unit Horn, general */
+   "UH",    /* Goals unit, non-unit */
+   "NSP",   /* No, some, pure equality */
+   "FSM",   /* Non-ground positive units */
+   "NG",    /* Goals have variables, are ground */
+   "FSM",   /* Clauses */
+   "FSM",   /* Literals */
+   "SML",   /* Term cells */
+   "FSM",   /* Ground positive axioms */
+   "0123",  /* Maximal function symbol arity */
+   "0123",  /* Average function symbol arity */
+   "SML",   /* Sum of function symbol arities */
+   "SMD"    /* Maximal clause depth */
+};
+
+#define CLASS_EQ_POS   2
+#define CLASS_KEY_BASE 5
+
+/* Built-in tables */
+
+#define CHE_AUTOTABLE_INTERNAL
+
+static char builtin_auto[] =
+#include "che_X_____auto.c"
+   ;
+static char builtin_auto_casc[] =
+#include "che_X_____auto_casc.c"
+   ;
+static char builtin_auto_dev[] =
+#include "che_X_____auto_dev.c"
+   ;
+static char builtin_auto_sched0[] =
+#include "che_X_auto_sched0.c"
+   ;
+static char builtin_auto_sched1[] =
+#include "che_X_auto_sched1.c"
+   ;
+static char builtin_auto_sched2[] =
+#include "che_X_auto_sched2.c"
+   ;
+static char builtin_auto_sched3[] =
+#include "che_X_auto_sched3.c"
+   ;
+static char builtin_auto_sched4[] =
+#include "che_X_auto_sched4.c"
+   ;
+static char builtin_auto_sched5[] =
+#include "che_X_auto_sched5.c"
+   ;
+static char builtin_auto_sched6[] =
+#include "che_X_auto_sched6.c"
+   ;
+static char builtin_auto_sched7[] =
+#include "che_X_auto_sched7.c"
+   ;
+
+#undef CHE_AUTOTABLE_INTERNAL
+
+typedef struct builtin_table_cell
+{
+   char        *name;
+   char        *source;
+   AutoTable_p table;    /* Parsed on first use */
+}BuiltinTableCell;
+
+static BuiltinTableCell builtin_tables[] =
+{
+   {"Auto",       builtin_auto,        NULL},
+   {"AutoCASC",   builtin_auto_casc,   NULL},
+   {"AutoDev",    builtin_auto_dev,    NULL},
+   {"AutoSched0", builtin_auto_sched0, NULL},
+   {"AutoSched1", builtin_auto_sched1, NULL},
+   {"AutoSched2", builtin_auto_sched2, NULL},
+   {"AutoSched3", builtin_auto_sched3, NULL},
+   {"AutoSched4", builtin_auto_sched4, NULL},
+   {"AutoSched5", builtin_auto_sched5, NULL},
+   {"AutoSched6", builtin_auto_sched6, NULL},
+   {"AutoSched7", builtin_auto_sched7, NULL},
+   {NULL,         NULL,                NULL}
+};
+
+/* Tables read with AutoTableLoad() */
+
+static PStack_p loaded_tables = NULL;
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: spec_class_string()
+//
+//   Write the class of spec (as a string of SPEC_CLASS_LEN characters
+//   plus '\0') into class. Positions marked with '-' in mask are
+//   ignored. The values are defined by the Spec*() predicates used
+//   by generate_auto.py, which is not quite what SpecTypePrint()
+//   prints: Non-unit goals are 'H' and the empty clause set has pure
+//   equality.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void spec_class_string(SpecFeature_p spec, char* mask, char* class)
+{
+   class[0]  = SpecAxiomsAreUnit(spec)?'U':
+      (SpecAxiomsAreNonUnitHorn(spec)?'H':'G');
+   class[1]  = SpecGoalsAreUnit(spec)?'U':'H';
+   class[2]  = SpecPureEq(spec)?'P':(SpecSomeEq(spec)?'S':'N');
+   class[3]  = SpecFewNGPosUnits(spec)?'F':
+      (SpecSomeNGPosUnits(spec)?'S':'M');
+   class[4]  = SpecGoalsAreGround(spec)?'G':'N';
+   class[5]  = SpecFewAxioms(spec)?'F':(SpecSomeAxioms(spec)?'S':'M');
+   class[6]  = SpecFewLiterals(spec)?'F':(SpecSomeLiterals(spec)?'S':'M');
+   class[7]  = SpecSmallTerms(spec)?'S':(SpecMediumTerms(spec)?'M':'L');
+   class[8]  = SpecFewGroundPos(spec)?'F':(SpecSomeGroundPos(spec)?'S':'M');
+   class[9]  = SpecMaxFArity0(spec)?'0':(SpecMaxFArity1(spec)?'1':
+                                         (SpecMaxFArity2(spec)?'2':'3'));
+   class[10] = SpecAvgFArity0(spec)?'0':(SpecAvgFArity1(spec)?'1':
+                                         (SpecAvgFArity2(spec)?'2':'3'));
+   class[11] = SpecSmallFArSum(spec)?'S':(SpecMediumFArSum(spec)?'M':'L');
+   class[12] = SpecShallowMaxDepth(spec)?'S':
+      (SpecMediumMaxDepth(spec)?'M':'D');
+   class[SPEC_CLASS_LEN] = '\0';
+
+   for(int i=0; i<SPEC_CLASS_LEN; i++)
+   {
+      if(mask[i] == '-')
+      {
+         class[i] = '-';
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: class_bucket()
+//
+//   Return the hash bucket for key.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long class_bucket(AutoTable_p table, SpecClassKey key)
+{
+   unsigned long hash = key;
+
+   hash = (hash ^ (hash >> 11)) * 2654435761UL;
+   hash = hash ^ (hash >> 15);
+
+   return hash & table->bucket_mask;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: table_lookup()
+//
+//   Return the strategy for the class with the given key, or NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static AutoStrategy_p table_lookup(AutoTable_p table, SpecClassKey key)
+{
+   AutoClass_p handle;
+
+   for(handle = table->buckets[class_bucket(table, key)];
+       handle;
+       handle = handle->next)
+   {
+      if(handle->key == key)
+      {
+         return handle->strategy;
+      }
+   }
+   return NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: table_build_index()
+//
+//   Build the hash index of table from the classes collected in
+//   the class stack (alternating class key and strategy). If a class
+//   occurs more than once, the first entry wins.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void table_build_index(AutoTable_p table, PStack_p classes)
+{
+   long        size = 1, i, bucket;
+   AutoClass_p handle;
+
+   /* At least two buckets per class */
+   while(size < PStackGetSP(classes))
+   {
+      size = size*2;
+   }
+   table->bucket_mask = size-1;
+   table->buckets = SizeMalloc(size*sizeof(AutoClass_p));
+   for(i=0; i<size; i++)
+   {
+      table->buckets[i] = NULL;
+   }
+   table->class_no = 0;
+   for(i=0; i<PStackGetSP(classes); i+=2)
+   {
+      SpecClassKey key = PStackElementInt(classes, i);
+
+      if(table_lookup(table, key))
+      {
+         continue;
+      }
+      bucket = class_bucket(table, key);
+      handle = AutoClassCellAlloc();
+      handle->key      = key;
+      handle->strategy = PStackElementP(classes, i+1);
+      handle->next     = table->buckets[bucket];
+      table->buckets[bucket] = handle;
+      table->class_no++;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parse_value()
+//
+//   Parse the value of a field of the given type and return it (for
+//   literal selection functions, the name has been checked and is
+//   returned in *name).
+//
+// Global Variables: TONames, TOWeightGenNames, TOPrecGenNames
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long parse_value(Scanner_p in, AutoFieldType type, char** name)
+{
+   long res = -1;
+   char *id;
+
+   *name = NULL;
+   switch(type)
+   {
+   case AFLong:
+   case AFRewriteLevel:
+   case AFSplitClass:
+   case AFSplitMethod:
+         return ParseInt(in);
+   default:
+         break;
+   }
+   CheckInpTok(in, Identifier);
+   id = DStrView(AktToken(in)->literal);
+   switch(type)
+   {
+   case AFBool:
+         res = TestInpId(in, "true")?1:(TestInpId(in, "false")?0:-1);
+         break;
+   case AFLitSel:
+         if(GetLitSelFun(id))
+         {
+            *name = SecureStrdup(id);
+            res = 0;
+         }
+         break;
+   case AFParamod:
+         res = StringIndex(id, paramod_names);
+         break;
+   case AFACHandling:
+         res = StringIndex(id, ac_handling_names);
+         break;
+   case AFOrdering:
+         for(TermOrdering i=NoOrdering; i<=EMPTY; i++)
+         {
+            if(strcmp(id, TONames[i])==0)
+            {
+               res = i;
+               break;
+            }
+         }
+         break;
+   case AFWeightGen:
+         res = StringIndex(id, TOWeightGenNames);
+         break;
+   case AFPrecGen:
+         res = StringIndex(id, TOPrecGenNames);
+         break;
+   default:
+         assert(false);
+         break;
+   }
+   if(res == -1)
+   {
+      AktTokenError(in, "Unknown value", false);
+   }
+   NextToken(in);
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parse_parms()
+//
+//   Parse a list of <field>=<value> assignments for fields described
+//   by fields and return them as a stack of field index/value pairs.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static PStack_p parse_parms(Scanner_p in, AutoFieldCell fields[])
+{
+   PStack_p res = PStackAlloc();
+   long     i, value;
+   char     *name;
+
+   AcceptInpTok(in, OpenSquare);
+   while(!TestInpTok(in, CloseSquare))
+   {
+      CheckInpTok(in, Identifier);
+      for(i=0; fields[i].name; i++)
+      {
+         if(TestInpId(in, fields[i].name))
+         {
+            break;
+         }
+      }
+      if(!fields[i].name)
+      {
+         AktTokenError(in, "Unknown parameter", false);
+      }
+      NextToken(in);
+      AcceptInpTok(in, EqualSign);
+      value = parse_value(in, fields[i].type, &name);
+      PStackPushInt(res, i);
+      if(name)
+      {
+         PStackPushP(res, name);
+      }
+      else
+      {
+         PStackPushInt(res, value);
+      }
+      if(!TestInpTok(in, CloseSquare))
+      {
+         AcceptInpTok(in, Comma);
+      }
+   }
+   AcceptInpTok(in, CloseSquare);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parms_free()
+//
+//   Free a stack of field index/value pairs.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void parms_free(PStack_p parms, AutoFieldCell fields[])
+{
+   char *name;
+
+   for(long i=0; i<PStackGetSP(parms); i+=2)
+   {
+      if(fields[PStackElementInt(parms, i)].type == AFLitSel)
+      {
+         name = PStackElementP(parms, i+1);
+         FREE(name);
+      }
+   }
+   PStackFree(parms);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parms_apply()
+//
+//   Perform the assignments in parms on the structure at base.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes *base
+//
+/----------------------------------------------------------------------*/
+
+static void parms_apply(PStack_p parms, AutoFieldCell fields[], void* base)
+{
+   for(long i=0; i<PStackGetSP(parms); i+=2)
+   {
+      AutoField_p field = &(fields[PStackElementInt(parms, i)]);
+      void        *addr = (char*)base+field->offset;
+      long        value = PStackElementInt(parms, i+1);
+
+      switch(field->type)
+      {
+      case AFBool:
+            *(bool*)addr = value;
+            break;
+      case AFLong:
+            *(long*)addr = value;
+            break;
+      case AFLitSel:
+            *(LiteralSelectionFun*)addr =
+               GetLitSelFun(PStackElementP(parms, i+1));
+            break;
+      case AFParamod:
+            *(ParamodulationType*)addr = value;
+            break;
+      case AFACHandling:
+            *(ACHandlingType*)addr = value;
+            break;
+      case AFRewriteLevel:
+            *(RewriteLevel*)addr = value;
+            break;
+      case AFSplitClass:
+            *(SplitClassType*)addr = value;
+            break;
+      case AFSplitMethod:
+            *(SplitType*)addr = value;
+            break;
+      case AFOrdering:
+            *(TermOrdering*)addr = value;
+            break;
+      case AFWeightGen:
+            *(TOWeightGenMethod*)addr = value;
+            break;
+      case AFPrecGen:
+            *(TOPrecGenMethod*)addr = value;
+            break;
+      default:
+            assert(false);
+            break;
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parms_add_assignments()
+//
+//   Append the values of all fields described by fields in the
+//   structure at base to res, in the syntax of parse_parms().
+//
+// Global Variables: TONames, TOWeightGenNames, TOPrecGenNames
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void parms_add_assignments(DStr_p res, AutoFieldCell fields[],
+                                  void* base)
+{
+   DStrAppendChar(res, '[');
+   for(long i=0; fields[i].name; i++)
+   {
+      void *addr = (char*)base+fields[i].offset;
+
+      if(i)
+      {
+         DStrAppendChar(res, ',');
+      }
+      DStrAppendStr(res, fields[i].name);
+      DStrAppendChar(res, '=');
+      switch(fields[i].type)
+      {
+      case AFBool:
+            DStrAppendStr(res, *(bool*)addr?"true":"false");
+            break;
+      case AFLong:
+            DStrAppendInt(res, *(long*)addr);
+            break;
+      case AFLitSel:
+            DStrAppendStr(res, GetLitSelName(*(LiteralSelectionFun*)addr));
+            break;
+      case AFParamod:
+            DStrAppendStr(res, paramod_names[*(ParamodulationType*)addr]);
+            break;
+      case AFACHandling:
+            DStrAppendStr(res, ac_handling_names[*(ACHandlingType*)addr]);
+            break;
+      case AFRewriteLevel:
+            DStrAppendInt(res, *(RewriteLevel*)addr);
+            break;
+      case AFSplitClass:
+            DStrAppendInt(res, *(SplitClassType*)addr);
+            break;
+      case AFSplitMethod:
+            DStrAppendInt(res, *(SplitType*)addr);
+            break;
+      case AFOrdering:
+            DStrAppendStr(res, TONames[*(TermOrdering*)addr]);
+            break;
+      case AFWeightGen:
+            DStrAppendStr(res, TOWeightGenNames[*(TOWeightGenMethod*)addr]);
+            break;
+      case AFPrecGen:
+            DStrAppendStr(res, TOPrecGenNames[*(TOPrecGenMethod*)addr]);
+            break;
+      default:
+            assert(false);
+            break;
+      }
+   }
+   DStrAppendChar(res, ']');
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parse_strategy()
+//
+//   Parse the heuristic name and parameters of a strategy (the part
+//   shared by strategy() and default() entries).
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static AutoStrategy_p parse_strategy(Scanner_p in, long order)
+{
+   AutoStrategy_p handle = AutoStrategyCellAlloc();
+
+   CheckInpTok(in, Identifier);
+   handle->name  = DStrCopy(AktToken(in)->literal);
+   handle->order = order;
+   NextToken(in);
+   AcceptInpTok(in, Comma);
+   handle->hparms = parse_parms(in, heuristic_fields);
+   AcceptInpTok(in, Comma);
+   handle->oparms = parse_parms(in, order_fields);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: strategy_free()
+//
+//   Free a strategy.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void strategy_free(AutoStrategy_p junk)
+{
+   FREE(junk->name);
+   parms_free(junk->hparms, heuristic_fields);
+   parms_free(junk->oparms, order_fields);
+   AutoStrategyCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: parse_classes()
+//
+//   Parse a list of classes for strat and push them (with strat)
+//   onto classes. Sets the mask of the table from the first class,
+//   all others have to agree with it.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void parse_classes(Scanner_p in, AutoTable_p table,
+                          AutoStrategy_p strat, PStack_p classes)
+{
+   char         class[SPEC_CLASS_LEN+1];
+   char         *lit;
+   SpecClassKey key;
+   int          i;
+
+   AcceptInpTok(in, OpenSquare);
+   while(!TestInpTok(in, CloseSquare))
+   {
+      CheckInpTok(in, String);
+      lit = DStrView(AktToken(in)->literal);
+      /* The literal includes the quotes */
+      if(strlen(lit) != SPEC_CLASS_LEN+2)
+      {
+         AktTokenError(in, "Malformed problem class", false);
+      }
+      strncpy(class, lit+1, SPEC_CLASS_LEN);
+      class[SPEC_CLASS_LEN] = '\0';
+      key = SpecClassKeyParse(class);
+      if(key == -1)
+      {
+         AktTokenError(in, "Malformed problem class", false);
+      }
+      if(!PStackEmpty(classes))
+      {
+         for(i=0; i<SPEC_CLASS_LEN; i++)
+         {
+            if((class[i]=='-') != (table->mask[i]=='-'))
+            {
+               AktTokenError(in, "Problem class uses different features "
+                             "than the previous ones", false);
+            }
+         }
+      }
+      else
+      {
+         for(i=0; i<SPEC_CLASS_LEN; i++)
+         {
+            table->mask[i] = (class[i]=='-')?'-':'a';
+         }
+      }
+      PStackPushInt(classes, key);
+      PStackPushP(classes, strat);
+      NextToken(in);
+      if(!TestInpTok(in, CloseSquare))
+      {
+         AcceptInpTok(in, Comma);
+      }
+   }
+   AcceptInpTok(in, CloseSquare);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: SpecClassKeyCompute()
+//
+//   Return the class key of spec (which has to be evaluated with
+//   SpecFeaturesAddEval()), ignoring the positions marked with '-'
+//   in mask.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+SpecClassKey SpecClassKeyCompute(SpecFeature_p spec, char* mask)
+{
+   char class[SPEC_CLASS_LEN+1];
+
+   spec_class_string(spec, mask, class);
+   return SpecClassKeyParse(class);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SpecClassKeyParse()
+//
+//   Return the key of a class given as a string (see
+//   SpecTypePrint()), or -1 if the string is not a valid class.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+SpecClassKey SpecClassKeyParse(char* class)
+{
+   SpecClassKey res = 0;
+   char         *pos;
+   int          i;
+
+   if(strlen(class) != SPEC_CLASS_LEN)
+   {
+      return -1;
+   }
+   for(i=0; i<SPEC_CLASS_LEN; i++)
+   {
+      res = res*CLASS_KEY_BASE;
+      if(class[i] == '-')
+      {
+         continue;
+      }
+      pos = strchr(class_values[i], class[i]);
+      if(!pos || !class[i])
+      {
+         return -1;
+      }
+      res += (pos-class_values[i])+1;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableParse()
+//
+//   Parse an auto mode table.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+AutoTable_p AutoTableParse(Scanner_p in)
+{
+   AutoTable_p    table = AutoTableCellAlloc();
+   PStack_p       classes = PStackAlloc();
+   AutoStrategy_p strat;
+
+   table->dflt       = NULL;
+   table->strategies = PStackAlloc();
+   memset(table->mask, '-', SPEC_CLASS_LEN);
+   table->mask[SPEC_CLASS_LEN] = '\0';
+
+   AcceptInpId(in, "auto_table");
+   AcceptInpTok(in, OpenBracket);
+   CheckInpTok(in, Identifier);
+   table->name = DStrCopy(AktToken(in)->literal);
+   NextToken(in);
+   AcceptInpTok(in, CloseBracket);
+   AcceptInpTok(in, Fullstop);
+
+   while(TestInpId(in, "strategy"))
+   {
+      NextToken(in);
+      AcceptInpTok(in, OpenBracket);
+      strat = parse_strategy(in, PStackGetSP(table->strategies));
+      PStackPushP(table->strategies, strat);
+      AcceptInpTok(in, Comma);
+      parse_classes(in, table, strat, classes);
+      AcceptInpTok(in, CloseBracket);
+      AcceptInpTok(in, Fullstop);
+   }
+   AcceptInpId(in, "default");
+   AcceptInpTok(in, OpenBracket);
+   table->dflt = parse_strategy(in, PStackGetSP(table->strategies));
+   AcceptInpTok(in, CloseBracket);
+   AcceptInpTok(in, Fullstop);
+
+   table_build_index(table, classes);
+   PStackFree(classes);
+
+   return table;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableFree()
+//
+//   Free an auto mode table.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void AutoTableFree(AutoTable_p junk)
+{
+   AutoClass_p handle;
+   long i;
+
+   for(i=0; i<=junk->bucket_mask; i++)
+   {
+      while((handle = junk->buckets[i]))
+      {
+         junk->buckets[i] = handle->next;
+         AutoClassCellFree(handle);
+      }
+   }
+   SizeFree(junk->buckets, (junk->bucket_mask+1)*sizeof(AutoClass_p));
+   while(!PStackEmpty(junk->strategies))
+   {
+      strategy_free(PStackPopP(junk->strategies));
+   }
+   PStackFree(junk->strategies);
+   strategy_free(junk->dflt);
+   FREE(junk->name);
+   AutoTableCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableSelect()
+//
+//   Return the strategy selected by table for the problem described
+//   by spec (which has to be evaluated with SpecFeaturesAddEval()).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+AutoStrategy_p AutoTableSelect(AutoTable_p table, SpecFeature_p spec)
+{
+   char           class[SPEC_CLASS_LEN+1];
+   AutoStrategy_p res, alt;
+
+   spec_class_string(spec, table->mask, class);
+   res = table_lookup(table, SpecClassKeyParse(class));
+
+   if(SpecNoEq(spec) && class[CLASS_EQ_POS] == 'P')
+   {
+      /* The empty clause set has both no and pure equality - the
+         first matching strategy wins. */
+      class[CLASS_EQ_POS] = 'N';
+      alt = table_lookup(table, SpecClassKeyParse(class));
+      if(alt && (!res || alt->order < res->order))
+      {
+         res = alt;
+      }
+   }
+   return res?res:table->dflt;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoStrategySetHeuristicParms()
+//
+//   Set the heuristic parameters given by strat in parms.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes parms
+//
+/----------------------------------------------------------------------*/
+
+void AutoStrategySetHeuristicParms(AutoStrategy_p strat,
+                                   HeuristicParms_p parms)
+{
+   parms_apply(strat->hparms, heuristic_fields, parms);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoStrategySetOrderParms()
+//
+//   Set the ordering parameters given by strat in oparms.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes oparms
+//
+/----------------------------------------------------------------------*/
+
+void AutoStrategySetOrderParms(AutoStrategy_p strat, OrderParms_p oparms)
+{
+   parms_apply(strat->oparms, order_fields, oparms);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoParmsAddAssignments()
+//
+//   Append the values of all fields a strategy can set in hparms
+//   and oparms to res, as the two assignment lists of a table
+//   entry.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void AutoParmsAddAssignments(DStr_p res, HeuristicParms_p hparms,
+                             OrderParms_p oparms)
+{
+   parms_add_assignments(res, heuristic_fields, hparms);
+   DStrAppendStr(res, ", ");
+   parms_add_assignments(res, order_fields, oparms);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableLoad()
+//
+//   Read the table from the named file. It replaces the built-in (or
+//   previously loaded) table of the same name.
+//
+// Global Variables: loaded_tables
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+void AutoTableLoad(char* name)
+{
+   Scanner_p   in = CreateScanner(StreamTypeFile, name, true, NULL);
+   AutoTable_p table = AutoTableParse(in);
+
+   CheckInpTok(in, NoToken);
+   DestroyScanner(in);
+
+   if(!loaded_tables)
+   {
+      loaded_tables = PStackAlloc();
+   }
+   PStackPushP(loaded_tables, table);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTableFind()
+//
+//   Return the table with the given name, or NULL. Tables read with
+//   AutoTableLoad() take precedence over the built-in ones (and later
+//   ones over earlier ones).
+//
+// Global Variables: loaded_tables, builtin_tables
+//
+// Side Effects    : May parse a built-in table
+//
+/----------------------------------------------------------------------*/
+
+AutoTable_p AutoTableFind(char* name)
+{
+   AutoTable_p table;
+   Scanner_p   in;
+   long        i;
+
+   if(loaded_tables)
+   {
+      for(i=PStackGetSP(loaded_tables)-1; i>=0; i--)
+      {
+         table = PStackElementP(loaded_tables, i);
+         if(strcmp(table->name, name)==0)
+         {
+            return table;
+         }
+      }
+   }
+   for(i=0; builtin_tables[i].name; i++)
+   {
+      if(strcmp(builtin_tables[i].name, name)==0)
+      {
+         if(!builtin_tables[i].table)
+         {
+            in = CreateScanner(StreamTypeInternalString,
+                               builtin_tables[i].source, true, NULL);
+            builtin_tables[i].table = AutoTableParse(in);
+            CheckInpTok(in, NoToken);
+            DestroyScanner(in);
+         }
+         return builtin_tables[i].table;
+      }
+   }
+   return NULL;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: AutoTablesFree()
+//
+//   Free all loaded and parsed built-in tables.
+//
+// Global Variables: loaded_tables, builtin_tables
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void AutoTablesFree(void)
+{
+   long i;
+
+   if(loaded_tables)
+   {
+      while(!PStackEmpty(loaded_tables))
+      {
+         AutoTableFree(PStackPopP(loaded_tables));
+      }
+      PStackFree(loaded_tables);
+      loaded_tables = NULL;
+   }
+   for(i=0; builtin_tables[i].name; i++)
+   {
+      if(builtin_tables[i].table)
+      {
+         AutoTableFree(builtin_tables[i].table);
+         builtin_tables[i].table = NULL;
+      }
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
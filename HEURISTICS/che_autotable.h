@@ -0,0 +1,134 @@
+/*-----------------------------------------------------------------------
+
+File  : che_autotable.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Table-driven selection of heuristic and ordering parameters for the
+  automatic modes. A table maps problem classes (as printed by
+  SpecTypePrint(), with '-' for features ignored by the table) to
+  strategies, i.e. a heuristic name and a list of assignments to
+  HeuristicParmsCell and OrderParmsCell fields. Classes are hashed by
+  a compact integer key.
+
+  Tables are written as
+
+  auto_table(<name>).
+  strategy(<heuristic>, [<field>=<value>,...], [<field>=<value>,...],
+           ["<class>", ...]).
+  ...
+  default(<heuristic>, [<field>=<value>,...], [<field>=<value>,...]).
+
+  The tables for the built-in auto modes are compiled in (from the
+  che_X_*auto*.c files), tables read with AutoTableLoad() replace the
+  built-in table of the same name.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 03:02:44 CEST 2026
+    New
+<2> Wed Oct 21 10:14:37 CEST 2026
+    Added AutoParmsAddAssignments()
+
+-----------------------------------------------------------------------*/
+
+#ifndef CHE_AUTOTABLE
+
+#define CHE_AUTOTABLE
+
+#include <che_to_autoselect.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Length of a class string (see SpecTypePrint()) */
+
+#define SPEC_CLASS_LEN 13
+
+/* Compact class key - the class string as a base-5 number, with
+   digit 0 for ignored positions and 1-4 for the possible values.
+   There are 1259712 complete classes. AutoTableSelect() also treats
+   the empty clause set (which has both no and pure equality) as a
+   case of its own, so it distinguishes 1679616 feature
+   combinations. */
+
+typedef long SpecClassKey;
+
+typedef struct auto_strategy_cell
+{
+   char     *name;      /* Heuristic, as defined in che_proofcontrol.c */
+   long     order;      /* Position in the table */
+   PStack_p hparms;     /* Field index/value pairs */
+   PStack_p oparms;
+}AutoStrategyCell, *AutoStrategy_p;
+
+typedef struct auto_class_cell
+{
+   SpecClassKey            key;
+   AutoStrategy_p          strategy;
+   struct auto_class_cell* next;
+}AutoClassCell, *AutoClass_p;
+
+typedef struct auto_table_cell
+{
+   char           *name;
+   char           mask[SPEC_CLASS_LEN+1];
+   AutoStrategy_p dflt;
+   PStack_p       strategies;
+   long           class_no;
+   long           bucket_mask;
+   AutoClass_p    *buckets;
+}AutoTableCell, *AutoTable_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define AutoStrategyCellAlloc() \
+   (AutoStrategyCell*)SizeMalloc(sizeof(AutoStrategyCell))
+#define AutoStrategyCellFree(junk) \
+   SizeFree(junk, sizeof(AutoStrategyCell))
+#define AutoClassCellAlloc() \
+   (AutoClassCell*)SizeMalloc(sizeof(AutoClassCell))
+#define AutoClassCellFree(junk) \
+   SizeFree(junk, sizeof(AutoClassCell))
+#define AutoTableCellAlloc() \
+   (AutoTableCell*)SizeMalloc(sizeof(AutoTableCell))
+#define AutoTableCellFree(junk) \
+   SizeFree(junk, sizeof(AutoTableCell))
+
+SpecClassKey   SpecClassKeyCompute(SpecFeature_p spec, char* mask);
+SpecClassKey   SpecClassKeyParse(char* class);
+
+AutoTable_p    AutoTableParse(Scanner_p in);
+void           AutoTableFree(AutoTable_p junk);
+AutoStrategy_p AutoTableSelect(AutoTable_p table, SpecFeature_p spec);
+
+void           AutoStrategySetHeuristicParms(AutoStrategy_p strat,
+                                             HeuristicParms_p parms);
+void           AutoStrategySetOrderParms(AutoStrategy_p strat,
+                                         OrderParms_p oparms);
+void           AutoParmsAddAssignments(DStr_p res,
+                                       HeuristicParms_p hparms,
+                                       OrderParms_p oparms);
+
+void           AutoTableLoad(char* name);
+AutoTable_p    AutoTableFind(char* name);
+void           AutoTablesFree(void);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
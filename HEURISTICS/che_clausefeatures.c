@@ -514,11 +514,11 @@ void ClausePropInfoPrint(FILE* out, Clause_p clause)
            "#    ...positive: %6d\n"
            "#    ...negative: %6d\n",
       (long)ClauseStandardWeight(clause),
-      (long)ClauseSymTypeWeight(clause, 1,1,1,1,1,1,1),
-      (long)ClauseSymTypeWeight(clause, 1,1,1,0,1,0,0),
-      (long)ClauseSymTypeWeight(clause, 1,1,1,1,0,0,0),
-      (long)ClauseSymTypeWeight(clause, 1,1,1,0,0,1,0),
-      (long)ClauseSymTypeWeight(clause, 1,1,1,0,0,0,1),
+      (long)ClauseSymTypeWeight(clause, 1,1,1,1,1,1,1, NULL),
+      (long)ClauseSymTypeWeight(clause, 1,1,1,0,1,0,0, NULL),
+      (long)ClauseSymTypeWeight(clause, 1,1,1,1,0,0,0, NULL),
+      (long)ClauseSymTypeWeight(clause, 1,1,1,0,0,1,0, NULL),
+      (long)ClauseSymTypeWeight(clause, 1,1,1,0,0,0,1, NULL),
       ClauseDepth(clause),
       ClauseLiteralNumber(clause),
       clause->pos_lit_no,
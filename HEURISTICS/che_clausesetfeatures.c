@@ -535,28 +535,26 @@ double ClauseSetNonGoundAxiomPart(ClauseSet_p set)
 
 /*-----------------------------------------------------------------------
 //
-// Function: ClauseSetCollectArityInformation()
+// Function: arity_info_from_distribution()
 //
-//   Collect information about the arities of function and predicate
-//   symbol arities. Average and sum for function symbols does not
-//   include constants, it does for predicate symbols. Equality is not
-//   counted, Returns number of function symbol constants.
+//   Evaluate a symbol distribution as described for
+//   ClauseSetCollectArityInformation() below.
 //
 // Global Variables: -
 //
-// Side Effects    : Memory operations
+// Side Effects    : -
 //
 /----------------------------------------------------------------------*/
 
-long ClauseSetCollectArityInformation(ClauseSet_p set, Sig_p sig,
-                                      int *max_fun_arity,
-                                      int *avg_fun_arity,
-                                      int *sum_fun_arity,
-                                      int *max_pred_arity,
-                                      int *avg_pred_arity,
-                                      int *sum_pred_arity,
-                                      int *non_const_funs,
-                                      int *non_const_preds)
+static long arity_info_from_distribution(Sig_p sig, long *dist_array,
+                                         int *max_fun_arity,
+                                         int *avg_fun_arity,
+                                         int *sum_fun_arity,
+                                         int *max_pred_arity,
+                                         int *avg_pred_arity,
+                                         int *sum_pred_arity,
+                                         int *non_const_funs,
+                                         int *non_const_preds)
 {
    int max_f_arity = 0,
       sum_f_arity = 0,
@@ -566,16 +564,8 @@ long ClauseSetCollectArityInformation(ClauseSet_p set, Sig_p sig,
    int max_p_arity = 0,
       sum_p_arity = 0,
       p_count = 0;
-   long  array_size = sizeof(long)*(sig->f_count+1);
-   long *dist_array = SizeMalloc(array_size);
    FunCode i;
 
-   for(i=1; i<= sig->f_count; i++)
-   {
-      dist_array[i] = 0;
-   }
-   ClauseSetAddSymbolDistribution(set, dist_array);
-
    for(i=1; i<= sig->f_count; i++)
    {
       if(!SigIsSpecial(sig, i)&&dist_array[i])
@@ -606,7 +596,6 @@ long ClauseSetCollectArityInformation(ClauseSet_p set, Sig_p sig,
          }
       }
    }
-   SizeFree(dist_array, array_size);
 
    *max_fun_arity   = max_f_arity;
    *avg_fun_arity   = f_count?sum_f_arity/f_count:0;
@@ -621,6 +610,52 @@ long ClauseSetCollectArityInformation(ClauseSet_p set, Sig_p sig,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ClauseSetCollectArityInformation()
+//
+//   Collect information about the arities of function and predicate
+//   symbol arities. Average and sum for function symbols does not
+//   include constants, it does for predicate symbols. Equality is not
+//   counted, Returns number of function symbol constants.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long ClauseSetCollectArityInformation(ClauseSet_p set, Sig_p sig,
+                                      int *max_fun_arity,
+                                      int *avg_fun_arity,
+                                      int *sum_fun_arity,
+                                      int *max_pred_arity,
+                                      int *avg_pred_arity,
+                                      int *sum_pred_arity,
+                                      int *non_const_funs,
+                                      int *non_const_preds)
+{
+   long  array_size = sizeof(long)*(sig->f_count+1);
+   long *dist_array = SizeMalloc(array_size);
+   long  c_count;
+   FunCode i;
+
+   for(i=1; i<= sig->f_count; i++)
+   {
+      dist_array[i] = 0;
+   }
+   ClauseSetAddSymbolDistribution(set, dist_array);
+   c_count = arity_info_from_distribution(sig, dist_array,
+                                          max_fun_arity, avg_fun_arity,
+                                          sum_fun_arity, max_pred_arity,
+                                          avg_pred_arity, sum_pred_arity,
+                                          non_const_funs, non_const_preds);
+   SizeFree(dist_array, array_size);
+
+   return c_count;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: ClauseSetCountMaximalTerms()
@@ -883,63 +918,191 @@ long ClauseSetMaxLiteralNumber(ClauseSet_p set)
 }
 
 
+#ifndef NDEBUG
+
+/*-----------------------------------------------------------------------
+//
+// Function: spec_features_check()
+//
+//   Check the counts computed by SpecFeaturesCompute() against the
+//   individual ClauseSet*() functions. Only used in assertions.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static bool spec_features_check(SpecFeature_p features, ClauseSet_p set,
+                                Sig_p sig)
+{
+   SpecFeatureCell ref;
+   long tmp = 0, count = 0;
+
+   ref.clause_max_depth = 0;
+   ClauseSetTPTPDepthInfoAdd(set, &(ref.clause_max_depth), &tmp, &count);
+   ref.fun_const_count =
+      ClauseSetCollectArityInformation(set, sig,
+                                       &(ref.max_fun_arity),
+                                       &(ref.avg_fun_arity),
+                                       &(ref.sum_fun_arity),
+                                       &(ref.max_pred_arity),
+                                       &(ref.avg_pred_arity),
+                                       &(ref.sum_pred_arity),
+                                       &(ref.fun_nonconst_count),
+                                       &(ref.pred_nonconst_count));
+
+   return
+      features->goals            == ClauseSetCountGoals(set) &&
+      features->term_cells       == ClauseSetTermCells(set) &&
+      features->clause_max_depth == ref.clause_max_depth &&
+      features->clause_avg_depth == (count?tmp/count:0) &&
+      features->unit             == ClauseSetCountUnit(set) &&
+      features->unitgoals        == ClauseSetCountUnitGoals(set) &&
+      features->horn             == ClauseSetCountHorn(set) &&
+      features->horngoals        == ClauseSetCountHornGoals(set) &&
+      features->eq_clauses       == ClauseSetCountEquational(set) &&
+      features->peq_clauses      == ClauseSetCountPureEquational(set) &&
+      features->groundunitaxioms == ClauseSetCountGroundUnitAxioms(set) &&
+      features->groundgoals      == ClauseSetCountGroundGoals(set) &&
+      features->positiveaxioms   == ClauseSetCountPositiveAxioms(set) &&
+      features->groundpositiveaxioms ==
+         ClauseSetCountGroundPositiveAxioms(set) &&
+      features->fun_const_count     == ref.fun_const_count &&
+      features->max_fun_arity       == ref.max_fun_arity &&
+      features->avg_fun_arity       == ref.avg_fun_arity &&
+      features->sum_fun_arity       == ref.sum_fun_arity &&
+      features->max_pred_arity      == ref.max_pred_arity &&
+      features->avg_pred_arity      == ref.avg_pred_arity &&
+      features->sum_pred_arity      == ref.sum_pred_arity &&
+      features->fun_nonconst_count  == ref.fun_nonconst_count &&
+      features->pred_nonconst_count == ref.pred_nonconst_count;
+}
+
+#endif
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: SpecFeaturesCompute()
 //
-//   Compute all relevant features for a set of clauses.
+//   Compute all relevant features for a set of clauses. All counts
+//   are collected in a single traversal of the set, the results are
+//   the same as those of the individual ClauseSet*() functions
+//   above.
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Memory operations
 //
 /----------------------------------------------------------------------*/
 
 void SpecFeaturesCompute(SpecFeature_p features, ClauseSet_p set,
                          Sig_p sig)
 {
-   long tmp, count;
-
-   features->clauses          = set->members;
-   features->goals            = ClauseSetCountGoals(set);
-   features->axioms           = features->clauses-features->goals;
-
-   features->literals         = set->literals;
-   features->term_cells       = ClauseSetTermCells(set);
+   long     depthsum = 0, depthcount = 0;
+   long     array_size = sizeof(long)*(sig->f_count+1);
+   long     *dist_array = SizeMalloc(array_size);
+   bool     goal, unit, horn, demod, positive, ground;
+   FunCode  i;
+   Clause_p handle;
 
-   tmp = 0;
-   count = 0;
-   features->clause_max_depth = 0;
-   ClauseSetTPTPDepthInfoAdd(set,
-                             &(features->clause_max_depth),
-                             &tmp,
-                             &count);
-   features->clause_avg_depth = count?tmp/count:0;
+   for(i=1; i<= sig->f_count; i++)
+   {
+      dist_array[i] = 0;
+   }
+   features->clauses              = set->members;
+   features->literals             = set->literals;
+   features->goals                = 0;
+   features->term_cells           = 0;
+   features->clause_max_depth     = 0;
+   features->unit                 = 0;
+   features->unitgoals            = 0;
+   features->horn                 = 0;
+   features->horngoals            = 0;
+   features->eq_clauses           = 0;
+   features->peq_clauses          = 0;
+   features->groundunitaxioms     = 0;
+   features->groundgoals          = 0;
+   features->positiveaxioms       = 0;
+   features->groundpositiveaxioms = 0;
 
-   features->unit             = ClauseSetCountUnit(set);
-   features->unitgoals        = ClauseSetCountUnitGoals(set);
+   for(handle = set->anchor->succ; handle!=set->anchor; handle =
+          handle->succ)
+   {
+      goal     = ClauseIsGoal(handle);
+      unit     = ClauseIsUnit(handle);
+      horn     = ClauseIsHorn(handle);
+      demod    = ClauseIsDemodulator(handle);
+      positive = ClauseIsPositive(handle);
+      ground   = (goal||demod||positive) && ClauseIsGround(handle);
+
+      features->term_cells += ClauseWeight(handle, 1, 1, 1, 1, 1, false);
+      ClauseTPTPDepthInfoAdd(handle, &(features->clause_max_depth),
+                             &depthsum, &depthcount);
+      ClauseAddSymbolDistribution(handle, dist_array);
+      if(goal)
+      {
+         features->goals++;
+         if(unit)
+         {
+            features->unitgoals++;
+         }
+         if(horn)
+         {
+            features->horngoals++;
+         }
+         if(ground)
+         {
+            features->groundgoals++;
+         }
+      }
+      if(unit)
+      {
+         features->unit++;
+      }
+      if(horn)
+      {
+         features->horn++;
+      }
+      if(ClauseIsEquational(handle))
+      {
+         features->eq_clauses++;
+      }
+      if(ClauseIsPureEquational(handle))
+      {
+         features->peq_clauses++;
+      }
+      if(demod && ground)
+      {
+         features->groundunitaxioms++;
+      }
+      if(positive)
+      {
+         features->positiveaxioms++;
+         if(ground)
+         {
+            features->groundpositiveaxioms++;
+         }
+      }
+   }
+   features->axioms           = features->clauses-features->goals;
+   features->clause_avg_depth = depthcount?depthsum/depthcount:0;
    features->unitaxioms       = features->unit-features->unitgoals;
-
-   features->horn             = ClauseSetCountHorn(set);
-   features->horngoals        = ClauseSetCountHornGoals(set);
    features->hornaxioms       = features->horn-features->horngoals;
 
-   features->eq_clauses       = ClauseSetCountEquational(set);
-   features->peq_clauses      = ClauseSetCountPureEquational(set);
-   features->groundunitaxioms = ClauseSetCountGroundUnitAxioms(set);
-   features->groundgoals      = ClauseSetCountGroundGoals(set);
-   features->positiveaxioms   = ClauseSetCountPositiveAxioms(set);
-   features->groundpositiveaxioms = ClauseSetCountGroundPositiveAxioms(set);
    features->fun_const_count   =
-      ClauseSetCollectArityInformation(set, sig,
-                                       &(features->max_fun_arity),
-                                       &(features->avg_fun_arity),
-                                       &(features->sum_fun_arity),
-                                       &(features->max_pred_arity),
-                                       &(features->avg_pred_arity),
-                                       &(features->sum_pred_arity),
-                                       &(features->fun_nonconst_count),
-                                       &(features->pred_nonconst_count));
+      arity_info_from_distribution(sig, dist_array,
+                                   &(features->max_fun_arity),
+                                   &(features->avg_fun_arity),
+                                   &(features->sum_fun_arity),
+                                   &(features->max_pred_arity),
+                                   &(features->avg_pred_arity),
+                                   &(features->sum_pred_arity),
+                                   &(features->fun_nonconst_count),
+                                   &(features->pred_nonconst_count));
+   SizeFree(dist_array, array_size);
+   assert(spec_features_check(features, set, sig));
 
    features->goals_are_ground = (features->groundgoals ==
                                  features->goals);
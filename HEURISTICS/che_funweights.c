@@ -333,6 +333,7 @@ FunWeightParam_p FunWeightParamAlloc(void)
    res->fweights     = NULL;
    res->flimit       = 0;
    res->f_occur      = NULL;
+   res->wcache       = WeightCacheAlloc();
 
    return res;
 }
@@ -375,6 +376,7 @@ void FunWeightParamFree(FunWeightParam_p junk)
    {
       PDArrayFree(junk->f_occur);
    }
+   WeightCacheFree(junk->wcache);
    FunWeightParamCellFree(junk);
 }
 
@@ -1141,7 +1143,8 @@ double GenericFunWeightCompute(void* data, Clause_p clause)
                           local->vweight,
                           local->flimit,
                           local->fweights,
-                          local->fweight);
+                          local->fweight,
+                          local->wcache);
 }
 
 
@@ -80,6 +80,9 @@ typedef struct funweightparamcell
     * multiple  (expensive for large signatures) initializations. */
    PDArray_p f_occur;
 
+   /* Weights of shared terms under fweights */
+   WeightCache_p wcache;
+
 }FunWeightParamCell, *FunWeightParam_p;
 
 
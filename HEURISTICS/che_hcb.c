@@ -18,6 +18,8 @@ Changes
 
 <1> Fri Oct 16 14:52:53 MET DST 1998
     New
+<2> Tue Oct 20 18:12:40 CEST 2026
+    HCBClauseReevaluate()
 
 -----------------------------------------------------------------------*/
 
@@ -101,6 +103,7 @@ void HeuristicParmsInitialize(HeuristicParms_p handle)
    handle->to_const_weight               = WConstNoWeight;
    handle->to_defs_min                   = false;
    handle->no_lit_cmp                    = false;
+   handle->order_jobs                    = 1;
 
    handle->selection_strategy            = SelectNoLiterals;
    handle->pos_lit_sel_min               = 0;
@@ -315,13 +318,35 @@ long HCBAddWFCB(HCB_p hcb, WFCB_p wfcb, long steps)
 /----------------------------------------------------------------------*/
 
 void HCBClauseEvaluate(HCB_p hcb, Clause_p clause)
+{
+   assert(clause->evaluations == NULL);
+   ClauseAddEvalCell(clause, EvalsAlloc(hcb->wfcb_no));
+   HCBClauseReevaluate(hcb, clause);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: HCBClauseReevaluate()
+//
+//   Given a HCB-Block, recompute the evaluations of the given clause
+//   in its existing evaluation cell. The cell must not be in any
+//   evaluation tree, and its FIFO counter is not changed.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes evaluations, by eval functions
+//
+/----------------------------------------------------------------------*/
+
+void HCBClauseReevaluate(HCB_p hcb, Clause_p clause)
 {
    long i;
    bool empty;
 
    PERF_CTR_ENTRY(ClauseEvalTimer);
-   assert(clause->evaluations == NULL);
-   ClauseAddEvalCell(clause, EvalsAlloc(hcb->wfcb_no));
+   assert(clause->evaluations);
+   assert(clause->evaluations->eval_no == hcb->wfcb_no);
 
    empty = ClauseIsSemFalse(clause);
    for(i=0; i< hcb->wfcb_no; i++)
@@ -21,6 +21,8 @@ Changes
     New
 <2> Wed Dec 16 23:17:21 MET 1998
     Integrate HeuristicParms stuff
+<3> Tue Oct 20 18:12:40 CEST 2026
+    HCBClauseReevaluate()
 
 -----------------------------------------------------------------------*/
 
@@ -73,6 +75,7 @@ typedef struct heuristic_parms_cell
    long                to_const_weight;
    bool                to_defs_min;
    bool                no_lit_cmp;
+   long                order_jobs;
 
    /* Elements controling literal selection */
    LiteralSelectionFun selection_strategy;
@@ -220,6 +223,7 @@ HCB_p    HCBAlloc(void);
 void     HCBFree(HCB_p junk);
 long     HCBAddWFCB(HCB_p hcb, WFCB_p wfcb, long steps);
 void     HCBClauseEvaluate(HCB_p hcb, Clause_p clause);
+void     HCBClauseReevaluate(HCB_p hcb, Clause_p clause);
 Clause_p HCBStandardClauseSelect(HCB_p hcb, ClauseSet_p set);
 Clause_p HCBSingleWeightClauseSelect(HCB_p hcb, ClauseSet_p set);
 
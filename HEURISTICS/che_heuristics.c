@@ -19,10 +19,13 @@ Changes
 
 <1> Mon Jun  8 02:14:51 MET DST 1998
     New
+<2> Tue Oct 20 03:41:09 CEST 2026
+    Auto modes are table-driven (che_autotable.c).
 
 -----------------------------------------------------------------------*/
 
 #include "che_heuristics.h"
+#include "che_autotable.h"
 
 
 
@@ -205,12 +208,6 @@ HCB_p GetHeuristic(char* source, HCBARGUMENTS)
 
 #define CHE_HEURISTICS_AUTO
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoModeCreate(HCBARGUMENTS)
 {
    char *res = "Default";
@@ -226,7 +223,6 @@ HCB_p HCBAutoModeCreate(HCBARGUMENTS)
 
    return GetHeuristic(res, state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO
 
 
@@ -245,12 +241,6 @@ GCC_DIAGNOSTIC_POP
 
 #define CHE_HEURISTICS_AUTO_CASC
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBCASCAutoModeCreate(HCBARGUMENTS)
 {
    char *res = "Default";
@@ -283,7 +273,6 @@ HCB_p HCBCASCAutoModeCreate(HCBARGUMENTS)
 
    return GetHeuristic(res, state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_CASC
 
 
@@ -303,12 +292,6 @@ GCC_DIAGNOSTIC_POP
 
 #define CHE_HEURISTICS_AUTO_DEV
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBDevAutoModeCreate(HCBARGUMENTS)
 {
    char *res = "Default";
@@ -324,7 +307,6 @@ HCB_p HCBDevAutoModeCreate(HCBARGUMENTS)
 
    return GetHeuristic(res, state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_DEV
 
 
@@ -346,12 +328,6 @@ GCC_DIAGNOSTIC_POP
 
 #define CHE_HEURISTICS_AUTO_SCHED0
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched0Create(HCBARGUMENTS)
 {
    char *res = "Default";
@@ -367,17 +343,10 @@ HCB_p HCBAutoSched0Create(HCBARGUMENTS)
 
    return GetHeuristic(res, state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED0
 
 #define CHE_HEURISTICS_AUTO_SCHED1
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched1Create(HCBARGUMENTS)
 {
    char *res = "Default";
@@ -393,17 +362,10 @@ HCB_p HCBAutoSched1Create(HCBARGUMENTS)
 
    return GetHeuristic(res, state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED1
 
 #define CHE_HEURISTICS_AUTO_SCHED2
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched2Create(HCBARGUMENTS)
 {
    char *res = "Default";
@@ -419,17 +381,10 @@ HCB_p HCBAutoSched2Create(HCBARGUMENTS)
 
    return GetHeuristic(res, state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED2
 
 #define CHE_HEURISTICS_AUTO_SCHED3
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched3Create(HCBARGUMENTS)
 {
    char *res = "Default";
@@ -445,18 +400,11 @@ HCB_p HCBAutoSched3Create(HCBARGUMENTS)
 
    return GetHeuristic(res, state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED3
 
 
 #define CHE_HEURISTICS_AUTO_SCHED4
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched4Create(HCBARGUMENTS)
 {
    char *res = "Default";
@@ -472,18 +420,11 @@ HCB_p HCBAutoSched4Create(HCBARGUMENTS)
 
    return GetHeuristic(res, state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED4
 
 
 #define CHE_HEURISTICS_AUTO_SCHED5
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched5Create(HCBARGUMENTS)
 {
    char *res = "Default";
@@ -499,18 +440,11 @@ HCB_p HCBAutoSched5Create(HCBARGUMENTS)
 
    return GetHeuristic(res, state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED5
 
 
 #define CHE_HEURISTICS_AUTO_SCHED6
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched6Create(HCBARGUMENTS)
 {
    char *res = "Default";
@@ -526,18 +460,11 @@ HCB_p HCBAutoSched6Create(HCBARGUMENTS)
 
    return GetHeuristic(res, state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED6
 
 
 #define CHE_HEURISTICS_AUTO_SCHED7
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-   #pragma GCC diagnostic ignored "-Wattributes"
-   __attribute__((optnone))
-   __attribute__((optimize(0)))
-#endif
 HCB_p HCBAutoSched7Create(HCBARGUMENTS)
 {
    char *res = "Default";
@@ -553,7 +480,6 @@ HCB_p HCBAutoSched7Create(HCBARGUMENTS)
 
    return GetHeuristic(res, state, control, parms);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED7
 
 
@@ -20,6 +20,9 @@ Changes
 
 <1> Fri May 21 22:16:27 GMT 1999
     New
+<2> Mon Oct 19 23:20:41 CEST 2026
+    Generic selection works on cached literal features, no more
+    per-clause predicate distribution arrays.
 
 -----------------------------------------------------------------------*/
 
@@ -201,6 +204,10 @@ static long literal_weight_counter=0;
 #define lit_sel_diff_weight(handle) \
         ((100*EqnStandardDiff(handle))+EqnStandardWeight(handle))
 
+/* Clauses with up to this many literals are evaluated without
+   allocating memory in generic_uniq_selection() */
+#define LIT_SEL_LOCAL_LITS 32
+
 /*-----------------------------------------------------------------------
 //
 // Function: find_maxlcomplex_literal()
@@ -596,8 +603,9 @@ void generic_uniq_selection(OCB_p ocb, Clause_p clause, bool positive,
                             bool needs_ordering,
                             LitWeightFun weight_fun, void* data)
 {
-   int       len  = ClauseLiteralNumber(clause);
-   LitEval_p lits, tmp;
+   int         len  = ClauseLiteralNumber(clause);
+   LitEvalCell local_lits[LIT_SEL_LOCAL_LITS];
+   LitEval_p   lits, tmp;
    int i, cand;
    Eqn_p handle;
    bool selected = false;
@@ -607,17 +615,19 @@ void generic_uniq_selection(OCB_p ocb, Clause_p clause, bool positive,
    assert(clause->neg_lit_no);
    assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
 
-   lits = SizeMalloc(len*sizeof(LitEvalCell));
+   lits = local_lits;
+   if(len > LIT_SEL_LOCAL_LITS)
+   {
+      lits = SizeMalloc(len*sizeof(LitEvalCell));
+   }
    if(needs_ordering)
    {
       ClauseCondMarkMaximalTerms(ocb, clause);
    }
    for(handle=clause->literals, i=0; handle; handle=handle->next,i++)
    {
-      lits[i].literal = handle;
       tmp = &(lits[i]);
-      LitEvalInit(tmp);
-      assert(clause);
+      LitEvalFeaturesCompute(tmp, handle);
       weight_fun(tmp, clause, data);
    }
    cand = 0;
@@ -639,44 +649,16 @@ void generic_uniq_selection(OCB_p ocb, Clause_p clause, bool positive,
       selected = true;
       ClauseDelProp(clause, CPIsOriented);
    }
-   SizeFree(lits,len*sizeof(LitEvalCell));
-   if(positive && selected)
+   if(lits != local_lits)
    {
-      clause_select_pos(clause);
+      SizeFree(lits,len*sizeof(LitEvalCell));
    }
-}
-
-/*-----------------------------------------------------------------------
-//
-// Function: pos_pred_dist_array_compute()
-//
-//   Compute a distribution array of predicate symbols (or
-//   uninterpreted predicate symbols in positive literals of clause.
-//
-// Global Variables: -
-//
-// Side Effects    : Memory operations
-//
-/----------------------------------------------------------------------*/
-
-
-static PDArray_p pos_pred_dist_array_compute(Clause_p clause)
-{
-   PDArray_p pred_dist;
-   Eqn_p     handle;
-
-   pred_dist = PDIntArrayAlloc(10,30);
-
-   for(handle = clause->literals;
-       handle && EqnIsPositive(handle);
-       handle = handle->next)
+   if(positive && selected)
    {
-      PDArrayElementIncInt(pred_dist, EqnGetPredCode(handle), 1);
+      clause_select_pos(clause);
    }
-   return pred_dist;
 }
 
-#define pred_dist_array_free(array) PDArrayFree(array)
 
 
 /*---------------------------------------------------------------------*/
@@ -773,6 +755,75 @@ void LitSelAppendNames(DStr_p str)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: LitEvalFeaturesCompute()
+//
+//   Initialize cell for literal, with neutral weights and all cheap
+//   features of the literal. Maximality is taken from the literal as
+//   is, so the clause has to be ordered before if this is needed.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void LitEvalFeaturesCompute(LitEval_p cell, Eqn_p literal)
+{
+   cell->literal = literal;
+   LitEvalInit(cell);
+
+   cell->ground       = EqnIsGround(literal);
+   cell->pure_var     = EqnIsPureVar(literal);
+   cell->maximal      = EqnIsMaximal(literal);
+   cell->type_pred    = EqnIsTypePred(literal);
+   cell->xtype_pred   = EqnIsXTypePred(literal);
+   cell->std_weight   = EqnStandardWeight(literal);
+   cell->diff_weight  = lit_sel_diff_weight(literal);
+   cell->var_count    =
+      (TermIsVar(literal->lterm)?1:literal->lterm->v_count)+
+      (TermIsVar(literal->rterm)?1:literal->rterm->v_count);
+   cell->depth        = -1;
+   cell->pos_pred_occ = -1;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: LitEvalPosPredOccCompute()
+//
+//   Compute, store and return the number of positive literals in
+//   clause with the same predicate symbol as the literal of cell
+//   (equational literals share the code 0). Positive literals are
+//   expected in front of the clause.
+//
+// Global Variables: -
+//
+// Side Effects    : Sets cell->pos_pred_occ
+//
+/----------------------------------------------------------------------*/
+
+long LitEvalPosPredOccCompute(LitEval_p cell, Clause_p clause)
+{
+   Eqn_p   handle;
+   FunCode pred = EqnGetPredCode(cell->literal);
+   long    res  = 0;
+
+   for(handle = clause->literals;
+       handle && EqnIsPositive(handle);
+       handle = handle->next)
+   {
+      if(EqnGetPredCode(handle) == pred)
+      {
+         res++;
+      }
+   }
+   cell->pos_pred_occ = res;
+   return res;
+}
+
+
 
 /*-----------------------------------------------------------------------
 //
@@ -4502,7 +4553,7 @@ static void maxlcomplex_weight(LitEval_p lit, Clause_p clause, void *dummy)
 {
    if(EqnIsNegative(lit->literal))
    {
-      if(EqnIsMaximal(lit->literal))
+      if(lit->maximal)
       {
          lit->w1=0;
       }
@@ -4510,15 +4561,15 @@ static void maxlcomplex_weight(LitEval_p lit, Clause_p clause, void *dummy)
       {
          lit->w1=100;
       }
-      if(!EqnIsPureVar(lit->literal))
+      if(!lit->pure_var)
       {
          lit->w1+=10;
       }
-      if(!EqnIsGround(lit->literal))
+      if(!lit->ground)
       {
          lit->w1+=1;
       }
-      lit->w2 = -lit_sel_diff_weight(lit->literal);
+      lit->w2 = -lit->diff_weight;
       lit->w3 = literal_weight_counter % clause->neg_lit_no;
    }
    literal_weight_counter++;
@@ -4566,7 +4617,7 @@ void SelectMaxLComplexG(OCB_p ocb, Clause_p clause)
 // Function: maxlcomplexavoidpred_weight()
 //
 //   Initialize weights to mimic SelectMaxLComplexWeight(), but defer
-//   literals with which occur often in pred_dist.
+//   literals whose predicate symbol occurs in many positive literals.
 //
 // Global Variables: -
 //
@@ -4575,13 +4626,11 @@ void SelectMaxLComplexG(OCB_p ocb, Clause_p clause)
 /----------------------------------------------------------------------*/
 
 static void maxlcomplexavoidpred_weight(LitEval_p lit, Clause_p clause,
-                                        void *pred_dist)
+                                        void *dummy)
 {
-   PDArray_p pd = pred_dist;
-
    if(EqnIsNegative(lit->literal))
    {
-      if(EqnIsMaximal(lit->literal))
+      if(lit->maximal)
       {
          lit->w1=0;
       }
@@ -4589,23 +4638,16 @@ static void maxlcomplexavoidpred_weight(LitEval_p lit, Clause_p clause,
       {
          lit->w1=100;
       }
-      if(!EqnIsPureVar(lit->literal))
+      if(!lit->pure_var)
       {
          lit->w1+=10;
       }
-      if(!EqnIsGround(lit->literal))
+      if(!lit->ground)
       {
          lit->w1+=1;
       }
-      lit->w2 = -lit_sel_diff_weight(lit->literal);
-      if(EqnIsEquLit(lit->literal))
-      {
-         lit->w3 = PDArrayElementInt(pd, 0);
-      }
-      else
-      {
-         lit->w3 = PDArrayElementInt(pd, lit->literal->lterm->f_code);
-      }
+      lit->w2 = -lit->diff_weight;
+      lit->w3 = LitEvalPosPredOcc(lit, clause);
    }
 }
 
@@ -4626,7 +4668,6 @@ static void maxlcomplexavoidpred_weight(LitEval_p lit, Clause_p clause,
 void SelectMaxLComplexAvoidPosPred(OCB_p ocb, Clause_p clause)
 {
    long  lit_no;
-   PDArray_p pred_dist;
 
    assert(ocb);
    assert(clause);
@@ -4644,10 +4685,8 @@ void SelectMaxLComplexAvoidPosPred(OCB_p ocb, Clause_p clause)
    {
       return;
    }
-   pred_dist = pos_pred_dist_array_compute(clause);
    generic_uniq_selection(ocb,clause,false, true,
-                          maxlcomplexavoidpred_weight, pred_dist);
-   pred_dist_array_free(pred_dist);
+                          maxlcomplexavoidpred_weight, NULL);
 }
 
 
@@ -4657,8 +4696,8 @@ void SelectMaxLComplexAvoidPosPred(OCB_p ocb, Clause_p clause)
 // Function: maxlcomplexappNTNpweight()
 //
 //   Initialize weights to mimic SelectMaxLComplexWeight(), but defer
-//   literals with which occur often in pred_dist. Never select type-
-//   and propositional literals.
+//   literals whose predicate symbol occurs in many positive
+//   literals. Never select type- and propositional literals.
 //
 // Global Variables: -
 //
@@ -4667,20 +4706,18 @@ void SelectMaxLComplexAvoidPosPred(OCB_p ocb, Clause_p clause)
 /----------------------------------------------------------------------*/
 
 static void maxlcomplexappNTNp_weight(LitEval_p lit, Clause_p clause,
-                                      void *pred_dist)
+                                      void *dummy)
 {
-   PDArray_p pd = pred_dist;
-
    if(EqnIsNegative(lit->literal))
    {
-      if(EqnIsTypePred(lit->literal)||EqnIsPropositional(lit->literal))
+      if(lit->type_pred||EqnIsPropositional(lit->literal))
       {
          lit->w1 = 100000;
          lit->forbidden = true;
       }
       else
       {
-         if(EqnIsMaximal(lit->literal))
+         if(lit->maximal)
          {
             lit->w1=0;
          }
@@ -4689,23 +4726,16 @@ static void maxlcomplexappNTNp_weight(LitEval_p lit, Clause_p clause,
             lit->w1=100;
          }
       }
-      if(!EqnIsPureVar(lit->literal))
+      if(!lit->pure_var)
       {
          lit->w1+=10;
       }
-      if(!EqnIsGround(lit->literal))
+      if(!lit->ground)
       {
          lit->w1+=1;
       }
-      lit->w2 = -lit_sel_diff_weight(lit->literal);
-      if(EqnIsEquLit(lit->literal))
-      {
-         lit->w3 = PDArrayElementInt(pd, 0);
-      }
-      else
-      {
-         lit->w3 = PDArrayElementInt(pd, lit->literal->lterm->f_code);
-      }
+      lit->w2 = -lit->diff_weight;
+      lit->w3 = LitEvalPosPredOcc(lit, clause);
    }
 }
 
@@ -4726,7 +4756,6 @@ static void maxlcomplexappNTNp_weight(LitEval_p lit, Clause_p clause,
 void SelectMaxLComplexAPPNTNp(OCB_p ocb, Clause_p clause)
 {
    long  lit_no;
-   PDArray_p pred_dist;
 
    assert(ocb);
    assert(clause);
@@ -4744,10 +4773,8 @@ void SelectMaxLComplexAPPNTNp(OCB_p ocb, Clause_p clause)
    {
       return;
    }
-   pred_dist = pos_pred_dist_array_compute(clause);
    generic_uniq_selection(ocb,clause,false, true,
-                          maxlcomplexappNTNp_weight, pred_dist);
-   pred_dist_array_free(pred_dist);
+                          maxlcomplexappNTNp_weight, NULL);
 }
 
 
@@ -4766,10 +4793,10 @@ void SelectMaxLComplexAPPNTNp(OCB_p ocb, Clause_p clause)
 /----------------------------------------------------------------------*/
 
 static void maxlcomplexavoidprednotype_weight(LitEval_p lit, Clause_p clause,
-                                        void *pred_dist)
+                                        void *dummy)
 {
-   maxlcomplexavoidpred_weight(lit, clause, pred_dist);
-   if(EqnIsTypePred(lit->literal))
+   maxlcomplexavoidpred_weight(lit, clause, dummy);
+   if(lit->type_pred)
    {
       lit->forbidden = true;
    }
@@ -4793,7 +4820,6 @@ static void maxlcomplexavoidprednotype_weight(LitEval_p lit, Clause_p clause,
 void SelectMaxLComplexAPPNoType(OCB_p ocb, Clause_p clause)
 {
    long  lit_no;
-   PDArray_p pred_dist;
 
    assert(ocb);
    assert(clause);
@@ -4811,15 +4837,37 @@ void SelectMaxLComplexAPPNoType(OCB_p ocb, Clause_p clause)
    {
       return;
    }
-   pred_dist = pos_pred_dist_array_compute(clause);
    generic_uniq_selection(ocb,clause,false, true,
-                          maxlcomplexavoidprednotype_weight, pred_dist);
-   pred_dist_array_free(pred_dist);
+                          maxlcomplexavoidprednotype_weight, NULL);
 }
 
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: maxlcomplexavoidupred_weight()
+//
+//   As  maxlcomplexavoidpred_weight, but only positive literals with
+//   uninterpreted predicate symbols count, not equations.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void maxlcomplexavoidupred_weight(LitEval_p lit, Clause_p clause,
+                                         void *dummy)
+{
+   maxlcomplexavoidpred_weight(lit, clause, dummy);
+   if(EqnIsEquLit(lit->literal))
+   {
+      lit->w3 = 0;
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: SelectMaxLComplexAvoidPosUPred()
@@ -4837,7 +4885,6 @@ void SelectMaxLComplexAPPNoType(OCB_p ocb, Clause_p clause)
 void SelectMaxLComplexAvoidPosUPred(OCB_p ocb, Clause_p clause)
 {
    long  lit_no;
-   PDArray_p pred_dist;
 
    assert(ocb);
    assert(clause);
@@ -4851,12 +4898,8 @@ void SelectMaxLComplexAvoidPosUPred(OCB_p ocb, Clause_p clause)
    {
       return;
    }
-   pred_dist = pos_pred_dist_array_compute(clause);
-   PDArrayAssignInt(pred_dist, 0, 0);
-
    generic_uniq_selection(ocb,clause,false, true,
-                          maxlcomplexavoidpred_weight, pred_dist);
-   pred_dist_array_free(pred_dist);
+                          maxlcomplexavoidupred_weight, NULL);
 }
 
 /*-----------------------------------------------------------------------
@@ -4877,19 +4920,19 @@ static void complex_weight(LitEval_p lit, Clause_p clause,
 {
    if(EqnIsNegative(lit->literal))
    {
-      if(EqnIsPureVar(lit->literal))
+      if(lit->pure_var)
       {
          lit->w1 = 0;
       }
-      else if(EqnIsGround(lit->literal))
+      else if(lit->ground)
       {
          lit->w1 = 10;
-         lit->w2 = EqnStandardWeight(lit->literal);
+         lit->w2 = lit->std_weight;
       }
       else
       {
          lit->w1 = 20;
-         lit->w2 = -lit_sel_diff_weight(lit->literal);
+         lit->w2 = -lit->diff_weight;
       }
    }
 }
@@ -4930,33 +4973,31 @@ void SelectComplexG(OCB_p ocb, Clause_p clause)
 
 
 static void complex_weight_ahp(LitEval_p lit, Clause_p clause,
-                           void *pred_dist)
+                           void *dummy)
 {
-   PDArray_p pd = pred_dist;
-
    assert(clause);
 
    if(EqnIsNegative(lit->literal))
    {
-      if(EqnIsPureVar(lit->literal))
+      if(lit->pure_var)
       {
          lit->w1 = 0;
       }
-      else if(EqnIsGround(lit->literal))
+      else if(lit->ground)
       {
          lit->w1 = 10;
-         lit->w2 = EqnStandardWeight(lit->literal);
+         lit->w2 = lit->std_weight;
       }
       else
       {
          lit->w1 = 20;
-         lit->w2 = -lit_sel_diff_weight(lit->literal);
+         lit->w2 = -lit->diff_weight;
       }
    }
    lit->w3 = 0;
-   if(lit->literal->lterm->f_code > 0)
+   if(!EqnIsEquLit(lit->literal))
    {
-      lit->w3 = PDArrayElementInt(pd, lit->literal->lterm->f_code);
+      lit->w3 = LitEvalPosPredOcc(lit, clause);
    }
 }
 
@@ -4977,18 +5018,14 @@ static void complex_weight_ahp(LitEval_p lit, Clause_p clause,
 
 void SelectComplexAHP(OCB_p ocb, Clause_p clause)
 {
-   PDArray_p pred_dist;
 
    assert(ocb);
    assert(clause);
    assert(clause->neg_lit_no);
    assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
 
-   pred_dist = pos_pred_dist_array_compute(clause);
-
    generic_uniq_selection(ocb,clause,false, true,
-                          complex_weight_ahp, pred_dist);
-   pred_dist_array_free(pred_dist);
+                          complex_weight_ahp, NULL);
 }
 
 
@@ -5007,18 +5044,14 @@ void SelectComplexAHP(OCB_p ocb, Clause_p clause)
 
 void PSelectComplexAHP(OCB_p ocb, Clause_p clause)
 {
-   PDArray_p pred_dist;
 
    assert(ocb);
    assert(clause);
    assert(clause->neg_lit_no);
    assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
 
-   pred_dist = pos_pred_dist_array_compute(clause);
-
    generic_uniq_selection(ocb,clause,true, true,
-                          complex_weight_ahp, pred_dist);
-   pred_dist_array_free(pred_dist);
+                          complex_weight_ahp, NULL);
 }
 
 
@@ -5037,40 +5070,38 @@ void PSelectComplexAHP(OCB_p ocb, Clause_p clause)
 
 
 static void new_complex_notp_ahp(LitEval_p lit, Clause_p clause,
-                                 void *pred_dist)
+                                 void *dummy)
 {
-   PDArray_p pd = pred_dist;
-
    assert(clause);
 
    if(EqnIsNegative(lit->literal))
    {
-      if(EqnIsGround(lit->literal))
+      if(lit->ground)
       {
          lit->w1 = 0;
          lit->w2 = TermStandardWeight(lit->literal->lterm);
       }
-      else if(!EqnIsXTypePred(lit->literal))
+      else if(!lit->xtype_pred)
       {
          lit->w1 = 10;
          lit->w2 = EqnMaxTermPositions(lit->literal);
       }
-      else if(!EqnIsTypePred(lit->literal))
+      else if(!lit->type_pred)
       {
          lit->w1 = 20;
          lit->w2 = -TermStandardWeight(lit->literal->lterm);
       }
       else
       {
-         assert(EqnIsTypePred(lit->literal));
+         assert(lit->type_pred);
          lit->w1 = 100000;
          lit->forbidden = 1;
       }
    }
    lit->w3 = 0;
-   if(!TermIsVar(lit->literal->lterm))
+   if(!EqnIsEquLit(lit->literal))
    {
-      lit->w3 = PDArrayElementInt(pd, lit->literal->lterm->f_code);
+      lit->w3 = LitEvalPosPredOcc(lit, clause);
    }
 }
 
@@ -5091,18 +5122,14 @@ static void new_complex_notp_ahp(LitEval_p lit, Clause_p clause,
 
 void SelectNewComplexAHP(OCB_p ocb, Clause_p clause)
 {
-   PDArray_p pred_dist;
 
    assert(ocb);
    assert(clause);
    assert(clause->neg_lit_no);
    assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
 
-   pred_dist = pos_pred_dist_array_compute(clause);
-
    generic_uniq_selection(ocb,clause,false, true,
-                          new_complex_notp_ahp, pred_dist);
-   pred_dist_array_free(pred_dist);
+                          new_complex_notp_ahp, NULL);
 }
 
 
@@ -5120,18 +5147,14 @@ void SelectNewComplexAHP(OCB_p ocb, Clause_p clause)
 
 void PSelectNewComplexAHP(OCB_p ocb, Clause_p clause)
 {
-   PDArray_p pred_dist;
 
    assert(ocb);
    assert(clause);
    assert(clause->neg_lit_no);
    assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
 
-   pred_dist = pos_pred_dist_array_compute(clause);
-
    generic_uniq_selection(ocb,clause, true, true,
-                          new_complex_notp_ahp, pred_dist);
-   pred_dist_array_free(pred_dist);
+                          new_complex_notp_ahp, NULL);
 }
 
 
@@ -5299,10 +5322,8 @@ void PSelectNewComplexAHPExceptUniqMaxHorn(OCB_p ocb, Clause_p clause)
 
 
 static void new_complex_notp_ahp_ns(LitEval_p lit, Clause_p clause,
-                                    void *pred_dist)
+                                    void *dummy)
 {
-   PDArray_p pd = pred_dist;
-
    assert(clause);
 
    if(EqnIsNegative(lit->literal))
@@ -5312,32 +5333,32 @@ static void new_complex_notp_ahp_ns(LitEval_p lit, Clause_p clause,
          lit->w1 = 100000;
          lit->forbidden = 1;
       }
-      else if(EqnIsGround(lit->literal))
+      else if(lit->ground)
       {
          lit->w1 = 0;
          lit->w2 = TermStandardWeight(lit->literal->lterm);
       }
-      else if(!EqnIsXTypePred(lit->literal))
+      else if(!lit->xtype_pred)
       {
          lit->w1 = 10;
          lit->w2 = EqnMaxTermPositions(lit->literal);
       }
-      else if(!EqnIsTypePred(lit->literal))
+      else if(!lit->type_pred)
       {
          lit->w1 = 20;
          lit->w2 = -TermStandardWeight(lit->literal->lterm);
       }
       else
       {
-         assert(EqnIsTypePred(lit->literal));
+         assert(lit->type_pred);
          lit->w1 = 100000;
          lit->forbidden = 1;
       }
    }
    lit->w3 = 0;
-   if(!TermIsVar(lit->literal->lterm))
+   if(!EqnIsEquLit(lit->literal))
    {
-      lit->w3 = PDArrayElementInt(pd, lit->literal->lterm->f_code);
+      lit->w3 = LitEvalPosPredOcc(lit, clause);
    }
 }
 
@@ -5359,18 +5380,14 @@ static void new_complex_notp_ahp_ns(LitEval_p lit, Clause_p clause,
 
 void SelectNewComplexAHPNS(OCB_p ocb, Clause_p clause)
 {
-   PDArray_p pred_dist;
 
    assert(ocb);
    assert(clause);
    assert(clause->neg_lit_no);
    assert(EqnListQueryPropNumber(clause->literals, EPIsSelected)==0);
 
-   pred_dist = pos_pred_dist_array_compute(clause);
-
    generic_uniq_selection(ocb,clause,false, true,
-                          new_complex_notp_ahp_ns, pred_dist);
-   pred_dist_array_free(pred_dist);
+                          new_complex_notp_ahp_ns, NULL);
 }
 
 
@@ -5394,7 +5411,6 @@ void SelectVGNonCR(OCB_p ocb, Clause_p clause)
 {
    Eqn_p     handle;
    int       maxlits, maxposlits;
-   PDArray_p pred_dist;
 
    assert(ocb);
    assert(clause);
@@ -5427,11 +5443,8 @@ void SelectVGNonCR(OCB_p ocb, Clause_p clause)
          return;
       }
    }
-   pred_dist = pos_pred_dist_array_compute(clause);
-
    generic_uniq_selection(ocb,clause,false, true,
-                          new_complex_notp_ahp_ns, pred_dist);
-   pred_dist_array_free(pred_dist);
+                          new_complex_notp_ahp_ns, NULL);
 }
 
 
@@ -5464,7 +5477,7 @@ static void select_cq_ar_eql_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQArEqLast(OCB_p ocb, Clause_p clause)
@@ -5509,7 +5522,7 @@ static void select_cq_ar_eqf_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQArEqFirst(OCB_p ocb, Clause_p clause)
@@ -5553,7 +5566,7 @@ static void select_cq_iar_eql_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQIArEqLast(OCB_p ocb, Clause_p clause)
@@ -5598,7 +5611,7 @@ static void select_cq_iar_eqf_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQIArEqFirst(OCB_p ocb, Clause_p clause)
@@ -5647,7 +5660,7 @@ static void select_cq_ar_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQAr(OCB_p ocb, Clause_p clause)
@@ -5695,7 +5708,7 @@ static void select_cq_iar_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 
@@ -5746,7 +5759,7 @@ static void select_cq_arnp_eqf_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 
@@ -5798,7 +5811,7 @@ static void select_cq_iarnp_eqf_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQIArNpEqFirst(OCB_p ocb, Clause_p clause)
@@ -5843,8 +5856,8 @@ static void select_grcq_ar_eqf_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
-   if(EqnIsGround(l))
+   lit->w3 =lit->diff_weight;
+   if(lit->ground)
    {
       lit->w1 -= 2000000;
    }
@@ -5893,8 +5906,8 @@ static void select_cqgr_ar_eqf_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
-   if(EqnIsGround(l))
+   lit->w3 =lit->diff_weight;
+   if(lit->ground)
    {
       lit->w2 -= 2000000;
    }
@@ -5941,13 +5954,13 @@ static void select_cq_arnt_eqf_weight(LitEval_p lit, Clause_p clause,
    {
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
-      if(EqnIsTypePred(l))
+      if(lit->type_pred)
       {
          lit->w1 = 100000;
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQArNTEqFirst(OCB_p ocb, Clause_p clause)
@@ -5991,13 +6004,13 @@ static void select_cq_iarnt_eqf_weight(LitEval_p lit, Clause_p clause,
    {
       lit->w1 = SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
-      if(EqnIsTypePred(l))
+      if(lit->type_pred)
       {
          lit->w1 = 100000;
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQIArNTEqFirst(OCB_p ocb, Clause_p clause)
@@ -6042,13 +6055,13 @@ static void select_cq_arntnp_eqf_weight(LitEval_p lit, Clause_p clause,
    {
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
-      if(EqnIsTypePred(l)||EqnIsPropositional(l))
+      if(lit->type_pred||EqnIsPropositional(l))
       {
          lit->w1 = 100000;
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQArNTNpEqFirst(OCB_p ocb, Clause_p clause)
@@ -6093,13 +6106,13 @@ static void select_cq_iarntnp_eqf_weight(LitEval_p lit, Clause_p clause,
    {
       lit->w1 = SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
-      if(EqnIsTypePred(l)||EqnIsPropositional(l))
+      if(lit->type_pred||EqnIsPropositional(l))
       {
          lit->w1 = 100000;
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQIArNTNpEqFirst(OCB_p ocb, Clause_p clause)
@@ -6143,13 +6156,13 @@ static void select_cq_arnxt_eqf_weight(LitEval_p lit, Clause_p clause,
    {
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
-      if(EqnIsXTypePred(l))
+      if(lit->xtype_pred)
       {
          lit->w1 = 100000;
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQArNXTEqFirst(OCB_p ocb, Clause_p clause)
@@ -6194,13 +6207,13 @@ static void select_cq_iarnxt_eqf_weight(LitEval_p lit, Clause_p clause,
    {
       lit->w1 = SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
-      if(EqnIsXTypePred(l))
+      if(lit->xtype_pred)
       {
          lit->w1 = 100000;
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQIArNXTEqFirst(OCB_p ocb, Clause_p clause)
@@ -6246,13 +6259,13 @@ static void select_cq_arntnp_weight(LitEval_p lit, Clause_p clause,
    {
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
-      if(EqnIsTypePred(l)||EqnIsPropositional(l))
+      if(lit->type_pred||EqnIsPropositional(l))
       {
          lit->w1 = 100000;
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQArNTNp(OCB_p ocb, Clause_p clause)
@@ -6297,13 +6310,13 @@ static void select_cq_iarntnp_weight(LitEval_p lit, Clause_p clause,
    {
       lit->w1 = SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
-      if(EqnIsTypePred(l)||EqnIsPropositional(l))
+      if(lit->type_pred||EqnIsPropositional(l))
       {
          lit->w1 = 100000;
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQIArNTNp(OCB_p ocb, Clause_p clause)
@@ -6347,13 +6360,13 @@ static void select_cq_arnt_weight(LitEval_p lit, Clause_p clause,
    {
       lit->w1 = -SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
-      if(EqnIsTypePred(l))
+      if(lit->type_pred)
       {
          lit->w1 = 100000;
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQArNT(OCB_p ocb, Clause_p clause)
@@ -6397,13 +6410,13 @@ static void select_cq_iarnt_weight(LitEval_p lit, Clause_p clause,
    {
       lit->w1 = SigFindArity(l->bank->sig, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
-      if(EqnIsTypePred(l))
+      if(lit->type_pred)
       {
          lit->w1 = 100000;
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQIArNT(OCB_p ocb, Clause_p clause)
@@ -6453,7 +6466,7 @@ static void select_cq_arnp_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQArNp(OCB_p ocb, Clause_p clause)
@@ -6504,7 +6517,7 @@ static void select_cq_iarnp_weight(LitEval_p lit, Clause_p clause,
          lit->forbidden = true;
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQIArNp(OCB_p ocb, Clause_p clause)
@@ -6669,7 +6682,7 @@ static void select_cq_precw_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = OCBFunPrecWeight(ocb, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQPrecW(OCB_p ocb, Clause_p clause)
@@ -6715,7 +6728,7 @@ static void select_cq_iprecw_weight(LitEval_p lit, Clause_p clause,
       lit->w1 = -OCBFunPrecWeight(ocb, l->lterm->f_code);
       lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQIPrecW(OCB_p ocb, Clause_p clause)
@@ -6759,7 +6772,7 @@ static void select_cq_precwntnp_weight(LitEval_p lit, Clause_p clause,
    }
    else
    {
-      if(EqnIsTypePred(l)||EqnIsPropositional(l))
+      if(lit->type_pred||EqnIsPropositional(l))
       {
          lit->w1 = 100000;
          lit->forbidden = true;
@@ -6770,7 +6783,7 @@ static void select_cq_precwntnp_weight(LitEval_p lit, Clause_p clause,
          lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQPrecWNTNp(OCB_p ocb, Clause_p clause)
@@ -6814,7 +6827,7 @@ static void select_cq_iprecwntnp_weight(LitEval_p lit, Clause_p clause,
    }
    else
    {
-      if(EqnIsTypePred(l)||EqnIsPropositional(l))
+      if(lit->type_pred||EqnIsPropositional(l))
       {
          lit->w1 = 100000;
          lit->forbidden = true;
@@ -6825,7 +6838,7 @@ static void select_cq_iprecwntnp_weight(LitEval_p lit, Clause_p clause,
          lit->w2 = SigGetAlphaRank(l->bank->sig, l->lterm->f_code);
       }
    }
-   lit->w3 =lit_sel_diff_weight(l);
+   lit->w3 =lit->diff_weight;
 }
 
 void SelectCQIPrecWNTNp(OCB_p ocb, Clause_p clause)
@@ -19,6 +19,8 @@ Changes
 
 <1> Fri May 21 22:17:06 GMT 1999
     New
+<2> Mon Oct 19 23:20:41 CEST 2026
+    Literal features cached in LitEvalCell.
 
 -----------------------------------------------------------------------*/
 
@@ -49,6 +51,21 @@ typedef struct lit_eval_cell
    int   w1; /* Lexicographically compared weights */
    int   w2;
    int   w3;
+   /* Features of literal, computed once per clause before the
+      weights are assigned. Weight functions should use these
+      instead of re-evaluating the literal. */
+   bool  ground;
+   bool  pure_var;
+   bool  maximal;
+   bool  type_pred;
+   bool  xtype_pred;
+   long  std_weight;
+   long  diff_weight;
+   long  var_count;
+   long  depth;        /* -1 until requested, see LitEvalDepth() */
+   long  pos_pred_occ; /* Positive literals with the same predicate
+                          symbol, -1 until requested, see
+                          LitEvalPosPredOcc() */
 }LitEvalCell, *LitEval_p;
 
 typedef void LitWeightFun(LitEval_p, Clause_p, void*);
@@ -61,6 +78,16 @@ typedef void LitWeightFun(LitEval_p, Clause_p, void*);
         {(cell)->forbidden = false;cell->exclusive=true;\
         cell->w1=0;cell->w2=0;cell->w3=0;}
 
+#define LitEvalDepth(cell) \
+        (((cell)->depth<0)?((cell)->depth=EqnDepth((cell)->literal)):\
+         (cell)->depth)
+#define LitEvalPosPredOcc(cell, clause) \
+        (((cell)->pos_pred_occ<0)?LitEvalPosPredOccCompute((cell),(clause)):\
+         (cell)->pos_pred_occ)
+
+void LitEvalFeaturesCompute(LitEval_p cell, Eqn_p literal);
+long LitEvalPosPredOccCompute(LitEval_p cell, Clause_p clause);
+
 LiteralSelectionFun GetLitSelFun(char* name);
 char*               GetLitSelName(LiteralSelectionFun fun);
 void LitSelAppendNames(DStr_p str);
@@ -18,6 +18,8 @@ Changes
 
 <1> Tue May 22 01:16:15 CEST 2012
     New
+<2> Tue Oct 20 02:14:51 CEST 2026
+    Compute raw features in one pass over each input set
 
 -----------------------------------------------------------------------*/
 
@@ -49,7 +51,8 @@ Changes
 //
 // Function: RawSpecFeaturesCompute()
 //
-//   Compute the raw features of state.
+//   Compute the raw features of state. Each of the clause set, the
+//   formula set, and the signature is traversed only once.
 //
 // Global Variables: -
 //
@@ -59,29 +62,84 @@ Changes
 
 void RawSpecFeaturesCompute(RawSpecFeature_p features, ProofState_p state)
 {
+   Clause_p   clause;
+   WFormula_p form;
+   Sig_p      sig = state->terms->sig;
+   FunCode    i;
+   int        preds = 0, funs = 0;
+
    features->sentence_no = ClauseSetCardinality(state->axioms)+
       ClauseSetCardinality(state->f_axioms);
-   features->term_size   = ClauseSetStandardWeight(state->axioms)+
-      FormulaSetStandardWeight(state->f_axioms);
+   features->term_size        = 0;
    features->hypothesis_count = 0;
    features->conjecture_count = 0;
-   features->conjecture_count +=
-      ClauseSetCountConjectures(state->axioms,
-                                &(features->hypothesis_count));
-   features->conjecture_count +=
-      FormulaSetCountConjectures(state->f_axioms,
-                                 &(features->hypothesis_count));
-
-   features->sig_size    = SigCountSymbols(state->terms->sig, true)+
-      SigCountSymbols(state->terms->sig,false);
-
-   features->predc_size = SigCountAritySymbols(state->terms->sig, 0, true);
-   features->func_size  = SigCountAritySymbols(state->terms->sig, 0, false);
-   features->pred_size = SigCountSymbols(state->terms->sig, true)-
-      SigCountAritySymbols(state->terms->sig, 0, true);
-   features->fun_size  = SigCountSymbols(state->terms->sig, false)-
-      SigCountAritySymbols(state->terms->sig, 0, false);
+   features->predc_size       = 0;
+   features->func_size        = 0;
+
+   for(clause = state->axioms->anchor->succ;
+       clause != state->axioms->anchor;
+       clause = clause->succ)
+   {
+      features->term_size += ClauseStandardWeight(clause);
+      if(ClauseIsConjecture(clause))
+      {
+         features->conjecture_count++;
+      }
+      if(ClauseIsHypothesis(clause))
+      {
+         features->hypothesis_count++;
+      }
+   }
+   for(form = state->f_axioms->anchor->succ;
+       form != state->f_axioms->anchor;
+       form = form->succ)
+   {
+      features->term_size += WFormulaStandardWeight(form);
+      if(FormulaIsConjecture(form))
+      {
+         features->conjecture_count++;
+      }
+      if(FormulaIsHypothesis(form))
+      {
+         features->hypothesis_count++;
+      }
+   }
 
+   /* Same counts as SigCountSymbols() and SigCountAritySymbols() */
+   for(i=sig->internal_symbols+1; i<=sig->f_count; i++)
+   {
+      if(SigIsSpecial(sig,i))
+      {
+         continue;
+      }
+      if(SigIsPredicate(sig, i))
+      {
+         preds++;
+         if(SigFindArity(sig, i)==0)
+         {
+            features->predc_size++;
+         }
+      }
+      else
+      {
+         if(SigIsFunction(sig, i))
+         {
+            funs++;
+         }
+         if(SigFindArity(sig, i)==0)
+         {
+            features->func_size++;
+         }
+      }
+   }
+   features->sig_size  = preds+funs;
+   features->pred_size = preds-features->predc_size;
+   features->fun_size  = funs-features->func_size;
+
+   assert(features->sig_size == SigCountSymbols(sig, true)+
+          SigCountSymbols(sig, false));
+   assert(features->predc_size == SigCountAritySymbols(sig, 0, true));
+   assert(features->func_size == SigCountAritySymbols(sig, 0, false));
 
    features->class[0] = '\0';
 }
@@ -18,10 +18,17 @@ Changes
 
 <1> Fri Jan  1 16:06:31 MET 1999
     New
+<2> Tue Oct 20 01:12:40 CEST 2026
+    Bounded evaluation, parallel search in OrderFindOptimal().
+<3> Tue Oct 20 03:41:09 CEST 2026
+    Auto modes are table-driven (che_autotable.c).
 
 -----------------------------------------------------------------------*/
 
+#include <sys/wait.h>
 #include "che_to_autoselect.h"
+#include "che_autotable.h"
+#include <ccl_derivlog.h>
 
 
 
@@ -109,12 +116,6 @@ void print_oparms(OrderParms_p oparms)
 
 #define CHE_HEURISTICS_AUTO
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_auto_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -127,7 +128,6 @@ OCB_p generate_auto_ordering(ProofState_p state, SpecFeature_p spec)
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO
 
 
@@ -147,12 +147,6 @@ GCC_DIAGNOSTIC_POP
 
 #define CHE_HEURISTICS_AUTO_CASC
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autocasc_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -200,7 +194,6 @@ OCB_p generate_autocasc_ordering(ProofState_p state, SpecFeature_p spec)
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_CASC
 
 
@@ -220,12 +213,6 @@ GCC_DIAGNOSTIC_POP
 
 #define CHE_HEURISTICS_AUTO_DEV
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autodev_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -256,7 +243,6 @@ OCB_p generate_autodev_ordering(ProofState_p state, SpecFeature_p spec)
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_DEV
 
 
@@ -283,12 +269,6 @@ GCC_DIAGNOSTIC_POP
 
 #define CHE_HEURISTICS_AUTO_SCHED0
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched0_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -301,17 +281,10 @@ OCB_p generate_autosched0_ordering(ProofState_p state, SpecFeature_p spec)
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED0
 
 #define CHE_HEURISTICS_AUTO_SCHED1
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched1_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -324,17 +297,10 @@ OCB_p generate_autosched1_ordering(ProofState_p state, SpecFeature_p spec)
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED1
 
 #define CHE_HEURISTICS_AUTO_SCHED2
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched2_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -347,17 +313,10 @@ OCB_p generate_autosched2_ordering(ProofState_p state, SpecFeature_p spec)
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED2
 
 #define CHE_HEURISTICS_AUTO_SCHED3
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched3_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -370,17 +329,10 @@ OCB_p generate_autosched3_ordering(ProofState_p state, SpecFeature_p spec)
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED3
 
 #define CHE_HEURISTICS_AUTO_SCHED4
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched4_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -393,17 +345,10 @@ OCB_p generate_autosched4_ordering(ProofState_p state, SpecFeature_p spec)
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED4
 
 #define CHE_HEURISTICS_AUTO_SCHED5
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched5_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -416,17 +361,10 @@ OCB_p generate_autosched5_ordering(ProofState_p state, SpecFeature_p spec)
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED5
 
 #define CHE_HEURISTICS_AUTO_SCHED6
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched6_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -439,17 +377,10 @@ OCB_p generate_autosched6_ordering(ProofState_p state, SpecFeature_p spec)
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED6
 
 #define CHE_HEURISTICS_AUTO_SCHED7
 
-GCC_DIAGNOSTIC_PUSH
-#ifndef COMPILE_HEURISTICS_OPTIMIZED
-#pragma GCC diagnostic ignored "-Wattributes"
-__attribute__((optnone))
-__attribute__((optimize(0)))
-#endif
 OCB_p generate_autosched7_ordering(ProofState_p state, SpecFeature_p spec)
 {
    OrderParmsCell  oparms;
@@ -462,12 +393,119 @@ OCB_p generate_autosched7_ordering(ProofState_p state, SpecFeature_p spec)
    SpecLimitsCellFree(limits);
    return TOCreateOrdering(state, &oparms, NULL, NULL);
 }
-GCC_DIAGNOSTIC_POP
 #undef CHE_HEURISTICS_AUTO_SCHED67
 
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: order_search_candidates()
+//
+//   Evaluate the candidate orderings first, first+step, ... and
+//   return the index of the first best one (or -1 if there is
+//   none). Candidates are only evaluated as far as necessary to see
+//   that they are not better than the best one so far, so the
+//   result is the same as with full evaluation. If best_ocb is not
+//   NULL, return the OCB of the winner in it.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, whatever eval_fun does.
+//
+/----------------------------------------------------------------------*/
+
+static long order_search_candidates(PStack_p cands, long first, long step,
+                                    OrderEvaluationFun eval_fun,
+                                    ProofState_p state,
+                                    HeuristicParms_p parms,
+                                    double *best_eval, OCB_p *best_ocb)
+{
+   long   i, best = -1;
+   OCB_p  tmp_ocb;
+   double tmp_eval;
+
+   *best_eval = HUGE_VAL;
+   for(i=first; i<PStackGetSP(cands); i+=step)
+   {
+      tmp_ocb  = TOCreateOrdering(state, PStackElementP(cands, i),
+                                  NULL, NULL);
+      tmp_eval = eval_fun(tmp_ocb, state, parms, *best_eval);
+      if(best == -1 || tmp_eval < *best_eval)
+      {
+         if(best_ocb)
+         {
+            if(*best_ocb)
+            {
+               OCBFree(*best_ocb);
+            }
+            *best_ocb = tmp_ocb;
+            tmp_ocb = NULL;
+         }
+         *best_eval = tmp_eval;
+         best = i;
+      }
+      if(tmp_ocb)
+      {
+         OCBFree(tmp_ocb);
+      }
+   }
+   return best;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: order_wait_worker()
+//
+//   Read the result of an ordering search worker from fd and wait
+//   for the worker to terminate. Fail if it did not succeed.
+//
+// Global Variables: -
+//
+// Side Effects    : Terminates on error
+//
+/----------------------------------------------------------------------*/
+
+static void order_wait_worker(pid_t pid, int fd, long *best,
+                              double *best_eval)
+{
+   char    buffer[sizeof(long)+sizeof(double)];
+   size_t  got = 0;
+   ssize_t res;
+   int     status;
+
+   while(got < sizeof(buffer))
+   {
+      res = read(fd, buffer+got, sizeof(buffer)-got);
+      if(res < 0 && errno == EINTR)
+      {
+         continue;
+      }
+      if(res <= 0)
+      {
+         break;
+      }
+      got += res;
+   }
+   close(fd);
+   while(waitpid(pid, &status, 0) == -1)
+   {
+      if(errno != EINTR)
+      {
+         SysError("Cannot wait for ordering search worker", SYS_ERROR);
+      }
+   }
+   if(got != sizeof(buffer) || !WIFEXITED(status) ||
+      (WEXITSTATUS(status) != NO_ERROR))
+   {
+      Error("Ordering search worker failed", OTHER_ERROR);
+   }
+   memcpy(best, buffer, sizeof(long));
+   memcpy(best_eval, buffer+sizeof(long), sizeof(double));
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -523,7 +561,8 @@ void HeuristicParmsUpdate(OrderParms_p master, HeuristicParms_p slave)
 // Function: OrderEvaluate()
 //
 //   Given an OCB, evaluate the resulting ordering on the axioms of
-//   state. Low is good.
+//   state. Low is good. Stops as soon as the value reaches bound
+//   (all contributions are non-negative).
 //
 // Global Variables: -
 //
@@ -537,21 +576,30 @@ void HeuristicParmsUpdate(OrderParms_p master, HeuristicParms_p slave)
 #define UNORIENT_LITERAL_PENALTY 1
 
 double OrderEvaluate(OCB_p ocb, ProofState_p state, HeuristicParms_p
-                     parms)
+                     parms, double bound)
 {
-   double res = 0;
+   double   res = 0;
+   double   factor = (ocb->type == KBO)?KBO_BONUS:1;
+   Clause_p handle;
 
-   ClauseSetMarkMaximalTerms(ocb, state->axioms);
-   res+= (ClauseSetCountMaximalTerms(state->axioms)
-          *MAX_TERM_PENALTY);
-   res+= (ClauseSetCountMaximalLiterals(state->axioms)
-          *MAX_LITERAL_PENALTY);
-   res+= (ClauseSetCountUnorientableLiterals(state->axioms)
-          *UNORIENT_LITERAL_PENALTY);
-   if(ocb->type == KBO)
+   for(handle = state->axioms->anchor->succ;
+       handle!=state->axioms->anchor;
+       handle = handle->succ)
    {
-      res = res*KBO_BONUS;
+      /* Orient anew, the result must not depend on the orderings
+         evaluated before */
+      EqnListDelProp(handle->literals, EPMaxIsUpToDate);
+      ClauseMarkMaximalTerms(ocb, handle);
+      res+= (ClauseCountMaximalTerms(handle)*MAX_TERM_PENALTY);
+      res+= (ClauseCountMaximalLiterals(handle)*MAX_LITERAL_PENALTY);
+      res+= (ClauseCountUnorientableLiterals(handle)
+             *UNORIENT_LITERAL_PENALTY);
+      if(res*factor >= bound)
+      {
+         break;
+      }
    }
+   res = res*factor;
    /* printf("OrderEvaluate()=%f\n", res); */
    return res;
 }
@@ -756,20 +804,32 @@ bool OrderNextOrdering(OrderParms_p ordering, OrderParms_p mask)
 // Function: OrderFindOptimal()
 //
 //   Iterate through all orderings matching mask (see previous
-//   function) and find the optimal one. Return a corresponding OCB.
+//   function) and find the optimal one (the first one if there are
+//   several). Return a corresponding OCB. If parms->order_jobs > 1,
+//   the candidates are distributed over that many processes (the
+//   result is the same). Afterwards, the axioms are oriented with
+//   the selected ordering.
 //
 // Global Variables: -
 //
-// Side Effects    : Memory operations, whatever eval_fun does.
+// Side Effects    : Memory operations, may fork, whatever eval_fun
+//                   does.
 //
 /----------------------------------------------------------------------*/
 
 OCB_p OrderFindOptimal(OrderParms_p mask, OrderEvaluationFun eval_fun,
                        ProofState_p state, HeuristicParms_p parms)
 {
-   OrderParmsCell local, store;
-   OCB_p          best_ocb, tmp_ocb;
+   OrderParmsCell local;
+   OrderParms_p   cand;
+   PStack_p       cands = PStackAlloc();
+   OCB_p          best_ocb = NULL;
    double         best_eval, tmp_eval;
+   long           best, tmp, workers, c;
+   pid_t          *pids;
+   int            *fds, pipefd[2];
+   char           buffer[sizeof(long)+sizeof(double)];
+   Clause_p       handle;
 
    VERBOUT("Starting search for optimal term ordering.\n");
    local.ordertype =
@@ -780,33 +840,106 @@ OCB_p OrderFindOptimal(OrderParms_p mask, OrderEvaluationFun eval_fun,
       (mask->to_prec_gen==PNoMethod)?PMinMethod:mask->to_prec_gen;
    local.to_const_weight =
       (mask->to_const_weight==WConstNoWeight)?1:mask->to_const_weight;
+   local.no_lit_cmp = mask->no_lit_cmp;
 
-   store = local;
-   best_ocb  = TOCreateOrdering(state, &local,NULL, NULL);
-   best_eval = eval_fun(best_ocb, state, parms);
-
-   while(OrderNextOrdering(&local, mask))
+   do
    {
-      tmp_ocb  = TOCreateOrdering(state, &local, NULL, NULL);
-      tmp_eval = eval_fun(tmp_ocb, state, parms);
-      if(tmp_eval < best_eval)
+      /* Orienting the axioms is not implemented as a precedence
+         generation scheme */
+      if(local.to_prec_gen != POrientAxioms)
       {
-         OCBFree(best_ocb);
-         best_ocb = tmp_ocb;
-         best_eval = tmp_eval;
-         store = local;
+         cand = OrderParmsCellAlloc();
+         *cand = local;
+         PStackPushP(cands, cand);
+      }
+   }
+   while(OrderNextOrdering(&local, mask));
+   assert(!PStackEmpty(cands));
+
+   workers = MIN(parms->order_jobs,
+                 PStackGetSP(cands)/ORDER_JOB_MIN_CANDIDATES);
+   workers = MAX(workers, 1);
+   pids = SizeMalloc(workers*sizeof(pid_t));
+   fds  = SizeMalloc(workers*sizeof(int));
+   fflush(GlobalOut);
+   fflush(stdout);
+   if(DerivLogFile)
+   {
+      fflush(DerivLogFile);
+   }
+   for(c=1; c<workers; c++)
+   {
+      if(pipe(pipefd) == -1)
+      {
+         SysError("Cannot create pipe for ordering search", SYS_ERROR);
       }
-      else
+      pids[c] = fork();
+      if(pids[c] < 0)
       {
-         OCBFree(tmp_ocb);
+         SysError("Cannot fork ordering search worker", SYS_ERROR);
+      }
+      if(pids[c] == 0)
+      {
+         /* Child */
+         close(pipefd[0]);
+         best = order_search_candidates(cands, c, workers, eval_fun,
+                                        state, parms, &best_eval, NULL);
+         memcpy(buffer, &best, sizeof(long));
+         memcpy(buffer+sizeof(long), &best_eval, sizeof(double));
+         if(write(pipefd[1], buffer, sizeof(buffer))!=sizeof(buffer))
+         {
+            SysError("Cannot write ordering search result", SYS_ERROR);
+         }
+         close(pipefd[1]);
+         exit(NO_ERROR);
+      }
+      close(pipefd[1]);
+      fds[c] = pipefd[0];
+   }
+   best = order_search_candidates(cands, 0, workers, eval_fun,
+                                  state, parms, &best_eval, &best_ocb);
+   for(c=1; c<workers; c++)
+   {
+      order_wait_worker(pids[c], fds[c], &tmp, &tmp_eval);
+      if(tmp != -1 &&
+         ((tmp_eval < best_eval) || (tmp_eval == best_eval && tmp < best)))
+      {
+         best      = tmp;
+         best_eval = tmp_eval;
       }
    }
+   cand = PStackElementP(cands, best);
+   if(best % workers)
+   {
+      /* Winner was found by a worker */
+      OCBFree(best_ocb);
+      best_ocb = TOCreateOrdering(state, cand, NULL, NULL);
+   }
+   /* The axioms are still marked as oriented by the last candidate
+      evaluated here, so force orientation with the winner. */
+   for(handle = state->axioms->anchor->succ;
+       handle!=state->axioms->anchor;
+       handle = handle->succ)
+   {
+      EqnListDelProp(handle->literals, EPMaxIsUpToDate);
+   }
+   ClauseSetMarkMaximalTerms(best_ocb, state->axioms);
+
    VERBOSE(fprintf(stderr, "%s: Term Ordering found: (%s, %s, %s, %ld)\n",
                    ProgName,
-                   TONames[store.ordertype],
-                   TOGetPrecGenName(store.to_prec_gen),
-                   TOGetWeightGenName(store.to_weight_gen),
-                   store.to_const_weight););
+                   TONames[cand->ordertype],
+                   TOGetPrecGenName(cand->to_prec_gen),
+                   TOGetWeightGenName(cand->to_weight_gen),
+                   cand->to_const_weight););
+
+   SizeFree(pids, workers*sizeof(pid_t));
+   SizeFree(fds, workers*sizeof(int));
+   while(!PStackEmpty(cands))
+   {
+      cand = PStackPopP(cands);
+      OrderParmsCellFree(cand);
+   }
+   PStackFree(cands);
    return best_ocb;
 }
 
@@ -836,6 +969,7 @@ OCB_p TOSelectOrdering(ProofState_p state, HeuristicParms_p params,
    {
       OrderParmsCell local;
       OrderParmsInitialize(params, &local);
+      local.ordertype = NoOrdering;
 
       result = OrderFindOptimal(&local, OrderEvaluate, state, params);
    }
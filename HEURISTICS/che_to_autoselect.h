@@ -19,6 +19,8 @@ Changes
 
 <1> Thu Dec 31 17:39:46 MET 1998
     New
+<2> Tue Oct 20 01:12:40 CEST 2026
+    Bounded evaluation, parallel search in OrderFindOptimal().
 
 -----------------------------------------------------------------------*/
 
@@ -47,8 +49,15 @@ typedef struct order_parms_cell
    long              to_const_weight;
 }OrderParmsCell, *OrderParms_p;
 
+/* Evaluation functions may stop as soon as the result is known to be
+   at least bound, and then return any value >= bound. */
+
 typedef double (*OrderEvaluationFun)(OCB_p ocb, ProofState_p state,
-                 HeuristicParms_p parms);
+                 HeuristicParms_p parms, double bound);
+
+/* Minimal number of candidate orderings per search process */
+
+#define ORDER_JOB_MIN_CANDIDATES 8
 
 
 /*---------------------------------------------------------------------*/
@@ -68,7 +77,7 @@ void HeuristicParmsUpdate(OrderParms_p master, HeuristicParms_p slave);
    welcome to do it. Not me, and not now!  */
 
 double OrderEvaluate(OCB_p ocb, ProofState_p state, HeuristicParms_p
-           params);
+           params, double bound);
 
 bool   OrderNextType(OrderParms_p ordering);
 bool   OrderNextWeightGen(OrderParms_p ordering);
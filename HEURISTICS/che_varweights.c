@@ -45,6 +45,28 @@ Changes
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
 
+/*-----------------------------------------------------------------------
+//
+// Function: VarWeightParamAlloc()
+//
+//   Allocate a VarWeightParamCell without a weight cache.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+VarWeightParam_p VarWeightParamAlloc(void)
+{
+   VarWeightParam_p handle = VarWeightParamCellAlloc();
+
+   handle->wcache = NULL;
+
+   return handle;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: TPTPTypeWeightInit()
@@ -66,7 +88,7 @@ WFCB_p TPTPTypeWeightInit(ClausePrioFun prio_fun, int fweight,
            conjecture_multiplier, double
            hypothesis_multiplier)
 {
-   VarWeightParam_p data = VarWeightParamCellAlloc();
+   VarWeightParam_p data = VarWeightParamAlloc();
 
    data->fweight                = fweight;
    data->vweight                = vweight;
@@ -189,7 +211,7 @@ WFCB_p SigWeightInit(ClausePrioFun prio_fun, int fweight,
            max_literal_multiplier, double
            pos_multiplier, double sig_size_multiplier)
 {
-   VarWeightParam_p data = VarWeightParamCellAlloc();
+   VarWeightParam_p data = VarWeightParamAlloc();
 
    data->fweight                = fweight;
    data->vweight                = vweight;
@@ -305,7 +327,7 @@ WFCB_p ProofWeightInit(ClausePrioFun prio_fun, int fweight,
            proof_size_multiplier, double
            proof_depth_multiplier)
 {
-   VarWeightParam_p data = VarWeightParamCellAlloc();
+   VarWeightParam_p data = VarWeightParamAlloc();
 
    data->fweight                = fweight;
    data->vweight                = vweight;
@@ -419,7 +441,7 @@ WFCB_p DepthWeightInit(ClausePrioFun prio_fun, int fweight,
            pos_multiplier, double
              term_weight_multiplier)
 {
-   VarWeightParam_p data = VarWeightParamCellAlloc();
+   VarWeightParam_p data = VarWeightParamAlloc();
 
    data->fweight                = fweight;
    data->vweight                = vweight;
@@ -543,7 +565,7 @@ WFCB_p WeightLessDepthInit(ClausePrioFun prio_fun, int fweight,
              max_literal_multiplier, double
              pos_multiplier, double term_depth_multiplier)
 {
-   VarWeightParam_p data = VarWeightParamCellAlloc();
+   VarWeightParam_p data = VarWeightParamAlloc();
 
    data->fweight                = fweight;
    data->vweight                = vweight;
@@ -668,7 +690,7 @@ WFCB_p NLWeightInit(ClausePrioFun prio_fun, int fweight,
           max_literal_multiplier, double
           pos_multiplier)
 {
-   VarWeightParam_p data = VarWeightParamCellAlloc();
+   VarWeightParam_p data = VarWeightParamAlloc();
 
    data->fweight                = fweight;
    data->vlweight               = vlweight;
@@ -678,6 +700,8 @@ WFCB_p NLWeightInit(ClausePrioFun prio_fun, int fweight,
    data->max_literal_multiplier = max_literal_multiplier;
    data->ocb                    = ocb;
 
+   data->wcache                 = WeightCacheAlloc();
+
    return WFCBAlloc(NLWeightCompute, prio_fun,
                     VarWeightExit, data);
 }
@@ -750,7 +774,8 @@ double NLWeightCompute(void* data, Clause_p clause)
             local->vlweight,
             local->vweight,
             local->fweight,
-            false);
+            false,
+            local->wcache);
    return res;
 }
 
@@ -773,7 +798,7 @@ WFCB_p PNRefinedWeightInit(ClausePrioFun prio_fun, int fweight,
             double max_literal_multiplier, double
             pos_multiplier)
 {
-   VarWeightParam_p data = VarWeightParamCellAlloc();
+   VarWeightParam_p data = VarWeightParamAlloc();
 
    data->fweight                = fweight;
    data->vweight                = vweight;
@@ -896,7 +921,7 @@ WFCB_p SymTypeWeightInit(ClausePrioFun prio_fun, int fweight,
           max_literal_multiplier, double
           pos_multiplier)
 {
-   VarWeightParam_p data = VarWeightParamCellAlloc();
+   VarWeightParam_p data = VarWeightParamAlloc();
 
    data->fweight                = fweight;
    data->vweight                = vweight;
@@ -907,6 +932,8 @@ WFCB_p SymTypeWeightInit(ClausePrioFun prio_fun, int fweight,
    data->max_literal_multiplier = max_literal_multiplier;
    data->ocb                    = ocb;
 
+   data->wcache                 = WeightCacheAlloc();
+
    return WFCBAlloc(SymTypeWeightCompute, prio_fun,
                     VarWeightExit, data);
 }
@@ -979,7 +1006,8 @@ double SymTypeWeightCompute(void* data, Clause_p clause)
               local->vweight,
               local->fweight,
               local->cweight,
-              local->pweight);
+              local->pweight,
+              local->wcache);
    return res;
 }
 
@@ -1000,7 +1028,7 @@ WFCB_p ClauseWeightAgeInit(ClausePrioFun prio_fun, int fweight, int
             vweight, double pos_multiplier,
             double weight_multiplier)
 {
-   VarWeightParam_p data = VarWeightParamCellAlloc();
+   VarWeightParam_p data = VarWeightParamAlloc();
 
    data->fweight                = fweight;
    data->vweight                = vweight;
@@ -1093,7 +1121,7 @@ double ClauseWeightAgeCompute(void* data, Clause_p clause)
 WFCB_p StaggeredWeightInit(ClausePrioFun prio_fun,
             double stagger_factor, ClauseSet_p axioms)
 {
-   VarWeightParam_p data = VarWeightParamCellAlloc();
+   VarWeightParam_p data = VarWeightParamAlloc();
    long clause_max_size = ClauseSetMaxStandardWeight(axioms);
 
    data->stagger_limit = MAX(stagger_factor*clause_max_size,1);
@@ -1171,6 +1199,10 @@ void VarWeightExit(void* data)
 {
    VarWeightParam_p junk = data;
 
+   if(junk->wcache)
+   {
+      WeightCacheFree(junk->wcache);
+   }
    VarWeightParamCellFree(junk);
 }
 
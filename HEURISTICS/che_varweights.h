@@ -55,6 +55,7 @@ typedef struct varweightparamcell
    long   cweight;
    long   pweight;
    long   stagger_limit;
+   WeightCache_p wcache; /* Only for weights that can use it */
 }VarWeightParamCell, *VarWeightParam_p;
 
 
@@ -68,6 +69,8 @@ typedef struct varweightparamcell
 #define VarWeightParamCellFree(junk) \
         SizeFree(junk, sizeof(VarWeightParamCell))
 
+VarWeightParam_p VarWeightParamAlloc(void);
+
 WFCB_p TPTPTypeWeightInit(ClausePrioFun prio_fun, int fweight,
            int vweight, OCB_p ocb, double
            max_term_multiplier, double
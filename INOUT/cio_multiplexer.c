@@ -17,10 +17,15 @@ Changes
 
 <1> Fri Mar 11 20:35:33 CET 2011
     New
+<2> Tue Oct 20 10:12:37 CEST 2026
+    Non-blocking channels with output buffers, TCPMux event sets.
 
 -----------------------------------------------------------------------*/
 
 #include "cio_multiplexer.h"
+#ifdef TCP_MUX_EPOLL
+#include <sys/epoll.h>
+#endif
 
 
 
@@ -28,6 +33,20 @@ Changes
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
+/* Maximal number of messages read from one channel in one go (so
+   that a single client cannot starve the others) */
+
+#define TCP_CHANNEL_READ_MAX 64
+
+/* Already sent output is only discarded from the buffer of a
+   channel that cannot be flushed if it exceeds this size */
+
+#define TCP_CHANNEL_OUT_COMPACT 65536
+
+/* Maximal number of events reported by one call to epoll_wait() */
+
+#define TCP_MUX_MAX_EVENTS 256
+
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -38,6 +57,179 @@ Changes
 /*                         Internal Functions                          */
 /*---------------------------------------------------------------------*/
 
+#ifdef TCP_MUX_EPOLL
+
+/*-----------------------------------------------------------------------
+//
+// Function: mux_epoll_events()
+//
+//   Translate a MuxEventType mask into epoll events and back.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static uint32_t mux_epoll_events(int events)
+{
+   uint32_t res = 0;
+
+   if(events & MuxRead)
+   {
+      res |= EPOLLIN;
+   }
+   if(events & MuxWrite)
+   {
+      res |= EPOLLOUT;
+   }
+   return res;
+}
+
+static int mux_epoll_decode(uint32_t events)
+{
+   int res = MuxNoEvent;
+
+   if(events & EPOLLIN)
+   {
+      res |= MuxRead;
+   }
+   if(events & EPOLLOUT)
+   {
+      res |= MuxWrite;
+   }
+   if(events & (EPOLLERR|EPOLLHUP))
+   {
+      res |= MuxError;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: mux_epoll_ctl()
+//
+//   Thin wrapper around epoll_ctl(), terminating with an error
+//   message if it fails.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the epoll set
+//
+/----------------------------------------------------------------------*/
+
+static void mux_epoll_ctl(TCPMux_p mux, int op, int fd, int events)
+{
+   struct epoll_event ev;
+
+   memset(&ev, 0, sizeof(ev));
+   ev.events  = mux_epoll_events(events);
+   ev.data.fd = fd;
+   if(epoll_ctl(mux->epoll_fd, op, fd, &ev) == -1)
+   {
+      TmpErrno = errno;
+      SysError("epoll_ctl() failed for file descriptor %d", SYS_ERROR, fd);
+   }
+}
+
+#else
+
+/*-----------------------------------------------------------------------
+//
+// Function: mux_poll_events()
+//
+//   Translate a MuxEventType mask into poll() events and back.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static short mux_poll_events(int events)
+{
+   short res = 0;
+
+   if(events & MuxRead)
+   {
+      res |= POLLIN;
+   }
+   if(events & MuxWrite)
+   {
+      res |= POLLOUT;
+   }
+   return res;
+}
+
+static int mux_poll_decode(short events)
+{
+   int res = MuxNoEvent;
+
+   if(events & POLLIN)
+   {
+      res |= MuxRead;
+   }
+   if(events & POLLOUT)
+   {
+      res |= MuxWrite;
+   }
+   if(events & (POLLERR|POLLHUP|POLLNVAL))
+   {
+      res |= MuxError;
+   }
+   return res;
+}
+
+#endif
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: mux_fd_cell()
+//
+//   Return the registration of fd in mux (which must exist).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static TCPMuxFd_p mux_fd_cell(TCPMux_p mux, int fd)
+{
+   TCPMuxFd_p handle;
+
+   assert(fd >= 0);
+   handle = PDArrayElementP(mux->fds, fd);
+   assert(handle);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: mux_ready_grow()
+//
+//   Make sure that mux->ready can hold at least size events.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void mux_ready_grow(TCPMux_p mux, long size)
+{
+   if(size > mux->ready_size)
+   {
+      size = MAX(size, 2*mux->ready_size);
+      mux->ready = SecureRealloc(mux->ready, size*sizeof(TCPMuxEventCell));
+      mux->ready_size = size;
+   }
+}
+
 
 
 /*---------------------------------------------------------------------*/
@@ -49,7 +241,8 @@ Changes
 //
 // Function: TCPChannelAlloc()
 //
-//   Allocate a TCPChannelCell for the provided socket.
+//   Allocate a TCPChannelCell for the provided socket. The socket is
+//   switched to non-blocking mode.
 //
 // Global Variables: -
 //
@@ -61,9 +254,11 @@ TCPChannel_p  TCPChannelAlloc(int sock)
 {
    TCPChannel_p handle = TCPChannelCellAlloc();
 
-   handle->sock  = sock;
-   handle->in    = PQueueAlloc();
-   handle->out   = PQueueAlloc();
+   SetNonBlocking(sock);
+   handle->sock    = sock;
+   handle->in      = PQueueAlloc();
+   handle->out     = DStrAlloc();
+   handle->out_pos = 0;
 
    return handle;
 }
@@ -91,13 +286,7 @@ void TCPChannelFree(TCPChannel_p junk)
       TCPMsgFree(handle);
    }
    PQueueFree(junk->in);
-
-   while(!PQueueEmpty(junk->out))
-   {
-      handle = PQueueGetNextP(junk->out);
-      TCPMsgFree(handle);
-   }
-   PQueueFree(junk->out);
+   DStrFree(junk->out);
    if(junk->sock>=0)
    {
       close(junk->sock);
@@ -158,28 +347,45 @@ bool TCPChannelHasInMsg(TCPChannel_p channel)
 //
 // Function: TCPChannelSendMsg()
 //
-//   Add the message to the out queue.
+//   Append the message to the output buffer and free it. Use
+//   TCPChannelWrite() to actually send it.
 //
 // Global Variables: -
 //
-// Side Effects    : IO, memory
+// Side Effects    : Memory
 //
 /----------------------------------------------------------------------*/
 
 void TCPChannelSendMsg(TCPChannel_p channel, TCPMsg_p msg)
 {
-   PQueueStoreP(channel->out, msg);
+   DStr_p tmp;
+
+   assert(msg->len >= (int)sizeof(uint32_t));
+
+   if(channel->out_pos > TCP_CHANNEL_OUT_COMPACT &&
+      2*channel->out_pos > DStrLen(channel->out))
+   {
+      tmp = DStrAlloc();
+      DStrAppendBuffer(tmp,
+                       DStrAddress(channel->out, channel->out_pos),
+                       DStrLen(channel->out)-channel->out_pos);
+      DStrFree(channel->out);
+      channel->out     = tmp;
+      channel->out_pos = 0;
+   }
+   DStrAppendBuffer(channel->out, DStrAddress(msg->content, 0), msg->len);
+   TCPMsgFree(msg);
 }
 
 /*-----------------------------------------------------------------------
 //
 // Function: TCPChannelSendStr()
 //
-//   Add the string as a message to the out queue.
+//   Add the string as a message to the output buffer.
 //
 // Global Variables: -
 //
-// Side Effects    : IO, memory
+// Side Effects    : Memory
 //
 /----------------------------------------------------------------------*/
 
@@ -194,8 +400,11 @@ void TCPChannelSendStr(TCPChannel_p channel, char* str)
 //
 // Function: TCPChannelRead()
 //
-//   Read data for one message from the socket - either the latest
-//   incomplete message, or a newly allocated one.
+//   Read as much data as is available without blocking (but at most
+//   TCP_CHANNEL_READ_MAX messages), completing the latest incomplete
+//   message first. Return NWSuccess if at least one message has been
+//   completed, NWIncomplete if not, NWError or NWConnClosed on
+//   failure.
 //
 // Global Variables: -
 //
@@ -207,23 +416,28 @@ MsgStatus TCPChannelRead(TCPChannel_p channel)
 {
    TCPMsg_p  current;
    MsgStatus res;
+   int       complete = 0;
 
-   if(PQueueEmpty(channel->in))
-   {
-      current = TCPMsgAlloc();
-      PQueueStoreP(channel->in, current);
-   }
-   else
+   current = PQueueEmpty(channel->in)?NULL:PQueueLookLastP(channel->in);
+   while(complete < TCP_CHANNEL_READ_MAX)
    {
-      current = PQueueLookLastP(channel->in);
-      if(TCP_MSG_COMPLETE(current))
+      if(!current || TCP_MSG_COMPLETE(current))
       {
          current = TCPMsgAlloc();
          PQueueStoreP(channel->in, current);
       }
+      res = TCPMsgRead(channel->sock, current);
+      if(res != NWSuccess)
+      {
+         if(res == NWIncomplete && complete)
+         {
+            return NWSuccess;
+         }
+         return res;
+      }
+      complete++;
    }
-   res = TCPMsgRead(channel->sock, current);
-   return res;
+   return NWSuccess;
 }
 
 
@@ -231,9 +445,9 @@ MsgStatus TCPChannelRead(TCPChannel_p channel)
 //
 // Function: TCPChannelWrite()
 //
-//   Write the current message (if any) as far as possible without
-//   blocking (i.e. try a single "write()"). If the message is
-//   complete, remove it from the queue.
+//   Send as much of the output buffer as possible without
+//   blocking. Return NWSuccess if the buffer has been flushed
+//   completely, NWIncomplete if not, NWError on failure.
 //
 // Global Variables: -
 //
@@ -243,24 +457,325 @@ MsgStatus TCPChannelRead(TCPChannel_p channel)
 
 MsgStatus TCPChannelWrite(TCPChannel_p channel)
 {
-   TCPMsg_p current;
-   MsgStatus res;
+   long remaining;
+   int  res;
 
-   if(PQueueEmpty(channel->in))
+   while((remaining = DStrLen(channel->out)-channel->out_pos) > 0)
    {
-      return NWSuccess;
+      res = send(channel->sock,
+                 DStrAddress(channel->out, channel->out_pos),
+                 remaining,
+                 MSG_NOSIGNAL);
+      if(res < 0 && errno == EINTR)
+      {
+         continue;
+      }
+      if(res < 0)
+      {
+         if(errno == EAGAIN || errno == EWOULDBLOCK)
+         {
+            return NWIncomplete;
+         }
+         return NWError;
+      }
+      channel->out_pos += res;
    }
-   current = PQueueLookP(channel->in);
-   res = TCPMsgWrite(channel->sock, current);
-   if(res == NWSuccess)
+   DStrReset(channel->out);
+   channel->out_pos = 0;
+
+   return NWSuccess;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TCPMuxAlloc()
+//
+//   Allocate an empty TCPMux.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory management, creates epoll instance
+//
+/----------------------------------------------------------------------*/
+
+TCPMux_p TCPMuxAlloc(void)
+{
+   TCPMux_p handle = TCPMuxCellAlloc();
+
+#ifdef TCP_MUX_EPOLL
+   handle->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+   if(handle->epoll_fd == -1)
    {
-      current = PQueueGetNextP(channel->in);
-      TCPMsgFree(current);
+      TmpErrno = errno;
+      SysError("Cannot create epoll instance", SYS_ERROR);
    }
-   return res;
+#else
+   handle->epoll_fd = -1;
+#endif
+   handle->fds        = PDArrayAlloc(64, GROW_EXPONENTIAL);
+   handle->fd_no      = 0;
+   handle->poll_fds   = NULL;
+   handle->poll_size  = 0;
+   handle->ready      = NULL;
+   handle->ready_size = 0;
+   handle->ready_no   = 0;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TCPMuxFree()
+//
+//   Free a TCPMux. The registered file descriptors are not closed.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory management
+//
+/----------------------------------------------------------------------*/
+
+void TCPMuxFree(TCPMux_p junk)
+{
+   long i;
+   TCPMuxFd_p handle;
+
+   for(i=0; i<PDArraySize(junk->fds); i++)
+   {
+      handle = PDArrayElementP(junk->fds, i);
+      if(handle)
+      {
+         TCPMuxFdCellFree(handle);
+      }
+   }
+   PDArrayFree(junk->fds);
+   if(junk->epoll_fd != -1)
+   {
+      close(junk->epoll_fd);
+   }
+   if(junk->poll_fds)
+   {
+      FREE(junk->poll_fds);
+   }
+   if(junk->ready)
+   {
+      FREE(junk->ready);
+   }
+   TCPMuxCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TCPMuxAdd()
+//
+//   Register fd with the given events (a MuxEventType mask) and
+//   associated data (returned with each event on fd).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory management
+//
+/----------------------------------------------------------------------*/
+
+void TCPMuxAdd(TCPMux_p mux, int fd, int events, void* data)
+{
+   TCPMuxFd_p handle = TCPMuxFdCellAlloc();
+
+   assert(fd >= 0);
+   assert(!PDArrayElementP(mux->fds, fd));
+
+   handle->events     = events;
+   handle->data       = data;
+   handle->poll_index = mux->fd_no;
+   PDArrayAssignP(mux->fds, fd, handle);
+#ifdef TCP_MUX_EPOLL
+   mux_epoll_ctl(mux, EPOLL_CTL_ADD, fd, events);
+#else
+   if(mux->fd_no == mux->poll_size)
+   {
+      mux->poll_size = MAX(64, 2*mux->poll_size);
+      mux->poll_fds  = SecureRealloc(mux->poll_fds,
+                                     mux->poll_size*sizeof(struct pollfd));
+   }
+   mux->poll_fds[mux->fd_no].fd      = fd;
+   mux->poll_fds[mux->fd_no].events  = mux_poll_events(events);
+   mux->poll_fds[mux->fd_no].revents = 0;
+#endif
+   mux->fd_no++;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TCPMuxModify()
+//
+//   Change the events fd is watched for.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void TCPMuxModify(TCPMux_p mux, int fd, int events)
+{
+   TCPMuxFd_p handle = mux_fd_cell(mux, fd);
+
+   if(handle->events == events)
+   {
+      return;
+   }
+   handle->events = events;
+#ifdef TCP_MUX_EPOLL
+   mux_epoll_ctl(mux, EPOLL_CTL_MOD, fd, events);
+#else
+   mux->poll_fds[handle->poll_index].events = mux_poll_events(events);
+#endif
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: TCPMuxRemove()
+//
+//   Remove fd from the mux. This has to happen before fd is closed.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory management
+//
+/----------------------------------------------------------------------*/
+
+void TCPMuxRemove(TCPMux_p mux, int fd)
+{
+   TCPMuxFd_p handle = mux_fd_cell(mux, fd);
+
+#ifdef TCP_MUX_EPOLL
+   mux_epoll_ctl(mux, EPOLL_CTL_DEL, fd, MuxNoEvent);
+#else
+   {
+      long last = mux->fd_no-1;
+      TCPMuxFd_p moved;
+
+      if(handle->poll_index != last)
+      {
+         mux->poll_fds[handle->poll_index] = mux->poll_fds[last];
+         moved = mux_fd_cell(mux, mux->poll_fds[last].fd);
+         moved->poll_index = handle->poll_index;
+      }
+   }
+#endif
+   PDArrayAssignP(mux->fds, fd, NULL);
+   TCPMuxFdCellFree(handle);
+   mux->fd_no--;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TCPMuxWait()
+//
+//   Wait for events on the registered file descriptors for at most
+//   timeout milliseconds (forever if timeout is negative). Return the
+//   number of events, which can be accessed with TCPMuxEvent(mux,
+//   i). An interrupted wait returns 0 events, other failures -1.
+//
+// Global Variables: -
+//
+// Side Effects    : Blocks
+//
+/----------------------------------------------------------------------*/
+
+long TCPMuxWait(TCPMux_p mux, int timeout)
+{
+   long i, res;
+#ifdef TCP_MUX_EPOLL
+   struct epoll_event events[TCP_MUX_MAX_EVENTS];
+#endif
+
+   mux->ready_no = 0;
+#ifdef TCP_MUX_EPOLL
+   res = epoll_wait(mux->epoll_fd, events, TCP_MUX_MAX_EVENTS, timeout);
+   if(res == -1)
+   {
+      return (errno == EINTR)?0:-1;
+   }
+   mux_ready_grow(mux, res);
+   for(i=0; i<res; i++)
+   {
+      mux->ready[i].fd     = events[i].data.fd;
+      mux->ready[i].events = mux_epoll_decode(events[i].events);
+      mux->ready[i].data   = mux_fd_cell(mux, events[i].data.fd)->data;
+   }
+   mux->ready_no = res;
+#else
+   res = poll(mux->poll_fds, mux->fd_no, timeout);
+   if(res == -1)
+   {
+      return (errno == EINTR)?0:-1;
+   }
+   mux_ready_grow(mux, res);
+   for(i=0; i<mux->fd_no && mux->ready_no<res; i++)
+   {
+      if(mux->poll_fds[i].revents)
+      {
+         mux->ready[mux->ready_no].fd     = mux->poll_fds[i].fd;
+         mux->ready[mux->ready_no].events =
+            mux_poll_decode(mux->poll_fds[i].revents);
+         mux->ready[mux->ready_no].data   =
+            mux_fd_cell(mux, mux->poll_fds[i].fd)->data;
+         mux->ready_no++;
+      }
+   }
+#endif
+   return mux->ready_no;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TCPMuxAddChannel()
+//
+//   Register the socket of the channel with the mux.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory management
+//
+/----------------------------------------------------------------------*/
+
+void TCPMuxAddChannel(TCPMux_p mux, TCPChannel_p channel, void* data)
+{
+   assert(channel->sock >= 0);
+   TCPMuxAdd(mux, channel->sock,
+             TCPChannelHasOutMsg(channel)?(MuxRead|MuxWrite):MuxRead,
+             data);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TCPMuxUpdateChannel()
+//
+//   Watch the channel for writability if and only if it has buffered
+//   output.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+void TCPMuxUpdateChannel(TCPMux_p mux, TCPChannel_p channel)
+{
+   assert(channel->sock >= 0);
+   TCPMuxModify(mux, channel->sock,
+                TCPChannelHasOutMsg(channel)?(MuxRead|MuxWrite):MuxRead);
+}
+
 
 
 
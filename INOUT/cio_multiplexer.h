@@ -6,7 +6,9 @@ Author: Stephan Schulz (schulz@eprover.org)
 
 Contents
 
-  Code for handling several communication channels.
+  Code for handling several communication channels. Channels are
+  non-blocking, and a TCPMux waits for events on any number of file
+  descriptors (using epoll where available, poll() otherwise).
 
   Copyright 2011 by the author.
   This code is released under the GNU General Public Licence.
@@ -17,6 +19,8 @@ Changes
 
 <1> Fri Mar 11 21:00:09 CET 2011
     New
+<2> Tue Oct 20 10:12:37 CEST 2026
+    Non-blocking channels with output buffers, TCPMux event sets.
 
 -----------------------------------------------------------------------*/
 
@@ -25,8 +29,14 @@ Changes
 #define CIO_MULTIPLEXER
 
 
+#include <poll.h>
+#include <clb_pdarrays.h>
 #include <cio_network.h>
 
+#ifdef __linux__
+#define TCP_MUX_EPOLL
+#endif
+
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -37,10 +47,47 @@ typedef struct tcp_channel_cell
 {
    int             sock;
    PQueue_p        in;
-   PQueue_p        out;
+   DStr_p          out;      /* Packed messages not yet sent... */
+   long            out_pos;  /* ...starting at this position */
 }TCPChannelCell, *TCPChannel_p;
 
 
+/* Events a TCPMux waits for/reports. MuxError (error or hangup) is
+   always reported, and need not be requested. */
+
+typedef enum
+{
+   MuxNoEvent = 0,
+   MuxRead    = 1,
+   MuxWrite   = 2,
+   MuxError   = 4
+}MuxEventType;
+
+typedef struct tcp_mux_fd_cell
+{
+   int   events;
+   void* data;
+   long  poll_index; /* Only used with poll() */
+}TCPMuxFdCell, *TCPMuxFd_p;
+
+typedef struct tcp_mux_event_cell
+{
+   int   fd;
+   int   events;
+   void* data;
+}TCPMuxEventCell, *TCPMuxEvent_p;
+
+typedef struct tcp_mux_cell
+{
+   int             epoll_fd;   /* Only used with epoll */
+   PDArray_p       fds;        /* Indexed by file descriptor */
+   long            fd_no;
+   struct pollfd   *poll_fds;  /* Only used with poll() */
+   long            poll_size;
+   TCPMuxEvent_p   ready;      /* Result of the last TCPMuxWait() */
+   long            ready_size;
+   long            ready_no;
+}TCPMuxCell, *TCPMux_p;
 
 
 /*---------------------------------------------------------------------*/
@@ -63,7 +110,8 @@ void   XXXFree(XXX_p junk);
 TCPChannel_p  TCPChannelAlloc(int sock);
 void          TCPChannelFree(TCPChannel_p junk);
 void          TCPChannelClose(TCPChannel_p channel);
-#define       TCPChannelHasOutMsg(channel) (!PQueueEmpty(channel->out))
+#define       TCPChannelHasOutMsg(channel) \
+              ((channel)->out_pos < DStrLen((channel)->out))
 bool          TCPChannelHasInMsg(TCPChannel_p channel);
 #define       TCPChannelGetInMsg(channel) (PQueueGetNextP((channel)->in))
 void          TCPChannelSendMsg(TCPChannel_p channel, TCPMsg_p msg);
@@ -72,6 +120,25 @@ void          TCPChannelSendStr(TCPChannel_p channel, char* str);
 MsgStatus     TCPChannelRead(TCPChannel_p channel);
 MsgStatus     TCPChannelWrite(TCPChannel_p channel);
 
+#define TCPMuxFdCellAlloc()    (TCPMuxFdCell*)SizeMalloc(sizeof(TCPMuxFdCell))
+#define TCPMuxFdCellFree(junk) SizeFree(junk, sizeof(TCPMuxFdCell))
+#define TCPMuxCellAlloc()      (TCPMuxCell*)SizeMalloc(sizeof(TCPMuxCell))
+#define TCPMuxCellFree(junk)   SizeFree(junk, sizeof(TCPMuxCell))
+
+TCPMux_p      TCPMuxAlloc(void);
+void          TCPMuxFree(TCPMux_p junk);
+void          TCPMuxAdd(TCPMux_p mux, int fd, int events, void* data);
+void          TCPMuxModify(TCPMux_p mux, int fd, int events);
+void          TCPMuxRemove(TCPMux_p mux, int fd);
+#define       TCPMuxFdNo(mux) ((mux)->fd_no)
+long          TCPMuxWait(TCPMux_p mux, int timeout);
+#define       TCPMuxEvent(mux, i) (&((mux)->ready[(i)]))
+
+void          TCPMuxAddChannel(TCPMux_p mux, TCPChannel_p channel,
+                               void* data);
+void          TCPMuxUpdateChannel(TCPMux_p mux, TCPChannel_p channel);
+#define       TCPMuxRemoveChannel(mux, channel) \
+              TCPMuxRemove((mux), (channel)->sock)
 
 
 #endif
@@ -19,12 +19,17 @@ Contents
 Changes
 
 <1>     New
+<2> Tue Oct 20 10:12:37 CEST 2026
+    TCPMsgRead()/TCPMsgWrite() transfer as much as possible and
+    report NWIncomplete for would-block on non-blocking sockets.
 
 -----------------------------------------------------------------------*/
 
 #include <netinet/in.h>
 #include <sys/socket.h>
 #include <netdb.h>
+#include <fcntl.h>
+#include <limits.h>
 
 #include "cio_network.h"
 
@@ -34,8 +39,8 @@ Changes
 /*                        Global Variables                             */
 /*---------------------------------------------------------------------*/
 
-#define TCP_BACKLOG 10
-#define TCP_BUF_SIZE 1025
+#define TCP_BACKLOG SOMAXCONN
+#define TCP_BUF_SIZE 16384
 
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
@@ -47,6 +52,34 @@ Changes
 /*---------------------------------------------------------------------*/
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: tcp_io_status()
+//
+//   Translate the failed (res <= 0) result of a read()/write() call
+//   into a message status. A would-block on a non-blocking socket is
+//   NWIncomplete.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static MsgStatus tcp_io_status(int res)
+{
+   if(res == 0)
+   {
+      return NWConnClosed;
+   }
+   if(errno == EAGAIN || errno == EWOULDBLOCK)
+   {
+      return NWIncomplete;
+   }
+   return NWError;
+}
+
+
 
 /*-----------------------------------------------------------------------
 //
@@ -248,9 +281,10 @@ char* TCPMsgUnpack(TCPMsg_p msg)
 //
 // Function: TCPMsgWrite()
 //
-//   Send the message over the socket. Return NWError, NWIncomplete,
-//   or NWSuccess depending on wether the transmission was partial,
-//   complete or a failure.
+//   Send as much of the message over the socket as possible without
+//   blocking (on a non-blocking socket). Return NWError,
+//   NWIncomplete, or NWSuccess depending on wether the transmission
+//   was a failure, partial, or complete.
 //
 // Global Variables: -
 //
@@ -260,21 +294,23 @@ char* TCPMsgUnpack(TCPMsg_p msg)
 
 MsgStatus TCPMsgWrite(int sock, TCPMsg_p msg)
 {
-   int remaining, res;
-
-   remaining = msg->len-msg->transmission_count;
+   int res;
 
-   res = write(sock,
-              DStrAddress(msg->content, msg->transmission_count),
-              remaining);
-   if(res < 0 )
+   while(!TCP_MSG_COMPLETE(msg))
    {
-      return NWError;
-   }
-   msg->transmission_count+=res;
-   if(!TCP_MSG_COMPLETE(msg))
-   {
-      return NWIncomplete;
+      res = send(sock,
+                 DStrAddress(msg->content, msg->transmission_count),
+                 msg->len-msg->transmission_count,
+                 MSG_NOSIGNAL);
+      if(res < 0 && errno == EINTR)
+      {
+         continue;
+      }
+      if(res <= 0)
+      {
+         return res?tcp_io_status(res):NWError;
+      }
+      msg->transmission_count+=res;
    }
    return NWSuccess;
 }
@@ -284,12 +320,13 @@ MsgStatus TCPMsgWrite(int sock, TCPMsg_p msg)
 //
 // Function: TCPMsgRead()
 //
-//   Receive a (partial) TCP message. Return NWError, NWIncomplete,
-//   or NWSuccess depending on wether the transmission was partial,
-//   complete or a failure. Return NWConnClosed if the connection was
-//   closed. This assumes that the message
-//   itself is plain ASCII string (i.e. no '\0' in the message),
-//   although it probably works otherwise.
+//   Receive as much of a TCP message as possible without blocking
+//   (on a non-blocking socket), but never more than the message
+//   itself. Return NWError, NWIncomplete, or NWSuccess depending on
+//   wether the transmission was a failure, partial, or
+//   complete. Return NWConnClosed if the connection was closed. This
+//   assumes that the message itself is plain ASCII string (i.e. no
+//   '\0' in the message), although it probably works otherwise.
 //
 // Global Variables: -
 //
@@ -304,50 +341,47 @@ MsgStatus TCPMsgRead(int sock, TCPMsg_p msg)
    int      res;
 
    /* Handle header */
-   if(msg->transmission_count < (int)sizeof(uint32_t))
+   while(msg->transmission_count < (int)sizeof(uint32_t))
    {
       res = read(sock,
                  msg->len_buf+msg->transmission_count,
                  sizeof(uint32_t)-msg->transmission_count);
-      printf("read(Size)=%d\n", res);
-      if(res < 0)
+      if(res < 0 && errno == EINTR)
       {
-         return NWError;
+         continue;
       }
-      if(res ==0)
+      if(res <= 0)
       {
-         return NWConnClosed;
+         return tcp_io_status(res);
       }
       msg->transmission_count += res;
-      if(msg->transmission_count < (int)sizeof(uint32_t))
-      {
-         return 0;
-      }
+   }
+   if(msg->len == -1)
+   {
       memcpy(&len, msg->len_buf, sizeof(uint32_t));
       len = ntohl(len);
-      printf("Message expected with %d bytes\n", len);
+      if(len < sizeof(uint32_t) || len > INT_MAX)
+      {
+         return NWError;
+      }
       msg->len = len;
       DStrAppendBuffer(msg->content, msg->len_buf, sizeof(uint32_t));
    }
    /* Rest */
-   len = MIN(TCP_BUF_SIZE-1, msg->len - msg->transmission_count);
-   res = read(sock, buffer, len);
-   printf("read(msg)=%d\n", res);
-   if(res < 0)
+   while(!TCP_MSG_COMPLETE(msg))
    {
-      return NWError;
-   }
-   if(res ==0)
-   {
-      return NWConnClosed;
-   }
-   buffer[len] = '\0';
-   DStrAppendStr(msg->content, buffer);
-   msg->transmission_count += res;
-
-   if(!TCP_MSG_COMPLETE(msg))
-   {
-      return NWIncomplete;
+      len = MIN(TCP_BUF_SIZE, msg->len - msg->transmission_count);
+      res = read(sock, buffer, len);
+      if(res < 0 && errno == EINTR)
+      {
+         continue;
+      }
+      if(res <= 0)
+      {
+         return tcp_io_status(res);
+      }
+      DStrAppendBuffer(msg->content, buffer, res);
+      msg->transmission_count += res;
    }
    return NWSuccess;
 }
@@ -563,7 +597,33 @@ void Listen(int sock)
    {
       TmpErrno = errno;
       SysError("Failed to switch socket %d to listening",
-               SYS_ERROR, socket);
+               SYS_ERROR, sock);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SetNonBlocking()
+//
+//   Switch the socket (or other file descriptor) to non-blocking
+//   mode, terminating with an error message if this fails.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes file descriptor flags
+//
+/----------------------------------------------------------------------*/
+
+void SetNonBlocking(int sock)
+{
+   int flags = fcntl(sock, F_GETFL, 0);
+
+   if(flags == -1 || fcntl(sock, F_SETFL, flags|O_NONBLOCK) == -1)
+   {
+      TmpErrno = errno;
+      SysError("Cannot switch socket %d to non-blocking mode",
+               SYS_ERROR, sock);
    }
 }
 
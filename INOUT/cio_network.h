@@ -19,6 +19,8 @@ Changes
 
 <1> Wed Mar  9 22:24:40 CET 2011
     New
+<2> Tue Oct 20 10:12:37 CEST 2026
+    Added SetNonBlocking()
 
 -----------------------------------------------------------------------*/
 
@@ -31,6 +33,12 @@ Changes
 #include <clb_dstrings.h>
 #include <clb_pqueue.h>
 
+/* Platforms without MSG_NOSIGNAL need to ignore SIGPIPE instead */
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
 /* send_msg(char* msg) -> len, bytes*/
 /* char* recv_msg()...*/
 
@@ -92,6 +100,7 @@ char*     TCPStringRecvX(int sock);
 
 int  CreateServerSock(int port);
 void Listen(int sock);
+void SetNonBlocking(int sock);
 
 int  CreateClientSock(char* host, int port);
 
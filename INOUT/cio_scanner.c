@@ -76,6 +76,9 @@ static TokenRepCell token_print_rep[] =
 
 };
 
+unsigned char ScannerCharClass[UCHAR_MAX+1];
+static bool   char_class_initialized = false;
+
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
 /*---------------------------------------------------------------------*/
@@ -86,6 +89,51 @@ static TokenRepCell token_print_rep[] =
 /*---------------------------------------------------------------------*/
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: init_char_classes()
+//
+//   Initialize ScannerCharClass[] from the C library character
+//   classification.
+//
+// Global Variables: ScannerCharClass, char_class_initialized
+//
+// Side Effects    : See above
+//
+/----------------------------------------------------------------------*/
+
+static void init_char_classes(void)
+{
+   int ch;
+
+   for(ch=0; ch<=UCHAR_MAX; ch++)
+   {
+      ScannerCharClass[ch] = 0;
+      if(isspace(ch))
+      {
+         ScannerCharClass[ch] |= CC_SPACE;
+      }
+      if(isdigit(ch))
+      {
+         ScannerCharClass[ch] |= CC_DIGIT;
+      }
+      if(isalpha(ch) || ch == '_')
+      {
+         ScannerCharClass[ch] |= CC_IDSTART;
+      }
+      if(isalnum(ch) || ch == '_')
+      {
+         ScannerCharClass[ch] |= CC_IDCHAR;
+      }
+      if(ch != '\n')
+      {
+         ScannerCharClass[ch] |= CC_NOTNL;
+      }
+   }
+   char_class_initialized = true;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: scan_white()
@@ -102,11 +150,8 @@ static TokenRepCell token_print_rep[] =
 static void scan_white(Scanner_p in)
 {
    AktToken(in)->tok = WhiteSpace;
-   while(isspace(CurrChar(in)))
-   {
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
-   }
+   StreamAppendSpan(in->source, AktToken(in)->literal,
+                    ScannerCharClass, CC_SPACE);
 }
 
 
@@ -125,21 +170,21 @@ static void scan_white(Scanner_p in)
 
 static void scan_ident(Scanner_p in)
 {
-   long numstart = 0,
-        i;
+   long start = DStrLen(AktToken(in)->literal),
+        len, numstart = 0;
+   char *id;
+
+   len = StreamAppendSpan(in->source, AktToken(in)->literal,
+                          ScannerCharClass, CC_IDCHAR);
 
-   for(i=0; isidchar(CurrChar(in)); i++)
+   /* Find the trailing digits (if any), which make this an Idnum. The
+      first character of an identifier is never a digit. */
+
+   id = DStrView(AktToken(in)->literal)+start;
+   while(len > 1 && isdigit((unsigned char)id[len-1]))
    {
-      if(!numstart && isdigit(CurrChar(in)))
-      {
-    numstart = i;
-      }
-      else if(!isdigit(CurrChar(in)))
-      {
-    numstart = 0;
-      }
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
+      len--;
+      numstart = start+len;
    }
    if(numstart)
    {
@@ -176,11 +221,8 @@ static void scan_int(Scanner_p in)
 {
    AktToken(in)->tok = PosInt;
 
-   while(isdigit(CurrChar(in)))
-   {
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
-   }
+   StreamAppendSpan(in->source, AktToken(in)->literal,
+                    ScannerCharClass, CC_DIGIT);
    errno = 0;
    AktToken(in)->numval =
       strtol(DStrView(AktToken(in)->literal), NULL, 10);
@@ -213,11 +255,8 @@ static void scan_line_comment(Scanner_p in)
 {
    AktToken(in)->tok = Comment;
 
-   while((CurrChar(in)) != '\n' && (CurrChar(in)!=EOF))
-   {
-      DStrAppendChar(AktToken(in)->literal, CurrChar(in));
-      NextChar(in);
-   }
+   StreamAppendSpan(in->source, AktToken(in)->literal,
+                    ScannerCharClass, CC_NOTNL);
    DStrAppendChar(AktToken(in)->literal, '\n');
    NextChar(in); /* Should be harmless even at EOF */
 }
@@ -328,7 +367,7 @@ static Token_p scan_token(Scanner_p in)
    {
       AktToken(in)->tok = NoToken;
    }
-   else if(isspace(CurrChar(in)))
+   else if(isscanspace(CurrChar(in)))
    {
       scan_white(in);
    }
@@ -336,7 +375,7 @@ static Token_p scan_token(Scanner_p in)
    {
       scan_ident(in);
    }
-   else if(isdigit(CurrChar(in)))
+   else if(isscandigit(CurrChar(in)))
    {
       scan_int(in);
    }
@@ -800,7 +839,10 @@ Scanner_p CreateScanner(StreamType type, char *name, bool
    Stream_p  stream;
    char      *tmp_name;
 
-
+   if(!char_class_initialized)
+   {
+      init_char_classes();
+   }
    handle = ScannerCellAlloc();
    handle->source = NULL;
    handle->default_dir = DStrAlloc();
@@ -172,8 +172,26 @@ typedef struct scannercell
 
 #define  ScannerGetDefaultDir(scanner) DStrView((scanner)->default_dir)
 
-#define isstartidchar(ch)  (isalpha(ch) || (ch) == '_')
-#define isidchar(ch)       (isalnum(ch) || (ch) == '_')
+/* Character classes for the scanner. ScannerCharClass[] is indexed
+   by unsigned character values and initialized by CreateScanner()
+   from the C library classification, so the macros below are
+   equivalent to the ctype-based definitions, but need only a single
+   table lookup. */
+
+#define CC_SPACE   1
+#define CC_DIGIT   2
+#define CC_IDSTART 4
+#define CC_IDCHAR  8
+#define CC_NOTNL   16
+
+extern unsigned char ScannerCharClass[UCHAR_MAX+1];
+
+#define charclass(ch, cls) ((ch)!=EOF && (ScannerCharClass[(ch)]&(cls)))
+
+#define isstartidchar(ch)  charclass((ch), CC_IDSTART)
+#define isidchar(ch)       charclass((ch), CC_IDCHAR)
+#define isscanspace(ch)    charclass((ch), CC_SPACE)
+#define isscandigit(ch)    charclass((ch), CC_DIGIT)
 #define ischar(ch)         ((ch)!=EOF)
 #define isstartcomment(ch) ((ch)=='#' || (ch)=='%')
 
@@ -18,6 +18,8 @@ Changes
 
 <1> Sat Jul  5 02:28:25 MET DST 1997
     New
+<2> Wed Oct 21 11:37:16 CEST 2026
+    StreamFileLog
 
 -----------------------------------------------------------------------*/
 
@@ -42,6 +44,11 @@ const StreamType StreamTypeUserString =
 const StreamType StreamTypeOptionString =
 "Parsing a user given option argument";
 
+/* If set, CreateStream() pushes a copy of the name of every file it
+   opens onto this stack (the caller owns the stack and the names). */
+
+PStack_p StreamFileLog = NULL;
+
 /*---------------------------------------------------------------------*/
 /*                      Forward Declarations                           */
 /*---------------------------------------------------------------------*/
@@ -54,50 +61,78 @@ const StreamType StreamTypeOptionString =
 
 /*-----------------------------------------------------------------------
 //
-// Function: read_char()
+// Function: read_block()
 //
-//   Read a character and return it. Return an infinite sequence of
-//   EOFs after the end of file.
+//   Read up to max characters into dest and return the number of
+//   characters read. Return 0 (and set eof_seen) at the end of the
+//   input. Regular files are read with a single fread() per block,
+//   strings are copied directly. stdin may be interactive, so we
+//   never read more from it than has been requested.
 //
 // Global Variables: -
 //
-// Side Effects    : May read a character
+// Side Effects    : Reads input
 //
 /----------------------------------------------------------------------*/
 
-static int read_char(Stream_p stream)
+static int read_block(Stream_p stream, int *dest, int max)
 {
-   int ch;
+   unsigned char block[STREAMBUFSIZE];
+   unsigned char *src;
+   int ch, i, res = 0;
+
+   assert(max <= STREAMBUFSIZE);
 
    if(stream->eof_seen)
    {
-      ch = EOF;
+      return 0;
+   }
+   if(stream->stream_type!=StreamTypeFile)
+   {
+      src = (unsigned char*)DStrView(stream->source)+stream->string_pos;
+      while(res < max && src[res])
+      {
+         dest[res] = src[res];
+         res++;
+      }
+      stream->string_pos += res;
+      if(res < max)
+      {
+         stream->eof_seen = true;
+      }
+   }
+   else if(stream->file == stdin)
+   {
+      while(res < max)
+      {
+         ch = getc(stream->file);
+         if(ch == EOF)
+         {
+            stream->eof_seen = true;
+            break;
+         }
+         dest[res++] = ch;
+      }
    }
    else
    {
-      if(stream->stream_type!=StreamTypeFile)
+      res = fread(block, 1, max, stream->file);
+      if(res < max)
       {
-    ch = (int)DStrView(stream->source)[stream->string_pos];
-    if(ch)
-    {
-       stream->string_pos++;
-    }
-    else
-    {
-       ch = EOF;
-       stream->eof_seen = true;
-    }
+         if(ferror(stream->file))
+         {
+            TmpErrno = errno;
+            sprintf(ErrStr, "Cannot read from %s", DStrView(stream->source));
+            SysError(ErrStr, FILE_ERROR);
+         }
+         stream->eof_seen = true;
       }
-      else
+      for(i=0; i<res; i++)
       {
-    ch = getc(stream->file);
-    if(ch == EOF)
-    {
-       stream->eof_seen = true;
-    }
+         dest[i] = block[i];
       }
    }
-   return ch;
+   return res;
 }
 
 /*---------------------------------------------------------------------*/
@@ -112,7 +147,7 @@ static int read_char(Stream_p stream)
 //   Create a stream associated with the file name. Both the
 //   NULL-pointer and the name "-" are taken to mean stdin.
 //
-// Global Variables: -
+// Global Variables: StreamFileLog
 //
 // Side Effects    : May terminate with an error message
 //
@@ -121,7 +156,6 @@ static int read_char(Stream_p stream)
 Stream_p CreateStream(StreamType type, char* source, bool fail)
 {
    Stream_p handle;
-   int      i;
 
    handle = StreamCellAlloc();
 
@@ -148,6 +182,10 @@ Stream_p CreateStream(StreamType type, char* source, bool fail)
             StreamCellFree(handle);
             return NULL;
          }
+         if(StreamFileLog)
+         {
+            PStackPushP(StreamFileLog, SecureStrdup(source));
+         }
       }
       VERBOUTARG("Opened ", DStrView(handle->source));
    }
@@ -163,11 +201,10 @@ Stream_p CreateStream(StreamType type, char* source, bool fail)
    handle->line       = 1;
    handle->column     = 1;
    handle->current    = 0;
+   handle->fill       = 0;
+   handle->buffer     = SizeMalloc(STREAMBUFSIZE*sizeof(int));
 
-   for(i=0; i<MAXLOOKAHEAD; i++)
-   {
-      handle->buffer[i] = read_char(handle);
-   }
+   StreamRefill(handle);
 
    return handle;
 }
@@ -202,40 +239,117 @@ void DestroyStream(Stream_p stream)
       VERBOUTARG("Closing ", DStrView(stream->source));
    }
    DStrFree(stream->source);
+   SizeFree(stream->buffer, STREAMBUFSIZE*sizeof(int));
    StreamCellFree(stream);
 }
 
 
 /*-----------------------------------------------------------------------
 //
-// Function: StreamNextChar()
+// Function: StreamRefill()
 //
-//   Move the current window on the input stream one character
-//   forward. Return the new CurrChar().
+//   Move the remaining lookahead window to the start of the buffer
+//   and fill up the rest from the input. After the end of input, the
+//   buffer is padded with EOFs, so that StreamLookChar() always sees
+//   at least MAXLOOKAHEAD valid characters.
 //
 // Global Variables: -
 //
-// Side Effects    : Reads one character from the input, update the
-//                   stream information about the current position.
+// Side Effects    : Reads input
 //
 /----------------------------------------------------------------------*/
 
-int StreamNextChar(Stream_p stream)
+void StreamRefill(Stream_p stream)
 {
-   if(StreamCurrChar(stream) == '\n')
+   int rest = stream->fill - stream->current;
+
+   if(rest > 0)
    {
-      stream->line++;
-      stream->column = 1;
+      memmove(stream->buffer, stream->buffer+stream->current,
+              rest*sizeof(int));
    }
    else
    {
-      stream->column++;
+      rest = 0;
+   }
+   stream->current = 0;
+   stream->fill    = rest;
+
+   if(stream->stream_type==StreamTypeFile && stream->file==stdin)
+   {
+      stream->fill += read_block(stream, stream->buffer+stream->fill,
+                                 MAXLOOKAHEAD-rest);
+   }
+   else
+   {
+      stream->fill += read_block(stream, stream->buffer+stream->fill,
+                                 STREAMBUFSIZE-rest);
+   }
+   if(stream->eof_seen)
+   {
+      while(stream->fill < STREAMBUFSIZE)
+      {
+         stream->buffer[stream->fill++] = EOF;
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StreamAppendSpan()
+//
+//   Append the longest sequence of characters starting at the
+//   current position for which class_table[ch]&class_mask is
+//   non-zero to str, and move the stream behind it. Return the
+//   length of the span. This is equivalent to, but much cheaper
+//   than, a StreamNextChar()/DStrAppendChar() loop.
+//
+// Global Variables: -
+//
+// Side Effects    : Reads input, changes str.
+//
+/----------------------------------------------------------------------*/
+
+long StreamAppendSpan(Stream_p stream, DStr_p str,
+                      const unsigned char *class_table,
+                      unsigned char class_mask)
+{
+   char chunk[MAXLOOKAHEAD];
+   long res = 0;
+   int  ch, i;
+
+   do
+   {
+      for(i=0; i<MAXLOOKAHEAD; i++)
+      {
+         ch = StreamCurrChar(stream);
+         if(ch==EOF || !(class_table[ch]&class_mask))
+         {
+            break;
+         }
+         chunk[i] = ch;
+         if(ch == '\n')
+         {
+            stream->line++;
+            stream->column = 1;
+         }
+         else
+         {
+            stream->column++;
+         }
+         stream->current++;
+         if(stream->current+MAXLOOKAHEAD > stream->fill)
+         {
+            StreamRefill(stream);
+         }
+      }
+      DStrAppendBuffer(str, chunk, i);
+      res += i;
    }
-   stream->current=STREAMREALPOS(stream->current+1);
-   stream->buffer[STREAMREALPOS(stream->current+MAXLOOKAHEAD-1)]
-      = read_char(stream);
+   while(i==MAXLOOKAHEAD);
 
-   return StreamCurrChar(stream);
+   return res;
 }
 
 
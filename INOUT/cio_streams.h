@@ -28,6 +28,7 @@ Changes
 
 #define CIO_STREAMS
 
+#include <clb_pstacks.h>
 #include <cio_initio.h>
 #include <cio_fileops.h>
 
@@ -37,6 +38,13 @@ Changes
 
 #define MAXLOOKAHEAD 64
 
+/* Input is read in blocks of this many characters. The buffer holds
+   one block plus the lookahead window carried over from the previous
+   block. */
+
+#define STREAMBLOCKSIZE 65536
+#define STREAMBUFSIZE   (STREAMBLOCKSIZE+MAXLOOKAHEAD)
+
 
 /* Streams can read either from a file or from several predefined
    classes of strings. We use a StreamType 'virtual type' to denote
@@ -63,8 +71,10 @@ typedef struct streamcell
    bool               eof_seen;
    long               line;
    long               column;
-   int                buffer[MAXLOOKAHEAD];
-   int                current;
+   int                *buffer;    /* STREAMBUFSIZE characters, EOF
+                                     padded after the end of input */
+   int                current;    /* Index of the current character */
+   int                fill;       /* First unused position in buffer */
 }StreamCell, *Stream_p, **Inpstack_p;
 
 
@@ -76,6 +86,7 @@ extern const StreamType StreamTypeFile;
 extern const StreamType StreamTypeInternalString;
 extern const StreamType StreamTypeUserString;
 extern const StreamType StreamTypeOptionString;
+extern PStack_p         StreamFileLog;
 
 
 #define StreamCellAlloc() (StreamCell*)SizeMalloc(sizeof(StreamCell))
@@ -84,22 +95,63 @@ extern const StreamType StreamTypeOptionString;
 Stream_p CreateStream(StreamType type, char* source, bool fail);
 void     DestroyStream(Stream_p stream);
 
-#define  STREAMREALPOS(pos) ((pos) % MAXLOOKAHEAD)
-
 #define  StreamLookChar(stream, look)\
          (assert((look)<MAXLOOKAHEAD),\
-     (stream)->buffer[STREAMREALPOS((stream)->current+(look))])
+     (stream)->buffer[(stream)->current+(look)])
 #define  StreamCurrChar(stream) ((stream)->buffer[(stream)->current])
 #define  StreamCurrLine(stream)   ((stream)->line)
 #define  StreamCurrColumn(stream) ((stream)->column)
 
-int      StreamNextChar(Stream_p stream);
+void     StreamRefill(Stream_p stream);
+static __inline__ int StreamNextChar(Stream_p stream);
+long     StreamAppendSpan(Stream_p stream, DStr_p str,
+                          const unsigned char *class_table,
+                          unsigned char class_mask);
 
 Stream_p OpenStackedInput(Inpstack_p stack, StreamType type,
            char* source, bool fail);
 void     CloseStackedInput(Inpstack_p stack);
 
 
+/*---------------------------------------------------------------------*/
+/*                       Inline-Functions                              */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: StreamNextChar()
+//
+//   Move the current window on the input stream one character
+//   forward. Return the new CurrChar().
+//
+// Global Variables: -
+//
+// Side Effects    : May read a new block from the input, update the
+//                   stream information about the current position.
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ int StreamNextChar(Stream_p stream)
+{
+   if(StreamCurrChar(stream) == '\n')
+   {
+      stream->line++;
+      stream->column = 1;
+   }
+   else
+   {
+      stream->column++;
+   }
+   stream->current++;
+   if(stream->current+MAXLOOKAHEAD > stream->fill)
+   {
+      StreamRefill(stream);
+   }
+   return StreamCurrChar(stream);
+}
+
+
 #endif
 
 /*---------------------------------------------------------------------*/
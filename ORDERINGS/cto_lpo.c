@@ -38,6 +38,9 @@ Changes
          <6> Thu Apr 22 23:14:52 CEST 2004
              Started implementing the polynomial LPO4 algorithm from
              Bernd Loechners paper "What to know about LPO"
+         <7> Mon Oct 19 17:05:12 CEST 2026
+             Memoize results for shared subterm pairs within a
+             top-level comparison.
 
 -----------------------------------------------------------------------*/
 
@@ -48,6 +51,25 @@ Changes
 /*---------------------------------------------------------------------*/
 
 long LPORecursionDepthLimit = 1000;
+long LPOMemoThreshold       = 128;
+
+/* Memoization of comparisons of subterm pairs. The cache only lives
+   for a single top-level comparison (bindings and the term bank
+   cannot change in between), and is only used once the comparison
+   has needed more than LPOMemoThreshold recursive calls, so that the
+   common small comparisons do not pay for it. Results computed after
+   the recursion depth limit has been hit are approximations and are
+   not stored. */
+
+typedef struct lpo_memo_cell
+{
+   CmpCache_p cache;
+   long       steps;
+   bool       depth_exceeded;
+}LPOMemoCell, *LPOMemo_p;
+
+static LPOMemoCell lpo_memo  = {NULL, 0, false};
+static LPOMemoCell lpo4_memo = {NULL, 0, false};
 
 
 /*---------------------------------------------------------------------*/
@@ -71,6 +93,85 @@ static CompareResult lpo_greater(OCB_p ocb, Term_p s, Term_p t,
              deref_t);
 
 
+/*---------------------------------------------------------------------*/
+/*                    Internal Functions Memoization                   */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: lpo_memo_reset()
+//
+//   Forget all memoized results and reset the step counter. Called at
+//   the start and end of each top-level comparison.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void lpo_memo_reset(LPOMemo_p memo)
+{
+   if(memo->cache)
+   {
+      CmpCacheClear(memo->cache);
+   }
+   memo->steps          = 0;
+   memo->depth_exceeded = false;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lpo_memo_find()
+//
+//   Count a recursive comparison step and, if memoization is active,
+//   return the memoized relation between s and t (or to_unknown).
+//
+// Global Variables: LPOMemoThreshold
+//
+// Side Effects    : Changes memo
+//
+/----------------------------------------------------------------------*/
+
+static CompareResult lpo_memo_find(LPOMemo_p memo, Term_p s, Term_p t,
+                                   DerefType deref_s, DerefType deref_t)
+{
+   memo->steps++;
+   if(LPOMemoThreshold < 0 || memo->steps <= LPOMemoThreshold)
+   {
+      return to_unknown;
+   }
+   return CmpCacheFind(&(memo->cache), s, deref_s, t, deref_t);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: lpo_memo_store()
+//
+//   If memoization is active, remember that s and t are in relation
+//   res.
+//
+// Global Variables: LPOMemoThreshold
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void lpo_memo_store(LPOMemo_p memo, Term_p s, Term_p t,
+                           DerefType deref_s, DerefType deref_t,
+                           CompareResult res)
+{
+   if(LPOMemoThreshold < 0 || memo->steps <= LPOMemoThreshold ||
+      memo->depth_exceeded)
+   {
+      return;
+   }
+   CmpCacheInsert(&(memo->cache), s, deref_s, t, deref_t, res);
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                      Internal Functions LPO                         */
 /*---------------------------------------------------------------------*/
@@ -97,7 +198,7 @@ static bool lpo_term_dominates_args(OCB_p ocb, Term_p s, Term_p t,
 
    for(i=0; i<t->arity;i++)
    {
-      if(!LPOGreater(ocb, s, t->args[i], deref_s, deref_t))
+      if(lpo_greater(ocb, s, t->args[i], deref_s, deref_t)!=to_greater)
       {
     return false;
       }
@@ -198,9 +299,10 @@ static CompareResult lpo_lex_greater(OCB_p ocb, Term_p s, Term_p t,
 //   to_uncomparable if s and t are definitly uncomparable
 //   to_nogteq       otherwise
 //
-// Global Variables: LPORecursionDepthLimit
+// Global Variables: LPORecursionDepthLimit, LPOMemoThreshold
 //
-// Side Effects    : Manipulates static variable recursion_depth
+// Side Effects    : Manipulates static variable recursion_depth,
+//                   memoizes results.
 //
 /----------------------------------------------------------------------*/
 
@@ -214,9 +316,23 @@ static CompareResult lpo_greater(OCB_p ocb, Term_p s, Term_p t,
    s = TermDeref(s, &deref_s);
    t = TermDeref(t, &deref_t);
 
+   switch(lpo_memo_find(&lpo_memo, s, t, deref_s, deref_t))
+   {
+   case to_greater:
+    return to_greater;
+   case to_equal:
+    return to_equal;
+   case to_lesser:
+   case to_uncomparable:
+   case to_notgteq:
+    return to_notgteq;
+   default:
+    break;
+   }
    if(recursion_depth > LPORecursionDepthLimit)
    {
       /* printf("LPORecursionDepthLimit encountered\n"); */
+      lpo_memo.depth_exceeded = true;
       return to_uncomparable;
    }
    recursion_depth++;
@@ -289,6 +405,7 @@ static CompareResult lpo_greater(OCB_p ocb, Term_p s, Term_p t,
          "Unexpected result of function symbol comparison");
        break;
       }
+      lpo_memo_store(&lpo_memo, s, t, deref_s, deref_t, res);
    }
    recursion_depth--;
    return res;
@@ -414,9 +531,9 @@ static bool lpo4_lex_ma(OCB_p ocb, Term_p s, Term_p t, int pos,
 //
 //   LPO comparison using the lpo_4_nc algorithm by Bernd Loechner.
 //
-// Global Variables: -
+// Global Variables: LPORecursionDepthLimit, LPOMemoThreshold
 //
-// Side Effects    : -
+// Side Effects    : Memoizes results
 //
 /----------------------------------------------------------------------*/
 
@@ -428,15 +545,28 @@ static bool lpo4_greater(OCB_p ocb, Term_p s, Term_p t,
    CompareResult f_code_res;
    bool res;
 
+   s = TermDeref(s, &deref_s);
+   t = TermDeref(t, &deref_t);
+
+   switch(lpo_memo_find(&lpo4_memo, s, t, deref_s, deref_t))
+   {
+   case to_greater:
+    return true;
+   case to_equal:
+   case to_lesser:
+   case to_uncomparable:
+   case to_notgteq:
+    return false;
+   default:
+    break;
+   }
    if(recursion_depth > LPORecursionDepthLimit)
    {
+      lpo4_memo.depth_exceeded = true;
       return false;
    }
    recursion_depth++;
 
-   s = TermDeref(s, &deref_s);
-   t = TermDeref(t, &deref_t);
-
    if(TermIsVar(s))
    {
       res = false;
@@ -460,6 +590,8 @@ static bool lpo4_greater(OCB_p ocb, Term_p s, Term_p t,
       {
          res = lpo4_alpha(ocb, s, 0, t, deref_s, deref_t);
       }
+      lpo_memo_store(&lpo4_memo, s, t, deref_s, deref_t,
+                     res?to_greater:to_notgteq);
    }
    recursion_depth--;
    return res;
@@ -573,15 +705,16 @@ static bool lpo4_copy_lex_ma(OCB_p ocb, Term_p s, Term_p t, int pos)
 //
 //   LPO comparison using the lpo_4_nc algorithm by Bernd Loechner.
 //
-// Global Variables: -
+// Global Variables: LPOMemoThreshold
 //
-// Side Effects    : -
+// Side Effects    : Memoizes results
 //
 /----------------------------------------------------------------------*/
 
 static bool lpo4_copy_greater(OCB_p ocb, Term_p s, Term_p t)
 {
    CompareResult f_code_res;
+   bool res;
 
    if(TermIsVar(s))
    {
@@ -591,16 +724,34 @@ static bool lpo4_copy_greater(OCB_p ocb, Term_p s, Term_p t)
    {
       return TBTermIsSubterm(s, t);
    }
+   switch(lpo_memo_find(&lpo4_memo, s, t, DEREF_NEVER, DEREF_NEVER))
+   {
+   case to_greater:
+    return true;
+   case to_equal:
+   case to_lesser:
+   case to_uncomparable:
+   case to_notgteq:
+    return false;
+   default:
+    break;
+   }
    f_code_res = OCBFunCompare(ocb, s->f_code, t->f_code);
    if(f_code_res==to_greater)
    {
-      return lpo4_copy_majo(ocb, s, t, 0);
+      res = lpo4_copy_majo(ocb, s, t, 0);
+   }
+   else if(f_code_res==to_equal)
+   {
+      res = lpo4_copy_lex_ma(ocb, s, t, 0);
    }
-   if(f_code_res==to_equal)
+   else
    {
-      return lpo4_copy_lex_ma(ocb, s, t, 0);
+      res = lpo4_copy_alpha(ocb, s, 0, t);
    }
-   return lpo4_copy_alpha(ocb, s, 0, t);
+   lpo_memo_store(&lpo4_memo, s, t, DEREF_NEVER, DEREF_NEVER,
+                  res?to_greater:to_notgteq);
+   return res;
 }
 
 /*---------------------------------------------------------------------*/
@@ -621,14 +772,19 @@ static bool lpo4_copy_greater(OCB_p ocb, Term_p s, Term_p t)
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Memory operations
 //
 -----------------------------------------------------------------------*/
 
 bool LPOGreater(OCB_p ocb, Term_p s, Term_p t,
       DerefType deref_s, DerefType deref_t)
 {
-   return lpo_greater(ocb, s, t, deref_s, deref_t) == to_greater;
+   bool res;
+
+   res = lpo_greater(ocb, s, t, deref_s, deref_t) == to_greater;
+   lpo_memo_reset(&lpo_memo);
+
+   return res;
 }
 
 
@@ -645,7 +801,7 @@ bool LPOGreater(OCB_p ocb, Term_p s, Term_p t,
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Memory operations
 //
 -----------------------------------------------------------------------*/
 
@@ -661,6 +817,7 @@ CompareResult LPOCompare(OCB_p ocb, Term_p s, Term_p t,
    case to_lesser: /* From caching only */
    case to_equal:
    case to_uncomparable:
+    lpo_memo_reset(&lpo_memo);
     return res;
    case to_notleeq:
    case to_unknown:
@@ -670,6 +827,7 @@ CompareResult LPOCompare(OCB_p ocb, Term_p s, Term_p t,
     break;
    }
    res = lpo_greater(ocb, t, s, deref_t, deref_s);
+   lpo_memo_reset(&lpo_memo);
    switch(res)
    {
    case to_greater:
@@ -702,7 +860,7 @@ CompareResult LPOCompare(OCB_p ocb, Term_p s, Term_p t,
 //
 // Global Variables: -
 //
-// Side Effects    : -
+// Side Effects    : Memory operations
 //
 -----------------------------------------------------------------------*/
 
@@ -713,6 +871,7 @@ bool LPO4Greater(OCB_p ocb, Term_p s, Term_p t,
 
    /* printf("LPO4Greater()...\n"); */
    res =  lpo4_greater(ocb, s, t, deref_s, deref_t);
+   lpo_memo_reset(&lpo4_memo);
    /* printf("...LPO4Greater()=%d\n", res); */
    /* assert(res == LPOGreater(ocb, s, t, deref_s, deref_t)); */
   return res;
@@ -754,6 +913,7 @@ CompareResult LPO4Compare(OCB_p ocb, Term_p s, Term_p t,
    {
       res = to_uncomparable;
    }
+   lpo_memo_reset(&lpo4_memo);
    /* printf("...LPO4Compare()=%d\n", res); */
    /* assert(res == LPOCompare(ocb, s, t, deref_s, deref_t)); */
    return res;
@@ -798,6 +958,7 @@ bool LPO4GreaterCopy(OCB_p ocb, Term_p s, Term_p t,
    }
 
    res = lpo4_copy_greater(ocb, s1,t1);
+   lpo_memo_reset(&lpo4_memo);
 
    if(deref_s != DEREF_NEVER)
    {
@@ -865,6 +1026,7 @@ CompareResult LPO4CompareCopy(OCB_p ocb, Term_p s, Term_p t,
    {
       res = to_uncomparable;
    }
+   lpo_memo_reset(&lpo4_memo);
    if(deref_s != DEREF_NEVER)
    {
       TermFree(s1);
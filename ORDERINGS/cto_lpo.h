@@ -20,6 +20,8 @@ Changes
     New
 <2> Tue Sep 15 08:50:54 MET DST 1998
     Changed
+<3> Mon Oct 19 17:05:12 CEST 2026
+    Added LPOMemoThreshold
 
 -----------------------------------------------------------------------*/
 
@@ -28,6 +30,7 @@ Changes
 #define CTO_LPO
 
 #include <cto_ocb.h>
+#include <cto_cmpcache.h>
 
 
 /*---------------------------------------------------------------------*/
@@ -42,6 +45,7 @@ Changes
 /*---------------------------------------------------------------------*/
 
 extern long   LPORecursionDepthLimit;
+extern long   LPOMemoThreshold;
 
 bool          LPOGreater(OCB_p ocb, Term_p s, Term_p t,
           DerefType deref_s, DerefType deref_t);
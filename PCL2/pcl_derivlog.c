@@ -0,0 +1,648 @@
+/*-----------------------------------------------------------------------
+
+File  : pcl_derivlog.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Reading of binary inference logs and proof extraction from them.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 21:37:50 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include "pcl_derivlog.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+static void dlog_print_just(FILE* out, DLog_p log, DLogStep_p step);
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: dlog_get_byte()
+//
+//   Read a single byte from in, fail on end of file.
+//
+// Global Variables: -
+//
+// Side Effects    : Input
+//
+/----------------------------------------------------------------------*/
+
+static int dlog_get_byte(FILE* in, char* name)
+{
+   int c = getc(in);
+
+   if(c == EOF)
+   {
+      Error("%s: Unexpected end of inference log", SYNTAX_ERROR, name);
+   }
+   return c;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: dlog_get_varint()
+//
+//   Read a variable-length integer (as written by
+//   derivlog_put_varint()).
+//
+// Global Variables: -
+//
+// Side Effects    : Input
+//
+/----------------------------------------------------------------------*/
+
+static unsigned long dlog_get_varint(FILE* in, char* name)
+{
+   unsigned long res = 0;
+   int shift = 0, c;
+
+   do
+   {
+      c = dlog_get_byte(in, name);
+      res |= ((unsigned long)(c&0x7f))<<shift;
+      shift += 7;
+   }while(c&0x80);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: dlog_get_string()
+//
+//   Read a NUL-terminated string and return a copy.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static char* dlog_get_string(FILE* in, char* name, DStr_p buffer)
+{
+   int c;
+
+   DStrReset(buffer);
+   while((c = dlog_get_byte(in, name)))
+   {
+      DStrAppendChar(buffer, c);
+   }
+   return DStrCopy(buffer);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: dlog_inf_name()
+//
+//   Return the TSTP name of a (normal) inference.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static char* dlog_inf_name(InfType op)
+{
+   switch(op)
+   {
+   case inf_paramod:
+         return PCL_PM;
+   case inf_sim_paramod:
+         return PCL_SPM;
+   case inf_efactor:
+         return PCL_EF;
+   case inf_factor:
+         return PCL_OF;
+   case inf_eres:
+         return PCL_ER;
+   case inf_simplify_reflect:
+         return PCL_SR;
+   case inf_context_simplify_reflect:
+         return PCL_CSR;
+   case inf_ac_resolution:
+         return PCL_ACRES;
+   case inf_condense:
+         return PCL_CONDENSE;
+   case inf_minimize:
+         return PCL_CN;
+   case inf_rewrite:
+         return PCL_RW;
+   case inf_fof_simpl:
+         return PCL_FS;
+   case inf_fof_split_equiv:
+         return PCL_SE;
+   case inf_fof_nnf:
+         return PCL_NNF;
+   case inf_fof_apply_def:
+         return PCL_AD;
+   case inf_shift_quantors:
+         return PCL_SQ;
+   case inf_fof_distrib:
+         return PCL_DSTR;
+   case inf_annotate_question:
+         return PCL_ANNOQ;
+   case inf_eval_answers:
+         return PCL_EVANS;
+   case inf_var_rename:
+         return PCL_VR;
+   case inf_skolemize_out:
+         return PCL_SK;
+   case inf_neg_conjecture:
+         return PCL_NC;
+   case inf_split_conjunct:
+         return PCL_SC;
+   default:
+         return "unknown";
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: dlog_print_premise()
+//
+//   Print a reference to the premise id. Premises without a body are
+//   replaced by their justification.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void dlog_print_premise(FILE* out, DLog_p log, long id)
+{
+   DLogStep_p step = DLogFindStep(log, id);
+
+   if(step && !step->body)
+   {
+      dlog_print_just(out, log, step);
+   }
+   else if(id < 0)
+   {
+      fprintf(out, "i_0_%ld", id-LONG_MIN);
+   }
+   else
+   {
+      fprintf(out, "c_0_%ld", id);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: dlog_print_just()
+//
+//   Print the justification of step in TSTP syntax, as the
+//   corresponding functions in ccl_inferencedoc.c would have done.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+static void dlog_print_just(FILE* out, DLog_p log, DLogStep_p step)
+{
+   long i;
+   char *status = "thm";
+
+   switch(step->op)
+   {
+   case inf_initial:
+         fputs(step->source, out);
+         return;
+   case inf_fof_intro_def:
+         fputs(PCL_ID_DEF, out);
+         return;
+   case inf_quote:
+         assert(step->parent_no == 1);
+         dlog_print_premise(out, log, step->parents[0]);
+         return;
+   case inf_split:
+         assert(step->parent_no == 1);
+         fputs("inference("TSTP_SPLIT_BASE",["TSTP_SPLIT_BASE
+               "("TSTP_SPLIT_REFINED",[])],[", out);
+         dlog_print_premise(out, log, step->parents[0]);
+         fputs("])", out);
+         return;
+   case inf_rewrite:
+   case inf_fof_apply_def:
+         /* Chains of steps are nested, with the main premise
+            innermost */
+         for(i=1; i<step->parent_no; i++)
+         {
+            fprintf(out, "inference(%s,[status(thm)],[",
+                    dlog_inf_name(step->op));
+         }
+         dlog_print_premise(out, log, step->parents[0]);
+         for(i=1; i<step->parent_no; i++)
+         {
+            fputc(',', out);
+            dlog_print_premise(out, log, step->parents[i]);
+            fputs("])", out);
+         }
+         return;
+   case inf_skolemize_out:
+         status = "esa";
+         break;
+   case inf_neg_conjecture:
+         status = "cth";
+         break;
+   default:
+         break;
+   }
+   fprintf(out, "inference(%s,[status(%s)],[",
+           dlog_inf_name(step->op), status);
+   for(i=0; i<step->parent_no; i++)
+   {
+      if(i)
+      {
+         fputc(',', out);
+      }
+      dlog_print_premise(out, log, step->parents[i]);
+   }
+   if(step->op == inf_eval_answers || step->op == inf_annotate_question)
+   {
+      fputs(",theory(answers)", out);
+   }
+   fputs("])", out);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: dlog_step_free()
+//
+//   Free a step and its strings.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void dlog_step_free(DLogStep_p junk)
+{
+   if(junk->comment)
+   {
+      FREE(junk->comment);
+   }
+   if(junk->source)
+   {
+      FREE(junk->source);
+   }
+   if(junk->body)
+   {
+      FREE(junk->body);
+   }
+   if(junk->parents)
+   {
+      SizeFree(junk->parents, junk->parent_no*sizeof(long));
+   }
+   DLogStepCellFree(junk);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: DLogAlloc()
+//
+//   Allocate an empty inference log.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+DLog_p DLogAlloc(void)
+{
+   DLog_p handle = DLogCellAlloc();
+
+   handle->max_ident = 0;
+   handle->steps     = PDArrayAlloc(1,500000);
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DLogFree()
+//
+//   Free an inference log.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void DLogFree(DLog_p junk)
+{
+   long i;
+   DLogStep_p step;
+
+   for(i=1; i<=junk->max_ident; i++)
+   {
+      step = PDArrayElementP(junk->steps, i);
+      if(step)
+      {
+         dlog_step_free(step);
+      }
+   }
+   PDArrayFree(junk->steps);
+   DLogCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DLogFindStep()
+//
+//   Return the step with identifier id, or NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+DLogStep_p DLogFindStep(DLog_p log, long id)
+{
+   if(id <= 0 || id > log->max_ident)
+   {
+      return NULL;
+   }
+   return PDArrayElementP(log->steps, id);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DLogRead()
+//
+//   Read the inference log from the named file ("-" is stdin) into
+//   log. Return the number of steps read.
+//
+// Global Variables: -
+//
+// Side Effects    : Input, memory operations
+//
+/----------------------------------------------------------------------*/
+
+long DLogRead(DLog_p log, char* name)
+{
+   FILE*         in = InputOpen(name, true);
+   DStr_p        buffer = DStrAlloc();
+   PStack_p      parents = PStackAlloc();
+   DLogStep_p    step;
+   long          last_id = 0, id, steps = 0;
+   unsigned long delta;
+   int           c, i;
+   char          *body;
+
+   for(i=0; DL_MAGIC[i]; i++)
+   {
+      if(getc(in) != DL_MAGIC[i])
+      {
+         Error("%s: Not an inference log", FILE_ERROR, name);
+      }
+   }
+   if(getc(in) != DL_VERSION)
+   {
+      Error("%s: Unsupported inference log version", FILE_ERROR, name);
+   }
+   while((c = getc(in)) != EOF)
+   {
+      switch(c&DLTypeMask)
+      {
+      case DLClauseStep:
+      case DLFormulaStep:
+            step = DLogStepCellAlloc();
+            step->id        = (long)((unsigned long)last_id+
+                                     dlog_get_varint(in, name));
+            step->type      = c&DLTypeMask;
+            step->op        = dlog_get_varint(in, name);
+            step->in_proof  = false;
+            step->comment   = NULL;
+            step->source    = NULL;
+            step->body      = NULL;
+            if(c&DLHasComment)
+            {
+               step->comment = dlog_get_string(in, name, buffer);
+            }
+            if(step->op == inf_initial)
+            {
+               step->source = dlog_get_string(in, name, buffer);
+            }
+            while((delta = dlog_get_varint(in, name)))
+            {
+               PStackPushInt(parents, (long)((unsigned long)step->id-delta));
+            }
+            step->parent_no = PStackGetSP(parents);
+            step->parents   = NULL;
+            if(step->parent_no)
+            {
+               step->parents = SizeMalloc(step->parent_no*sizeof(long));
+               for(i=0; i<step->parent_no; i++)
+               {
+                  step->parents[i] = PStackElementInt(parents, i);
+               }
+            }
+            PStackReset(parents);
+            if(step->id <= last_id)
+            {
+               Error("%s: Inference log steps out of order (%ld after %ld)",
+                     SYNTAX_ERROR, name, step->id, last_id);
+            }
+            PDArrayAssignP(log->steps, step->id, step);
+            log->max_ident = step->id;
+            last_id = step->id;
+            steps++;
+            break;
+      case DLClauseBody:
+      case DLFormulaBody:
+            id   = (long)((unsigned long)last_id-dlog_get_varint(in, name));
+            body = dlog_get_string(in, name, buffer);
+            step = DLogFindStep(log, id);
+            if(!step || step->body)
+            {
+               /* Bodies of undocumented clauses are useless */
+               FREE(body);
+            }
+            else
+            {
+               step->body = body;
+            }
+            break;
+      default:
+            Error("%s: Unknown inference log record type %d",
+                  SYNTAX_ERROR, name, c);
+            break;
+      }
+   }
+   PStackFree(parents);
+   DStrFree(buffer);
+   InputClose(in);
+
+   return steps;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DLogMarkProofSteps()
+//
+//   Mark all steps needed to justify the "proof", "final", or
+//   "extract" steps. Return true if a proof was found.
+//
+// Global Variables: -
+//
+// Side Effects    : Marks steps
+//
+/----------------------------------------------------------------------*/
+
+bool DLogMarkProofSteps(DLog_p log)
+{
+   bool       res = false;
+   long       i;
+   PStack_p   to_proc = PStackAlloc();
+   DLogStep_p step;
+
+   for(i=1; i<=log->max_ident; i++)
+   {
+      step = DLogFindStep(log, i);
+      if(step && PCLStepExtract(step->comment))
+      {
+         if(strncmp(step->comment, "proof", 5)==0)
+         {
+            res = true;
+         }
+         PStackPushP(to_proc, step);
+      }
+   }
+   while(!PStackEmpty(to_proc))
+   {
+      step = PStackPopP(to_proc);
+      if(!step->in_proof)
+      {
+         step->in_proof = true;
+         for(i=0; i<step->parent_no; i++)
+         {
+            DLogStep_p parent = DLogFindStep(log, step->parents[i]);
+
+            if(parent)
+            {
+               PStackPushP(to_proc, parent);
+            }
+         }
+      }
+   }
+   PStackFree(to_proc);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DLogSetProofSteps()
+//
+//   Mark all steps as proof steps.
+//
+// Global Variables: -
+//
+// Side Effects    : Marks steps
+//
+/----------------------------------------------------------------------*/
+
+void DLogSetProofSteps(DLog_p log)
+{
+   long i;
+   DLogStep_p step;
+
+   for(i=1; i<=log->max_ident; i++)
+   {
+      step = DLogFindStep(log, i);
+      if(step)
+      {
+         step->in_proof = true;
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: DLogPrintProofSteps()
+//
+//   Print all marked steps with a body in TSTP syntax, in order.
+//
+// Global Variables: -
+//
+// Side Effects    : Output
+//
+/----------------------------------------------------------------------*/
+
+void DLogPrintProofSteps(FILE* out, DLog_p log)
+{
+   long i;
+   DLogStep_p step;
+
+   for(i=1; i<=log->max_ident; i++)
+   {
+      step = DLogFindStep(log, i);
+      if(step && step->in_proof && step->body)
+      {
+         fputs(step->body, out);
+         fputs(", ", out);
+         dlog_print_just(out, log, step);
+         if(step->comment)
+         {
+            fprintf(out, ",['%s']", step->comment);
+         }
+         fputs(").\n", out);
+      }
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,83 @@
+/*-----------------------------------------------------------------------
+
+File  : pcl_derivlog.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Reading binary inference logs (see CLAUSES/ccl_derivlog.h) and
+  extracting proofs from them. Steps without a clause body (because
+  the clause was simplified before it was ever used) are not printed
+  on their own, their justification is nested into that of the next
+  version of the clause.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 21:37:50 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#ifndef PCL_DERIVLOG
+
+#define PCL_DERIVLOG
+
+#include <ccl_derivlog.h>
+#include <pcl_expressions.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+typedef struct dlogstepcell
+{
+   long        id;
+   DerivLogTag type;      /* DLClauseStep or DLFormulaStep */
+   InfType     op;
+   bool        in_proof;
+   char*       comment;   /* NULL if none */
+   char*       source;    /* Only for initial steps */
+   char*       body;      /* NULL if never written */
+   long        parent_no;
+   long*       parents;
+}DLogStepCell, *DLogStep_p;
+
+typedef struct dlogcell
+{
+   long      max_ident;
+   PDArray_p steps; /* indexed by ident */
+}DLogCell, *DLog_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define DLogStepCellAlloc() (DLogStepCell*)SizeMalloc(sizeof(DLogStepCell))
+#define DLogStepCellFree(junk) SizeFree(junk, sizeof(DLogStepCell))
+#define DLogCellAlloc() (DLogCell*)SizeMalloc(sizeof(DLogCell))
+#define DLogCellFree(junk) SizeFree(junk, sizeof(DLogCell))
+
+DLog_p     DLogAlloc(void);
+void       DLogFree(DLog_p junk);
+DLogStep_p DLogFindStep(DLog_p log, long id);
+
+long       DLogRead(DLog_p log, char* name);
+
+bool       DLogMarkProofSteps(DLog_p log);
+void       DLogSetProofSteps(DLog_p log);
+void       DLogPrintProofSteps(FILE* out, DLog_p log);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,510 @@
+/*-----------------------------------------------------------------------
+
+File  : e_autotable_check.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Enumerate all combinations of the problem features used by the
+  class tables of the automatic modes, select a strategy for each of
+  them with AutoTableSelect(), and print a digest of the resulting
+  mapping (or the mapping itself). Comparing the digests with the
+  ones in development_tools/e_autotable_test.expected shows if a
+  change of the tables or of the table code changes the strategy
+  selected for any problem class.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Wed Oct 21 10:41:09 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <cio_commandline.h>
+#include <cio_output.h>
+#include <che_autotable.h>
+#include <e_version.h>
+
+
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+#define NAME "e_autotable_check"
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_VERSION,
+   OPT_VERBOSE,
+   OPT_AUTO_TABLE,
+   OPT_FULL
+}OptionCodes;
+
+/* Number of cases for each position of a class string. The
+   equality position has an extra case for the empty clause set. */
+
+#define FEATURE_NO 13
+
+static int feature_cases[FEATURE_NO] = {3,2,4,3,2,3,3,3,3,4,4,3,3};
+
+#define DIGEST_INIT  14695981039346656037ULL
+#define DIGEST_PRIME 1099511628211ULL
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+
+   {OPT_VERSION,
+    '\0', "version",
+    NoArg, NULL,
+    "Print the version number of the program."},
+
+   {OPT_VERBOSE,
+    'v', "verbose",
+    OptArg, "1",
+    "Verbose comments on the progress of the program by printing "
+    "technical information to stderr."},
+
+   {OPT_AUTO_TABLE,
+    't', "auto-table",
+    ReqArg, NULL,
+    "Read a class table for an automatic mode from the given file. It "
+    "replaces the built-in table of the same name (as with eprover "
+    "--auto-table). This option can be given more than once."},
+
+   {OPT_FULL,
+    'f', "full",
+    NoArg, NULL,
+    "Print the strategy selected for each feature combination "
+    "(as the digits of the combination, the heuristic and the "
+    "parameter assignments), not only the digest of the mapping. "
+    "The output is large."},
+
+    {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+/* The tables of the built-in auto modes */
+
+char *default_tables[] =
+{
+   "Auto",
+   "AutoCASC",
+   "AutoDev",
+   "AutoSched0",
+   "AutoSched1",
+   "AutoSched2",
+   "AutoSched3",
+   "AutoSched4",
+   "AutoSched5",
+   "AutoSched6",
+   "AutoSched7",
+   NULL
+};
+
+bool print_full = false;
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[]);
+void print_help(FILE* out);
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: spec_set_features()
+//
+//   Set up spec so that its features are the ones given by the case
+//   numbers in cases (in the order of the class string, see
+//   feature_cases).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes *spec
+//
+/----------------------------------------------------------------------*/
+
+void spec_set_features(SpecFeature_p spec, int cases[])
+{
+   static SpecFeatures ng_units[] = {SpecFewPosNonGroundUnits,
+                                     SpecSomePosNonGroundUnits,
+                                     SpecManyPosNonGroundUnits};
+   static SpecFeatures axioms[]   = {SpecFewAxioms,
+                                     SpecSomeAxioms,
+                                     SpecManyAxioms};
+   static SpecFeatures literals[] = {SpecFewLiterals,
+                                     SpecSomeLiterals,
+                                     SpecManyLiterals};
+   static SpecFeatures terms[]    = {SpecSmallTerms,
+                                     SpecMediumTerms,
+                                     SpecLargeTerms};
+   static SpecFeatures ground[]   = {SpecFewPosGround,
+                                     SpecSomePosGround,
+                                     SpecManyPosGround};
+   static SpecFeatures arity[]    = {SpecArity0,
+                                     SpecArity1,
+                                     SpecArity2,
+                                     SpecArity3Plus};
+   static SpecFeatures ar_sum[]   = {SpecAritySumSmall,
+                                     SpecAritySumMedium,
+                                     SpecAritySumLarge};
+   static SpecFeatures depth[]    = {SpecDepthShallow,
+                                     SpecDepthMedium,
+                                     SpecDepthDeep};
+
+   memset(spec, 0, sizeof(SpecFeatureCell));
+   spec->axioms     = 2;
+   spec->unitaxioms = (cases[0]==0)?2:0;
+   spec->hornaxioms = (cases[0]<2)?2:1;
+   spec->goals      = 1;
+   spec->unitgoals  = (cases[1]==0)?1:0;
+   switch(cases[2])
+   {
+   case 0: /* No equality */
+         spec->clauses     = 3;
+         spec->eq_clauses  = 0;
+         spec->peq_clauses = 0;
+         break;
+   case 1: /* Some equality */
+         spec->clauses     = 3;
+         spec->eq_clauses  = 1;
+         spec->peq_clauses = 0;
+         break;
+   case 2: /* Pure equality */
+         spec->clauses     = 3;
+         spec->eq_clauses  = 3;
+         spec->peq_clauses = 3;
+         break;
+   default: /* Empty clause set */
+         spec->clauses     = 0;
+         spec->eq_clauses  = 0;
+         spec->peq_clauses = 0;
+         break;
+   }
+   spec->ng_unit_content         = ng_units[cases[3]];
+   spec->goals_are_ground        = cases[4];
+   spec->set_clause_size         = axioms[cases[5]];
+   spec->set_literal_size        = literals[cases[6]];
+   spec->set_termcell_size       = terms[cases[7]];
+   spec->ground_positive_content = ground[cases[8]];
+   spec->max_fun_ar_class        = arity[cases[9]];
+   spec->avg_fun_ar_class        = arity[cases[10]];
+   spec->sum_fun_ar_class        = ar_sum[cases[11]];
+   spec->max_depth_class         = depth[cases[12]];
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: next_cases()
+//
+//   Advance cases to the next feature combination. Return false if
+//   all combinations have been enumerated.
+//
+// Global Variables: feature_cases
+//
+// Side Effects    : Changes cases
+//
+/----------------------------------------------------------------------*/
+
+bool next_cases(int cases[])
+{
+   for(int i=FEATURE_NO-1; i>=0; i--)
+   {
+      cases[i]++;
+      if(cases[i] < feature_cases[i])
+      {
+         return true;
+      }
+      cases[i] = 0;
+   }
+   return false;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: strategy_string()
+//
+//   Return the heuristic name and the parameters that strat sets
+//   (starting from the defaults) as a string. Strings are cached in
+//   *cache by the position of the strategy in its table.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+char* strategy_string(AutoStrategy_p strat, NumTree_p *cache)
+{
+   NumTree_p          cell = NumTreeFind(cache, strat->order);
+   HeuristicParmsCell hparms;
+   OrderParmsCell     oparms;
+   DStr_p             str;
+   IntOrP             val, dummy;
+
+   if(cell)
+   {
+      return cell->val1.p_val;
+   }
+   HeuristicParmsInitialize(&hparms);
+   oparms.ordertype       = KBO6;
+   oparms.to_const_weight = WConstNoSpecialWeight;
+   oparms.to_weight_gen   = WSelectMaximal;
+   oparms.to_prec_gen     = PUnaryFirst;
+   oparms.no_lit_cmp      = false;
+   AutoStrategySetHeuristicParms(strat, &hparms);
+   AutoStrategySetOrderParms(strat, &oparms);
+
+   str = DStrAlloc();
+   DStrAppendStr(str, strat->name);
+   DStrAppendStr(str, ", ");
+   AutoParmsAddAssignments(str, &hparms, &oparms);
+   val.p_val   = DStrCopy(str);
+   dummy.p_val = NULL;
+   DStrFree(str);
+   NumTreeStore(cache, strat->order, val, dummy);
+
+   return val.p_val;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: digest_add()
+//
+//   Add the string str to the (64 bit FNV-1a) digest.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+unsigned long long digest_add(unsigned long long digest, char* str)
+{
+   for(; *str; str++)
+   {
+      digest = (digest ^ (unsigned char)*str) * DIGEST_PRIME;
+   }
+   return digest;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: check_table()
+//
+//   Enumerate all feature combinations for the named table and
+//   print the digest of the mapping to strategies (and the mapping
+//   itself if print_full is set).
+//
+// Global Variables: print_full
+//
+// Side Effects    : Output, may parse the table
+//
+/----------------------------------------------------------------------*/
+
+void check_table(char* name)
+{
+   AutoTable_p        table = AutoTableFind(name);
+   SpecFeatureCell    spec;
+   AutoStrategy_p     strat;
+   int                cases[FEATURE_NO] = {0};
+   char               digits[FEATURE_NO+2];
+   char               *strategy;
+   long               count = 0, used = 0;
+   unsigned long long digest = DIGEST_INIT;
+   NumTree_p          cache = NULL, cell;
+
+   if(!table)
+   {
+      Error("Unknown auto mode table %s", USAGE_ERROR, name);
+   }
+   do
+   {
+      spec_set_features(&spec, cases);
+      strat = AutoTableSelect(table, &spec);
+      strategy = strategy_string(strat, &cache);
+
+      for(int i=0; i<FEATURE_NO; i++)
+      {
+         digits[i] = '0'+cases[i];
+      }
+      digits[FEATURE_NO]   = ' ';
+      digits[FEATURE_NO+1] = '\0';
+      digest = digest_add(digest, digits);
+      digest = digest_add(digest, strategy);
+      digest = digest_add(digest, "\n");
+      if(print_full)
+      {
+         fprintf(GlobalOut, "%s%s\n", digits, strategy);
+      }
+      count++;
+   }while(next_cases(cases));
+
+   while(cache)
+   {
+      cell = NumTreeExtractRoot(&cache);
+      FREE(cell->val1.p_val);
+      NumTreeCellFree(cell);
+      used++;
+   }
+   fprintf(GlobalOut, "# %s: %ld combinations, %ld strategies, "
+           "digest %016llx\n", name, count, used, digest);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: main()
+//
+//   Entry point of the program and driver of the processing.
+//
+// Global Variables: All declared in this file
+//
+// Side Effects    : Yes ;-)
+//
+/----------------------------------------------------------------------*/
+
+int main(int argc, char* argv[])
+{
+   CLState_p state;
+   int       i;
+
+   assert(argv[0]);
+   InitIO(NAME);
+
+   state = process_options(argc, argv);
+   OpenGlobalOut(NULL);
+
+   if(state->argc == 0)
+   {
+      for(i=0; default_tables[i]; i++)
+      {
+         check_table(default_tables[i]);
+      }
+   }
+   else
+   {
+      for(i=0; state->argv[i]; i++)
+      {
+         check_table(state->argv[i]);
+      }
+   }
+   CLStateFree(state);
+
+#ifndef FAST_EXIT
+   AutoTablesFree();
+#endif
+   ExitIO();
+
+#ifdef CLB_MEMORY_DEBUG
+   MemFlushFreeList();
+   MemDebugPrintStats(stdout);
+#endif
+
+   return 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, Verbose, print_full
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_VERBOSE:
+            Verbose = CLStateGetIntArg(handle, arg);
+            break;
+      case OPT_HELP:
+            print_help(stdout);
+            exit(NO_ERROR);
+      case OPT_VERSION:
+            printf(NAME " " VERSION "\n");
+            exit(NO_ERROR);
+      case OPT_AUTO_TABLE:
+            AutoTableLoad(arg);
+            break;
+      case OPT_FULL:
+            print_full = true;
+            break;
+      default:
+            assert(false);
+            break;
+      }
+   }
+   return state;
+}
+
+
+void print_help(FILE* out)
+{
+   fprintf(out, "\n\
+"NAME " " VERSION "\n\
+\n\
+Usage: " NAME " [options] [tables]\n\
+\n\
+Enumerate all combinations of the problem features used by the\n\
+class tables of the automatic modes (the classes printed by\n\
+classify_problem, plus the empty clause set, which has both no and\n\
+pure equality) and select a strategy for each of them. For each\n\
+table (by default the tables of all built-in automatic modes),\n\
+print a digest of the mapping from feature combinations to the\n\
+heuristic and the parameters selected.\n\
+\n");
+   PrintOptions(stdout, opts, "Options\n\n");
+   fprintf(out, "\n\n" E_FOOTER);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
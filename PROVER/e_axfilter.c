@@ -19,9 +19,12 @@ Changes
 
 <1> Mon Feb 21 13:24:04 CET 2011
     New (but borrowing from LTB runner)
+<2> Mon Oct 19 18:02:44 CEST 2026
+    Parallel filter workers and common core output
 
 -----------------------------------------------------------------------*/
 
+#include <sys/wait.h>
 #include <clb_defines.h>
 #include <cio_commandline.h>
 #include <cio_output.h>
@@ -51,6 +54,8 @@ typedef enum
    OPT_SEED_SUBSAMPLE,
    OPT_SEED_METHODS,
    OPT_DUMP_FILTER,
+   OPT_FILTER_JOBS,
+   OPT_COMMON_CORE,
    OPT_PRINT_STATISTICS,
    OPT_SILENT,
    OPT_OUTPUTLEVEL,
@@ -72,6 +77,16 @@ typedef enum
 }SubSampleMethod;
 
 
+/* What a single filter job does */
+
+typedef enum
+{
+   FJSelectWrite,  /* Select axioms and write the result file */
+   FJSelect,       /* Select axioms only */
+   FJWrite         /* Write a previously computed result */
+}FilterJobMode;
+
+
 
 /*---------------------------------------------------------------------*/
 /*                        Global Variables                             */
@@ -160,6 +175,24 @@ OptCell opts[] =
     NoArg, NULL,
      "Print the filter definition in force."},
 
+   {OPT_FILTER_JOBS,
+    'j', "filter-jobs",
+    ReqArg, NULL,
+    "Apply the filters in the given number of parallel worker "
+    "processes. The workers share the parsed problem and the "
+    "SinE indices built by the main process (copy-on-write) and write "
+    "their result files themselves."},
+
+   {OPT_COMMON_CORE,
+    '\0', "common-core",
+    NoArg, NULL,
+    "Write the clauses and formulas selected by all filters with a "
+    "non-empty result only once, into a file <name>_common.ax, and "
+    "include this file in the individual result files instead of "
+    "repeating them. The include statement uses the plain file name, "
+    "so the result files should be read from the current directory "
+    "(with TPTP unset)."},
+
    {OPT_LOP_PARSE,
     '\0', "lop-in",
     NoArg, NULL,
@@ -237,6 +270,8 @@ bool     seed_preds   = false,
 
 SubSampleMethod subsample   = SubSNone;
 long            sample_size = LONG_MAX;
+long            filter_jobs = 1;
+bool            common_core = false;
 
 
 /*---------------------------------------------------------------------*/
@@ -253,25 +288,65 @@ void print_help(FILE* out);
 
 /*-----------------------------------------------------------------------
 //
-// Function: filter_problem()
+// Function: print_result()
 //
-//   Given a structured problem data structure, an axfilter, and the
-//   core name of the output, apply the filter to the problem and
-//   write the result into a properly named file (which is determined
-//   from the core name and the filter name).
+//   Print clauses and formulas to out in TSTP format. If skip_core is
+//   true, omit those marked as part of the common core (CPOpFlag).
 //
 // Global Variables: -
 //
-// Side Effects    : I/O (writes result file), Memory operations
+// Side Effects    : Output
 //
 /----------------------------------------------------------------------*/
 
-void filter_problem(StructFOFSpec_p ctrl,
-                    AxFilter_p filter,
-                    char* corename, char* desc)
+static void print_result(FILE* out, PStack_p clauses, PStack_p formulas,
+                         bool skip_core)
+{
+   PStackPointer i;
+   Clause_p      clause;
+   WFormula_p    form;
+
+   for(i=0; i<PStackGetSP(clauses); i++)
+   {
+      clause = PStackElementP(clauses, i);
+      if(!(skip_core && ClauseQueryProp(clause, CPOpFlag)))
+      {
+         ClauseTSTPPrint(out, clause, true, true);
+         fputc('\n', out);
+      }
+   }
+   for(i=0; i<PStackGetSP(formulas); i++)
+   {
+      form = PStackElementP(formulas, i);
+      if(!(skip_core && FormulaQueryProp(form, CPOpFlag)))
+      {
+         WFormulaTSTPPrint(out, form, true, true);
+         fputc('\n', out);
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: write_filter_result()
+//
+//   Write the result of filter into a properly named file (which is
+//   determined from the core name and the filter name). If core_file
+//   is given, include it and skip the clauses and formulas in the
+//   common core.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O (writes result file)
+//
+/----------------------------------------------------------------------*/
+
+static void write_filter_result(AxFilter_p filter, char* corename, char* desc,
+                                char* core_file,
+                                PStack_p clauses, PStack_p formulas)
 {
    DStr_p   filename = DStrAlloc();
-   PStack_p formulas, clauses;
    FILE     *fp;
 
    DStrAppendStr(filename, corename);
@@ -279,41 +354,547 @@ void filter_problem(StructFOFSpec_p ctrl,
    DStrAppendStr(filename, filter->name);
    DStrAppendStr(filename, ".p");
 
-   formulas = PStackAlloc();
-   clauses  = PStackAlloc();
-
-   StructFOFSpecGetProblem(ctrl,
-                           filter,
-                           clauses,
-                           formulas);
-
    fprintf(GlobalOut, "# Filter: %s goes into file %s\n",
            filter->name,
            DStrView(filename));
 
-   fp = fopen(DStrView(filename), "w");
+   fp = SecureFOpen(DStrView(filename), "w");
    fprintf(fp, "%% Filter %s on file %s\n",
            filter->name, corename);
    if(desc)
    {
       fprintf(fp, "%s", desc);
    }
-   PStackClausePrintTSTP(fp, clauses);
-   PStackFormulaPrintTSTP(fp, formulas);
-   fclose(fp);
+   if(core_file)
+   {
+      fprintf(fp, "include('%s').\n", core_file);
+   }
+   print_result(fp, clauses, formulas, core_file!=NULL);
+   SecureFClose(fp);
+
+   DStrFree(filename);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: filter_problem()
+//
+//   Given a structured problem data structure, an axfilter, and the
+//   core name, apply the filter to the problem and write the result
+//   into a properly named file (see write_filter_result()).
+//
+// Global Variables: -
+//
+// Side Effects    : I/O (writes result file), Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void filter_problem(StructFOFSpec_p ctrl,
+                    AxFilter_p filter,
+                    char* corename, char* desc)
+{
+   PStack_p formulas, clauses;
+
+   formulas = PStackAlloc();
+   clauses  = PStackAlloc();
+
+   StructFOFSpecGetProblem(ctrl,
+                           filter,
+                           clauses,
+                           formulas);
+   write_filter_result(filter, corename, desc, NULL, clauses, formulas);
 
    PStackFree(clauses);
    PStackFree(formulas);
-   DStrFree(filename);
 }
 
+
+/*-----------------------------------------------------------------------
+//
+// Function: pipe_write()
+//
+//   Write len bytes from buf to fd.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O, terminates on error
+//
+/----------------------------------------------------------------------*/
+
+static void pipe_write(int fd, void* buf, size_t len)
+{
+   char    *pos = buf;
+   ssize_t res;
+
+   while(len)
+   {
+      res = write(fd, pos, len);
+      if(res < 0)
+      {
+         if(errno == EINTR)
+         {
+            continue;
+         }
+         SysError("Cannot send filter result", SYS_ERROR);
+      }
+      pos += res;
+      len -= res;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pipe_read()
+//
+//   Read len bytes from fd into buf. Return false if the input ended
+//   before the first byte, fail if it ends later.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O, terminates on error
+//
+/----------------------------------------------------------------------*/
+
+static bool pipe_read(int fd, void* buf, size_t len)
+{
+   char    *pos = buf;
+   ssize_t res;
+   bool    started = false;
+
+   while(len)
+   {
+      res = read(fd, pos, len);
+      if(res < 0)
+      {
+         if(errno == EINTR)
+         {
+            continue;
+         }
+         SysError("Cannot receive filter result", SYS_ERROR);
+      }
+      if(res == 0)
+      {
+         if(!started)
+         {
+            return false;
+         }
+         Error("Truncated filter result", OTHER_ERROR);
+      }
+      started = true;
+      pos += res;
+      len -= res;
+   }
+   return true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: send_filter_result()
+//
+//   Send the result of job to the parent. Workers are forked after
+//   the problem has been parsed, so pointers to clauses and formulas
+//   are valid in the parent as well.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O
+//
+/----------------------------------------------------------------------*/
+
+static void send_filter_result(int fd, long job, PStack_p clauses,
+                               PStack_p formulas)
+{
+   long header[3];
+
+   header[0] = job;
+   header[1] = PStackGetSP(clauses);
+   header[2] = PStackGetSP(formulas);
+   pipe_write(fd, header, sizeof(header));
+   pipe_write(fd, clauses->stack, PStackGetSP(clauses)*sizeof(IntOrP));
+   pipe_write(fd, formulas->stack, PStackGetSP(formulas)*sizeof(IntOrP));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: receive_filter_results()
+//
+//   Receive all results sent by a worker and store them in
+//   results. Return the number of results received.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static long receive_filter_results(int fd, PStack_p *results)
+{
+   long   header[3], i, size, res = 0;
+   IntOrP *vals;
+
+   while(pipe_read(fd, header, sizeof(header)))
+   {
+      size = (header[1]+header[2])*sizeof(IntOrP);
+      vals = size?SizeMalloc(size):NULL;
+      if(size && !pipe_read(fd, vals, size))
+      {
+         Error("Truncated filter result", OTHER_ERROR);
+      }
+      for(i=0; i<header[1]+header[2]; i++)
+      {
+         PStackPushP(results[2*header[0]+(i<header[1]?0:1)], vals[i].p_val);
+      }
+      if(vals)
+      {
+         SizeFree(vals, size);
+      }
+      res++;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: run_filter_job()
+//
+//   Run filter job number job (i.e. filter jobs[job]) in mode. In
+//   FJSelect mode, the result is sent to fd if fd is valid, otherwise
+//   it is stored in results.
+//
+// Global Variables: -
+//
+// Side Effects    : I/O, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void run_filter_job(StructFOFSpec_p ctrl, AxFilterSet_p filters,
+                           PStack_p jobs, long job, FilterJobMode mode,
+                           char* corename, char* desc, char* core_file,
+                           PStack_p *results, int fd)
+{
+   AxFilter_p filter = AxFilterSetGetFilter(filters,
+                                            PStackElementInt(jobs, job));
+   PStack_p   clauses, formulas;
+
+   switch(mode)
+   {
+   case FJSelectWrite:
+         filter_problem(ctrl, filter, corename, desc);
+         break;
+   case FJSelect:
+         if(fd < 0)
+         {
+            StructFOFSpecGetProblem(ctrl, filter,
+                                    results[2*job], results[2*job+1]);
+         }
+         else
+         {
+            clauses  = PStackAlloc();
+            formulas = PStackAlloc();
+            StructFOFSpecGetProblem(ctrl, filter, clauses, formulas);
+            send_filter_result(fd, job, clauses, formulas);
+            PStackFree(clauses);
+            PStackFree(formulas);
+         }
+         break;
+   case FJWrite:
+         clauses  = results[2*job];
+         formulas = results[2*job+1];
+         write_filter_result(filter, corename, desc,
+                             (PStackEmpty(clauses)&&PStackEmpty(formulas))?
+                             NULL:core_file,
+                             clauses, formulas);
+         break;
+   default:
+         assert(false && "Unknown filter job mode");
+         break;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: run_filter_jobs()
+//
+//   Run all jobs (indices of filters) in mode. With more than one
+//   filter job allowed, jobs are distributed round-robin over forked
+//   worker processes, which inherit the parsed problem. SinE indices
+//   are built before forking, so that this is done only once.
+//
+// Global Variables: filter_jobs
+//
+// Side Effects    : I/O, memory operations, forks
+//
+/----------------------------------------------------------------------*/
+
+static void run_filter_jobs(StructFOFSpec_p ctrl, AxFilterSet_p filters,
+                            PStack_p jobs, FilterJobMode mode,
+                            char* corename, char* desc, char* core_file,
+                            PStack_p *results)
+{
+   long       workers = MIN(filter_jobs, PStackGetSP(jobs));
+   long       i, j;
+   pid_t      *pids;
+   int        *fds, pipefd[2], status;
+   AxFilter_p filter;
+
+   if(workers <= 1)
+   {
+      for(j=0; j<PStackGetSP(jobs); j++)
+      {
+         run_filter_job(ctrl, filters, jobs, j, mode,
+                        corename, desc, core_file, results, -1);
+      }
+      return;
+   }
+   if(mode != FJWrite)
+   {
+      for(j=0; j<PStackGetSP(jobs); j++)
+      {
+         filter = AxFilterSetGetFilter(filters, PStackElementInt(jobs, j));
+         if(filter->type == AFGSinE)
+         {
+            StructFOFSpecGetSineIndex(ctrl, filter->gen_measure);
+         }
+      }
+   }
+   pids = SizeMalloc(workers*sizeof(pid_t));
+   fds  = SizeMalloc(workers*sizeof(int));
+   fflush(GlobalOut);
+   fflush(stdout);
+
+   for(i=0; i<workers; i++)
+   {
+      pipefd[0] = pipefd[1] = -1;
+      if(mode == FJSelect && pipe(pipefd) < 0)
+      {
+         SysError("Cannot create pipe for filter worker", SYS_ERROR);
+      }
+      pids[i] = fork();
+      if(pids[i] < 0)
+      {
+         SysError("Cannot fork filter worker", SYS_ERROR);
+      }
+      if(pids[i] == 0)
+      {
+         /* Child */
+         if(pipefd[0] >= 0)
+         {
+            close(pipefd[0]);
+         }
+         for(j=i; j<PStackGetSP(jobs); j+=workers)
+         {
+            run_filter_job(ctrl, filters, jobs, j, mode,
+                           corename, desc, core_file, results, pipefd[1]);
+         }
+         if(pipefd[1] >= 0)
+         {
+            close(pipefd[1]);
+         }
+         fflush(GlobalOut);
+         exit(NO_ERROR);
+      }
+      /* Parent */
+      if(pipefd[1] >= 0)
+      {
+         close(pipefd[1]);
+      }
+      fds[i] = pipefd[0];
+   }
+   for(i=0; i<workers; i++)
+   {
+      if(fds[i] >= 0)
+      {
+         receive_filter_results(fds[i], results);
+         close(fds[i]);
+      }
+   }
+   for(i=0; i<workers; i++)
+   {
+      while(waitpid(pids[i], &status, 0) == -1)
+      {
+         if(errno != EINTR)
+         {
+            SysError("Cannot wait for filter worker", SYS_ERROR);
+         }
+      }
+      if(!WIFEXITED(status) || (WEXITSTATUS(status) != NO_ERROR))
+      {
+         Error("Filter worker %ld failed", OTHER_ERROR, i);
+      }
+   }
+   SizeFree(pids, workers*sizeof(pid_t));
+   SizeFree(fds, workers*sizeof(int));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: mark_common_core()
+//
+//   Find the clauses and formulas that occur in all non-empty results,
+//   push them onto core_clauses and core_formulas, and mark them with
+//   CPOpFlag. Return the size of the core.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, sets CPOpFlag
+//
+/----------------------------------------------------------------------*/
+
+static long mark_common_core(PStack_p *results, long n,
+                             PStack_p core_clauses, PStack_p core_formulas)
+{
+   PStack_p      tmp = PStackAlloc();
+   PStackPointer sp;
+   Clause_p      clause;
+   WFormula_p    form;
+   bool          first = true;
+   long          i;
+
+   for(i=0; i<n; i++)
+   {
+      if(PStackEmpty(results[2*i]) && PStackEmpty(results[2*i+1]))
+      {
+         continue;
+      }
+      if(first)
+      {
+         PStackPushStack(core_clauses, results[2*i]);
+         PStackPushStack(core_formulas, results[2*i+1]);
+         first = false;
+         continue;
+      }
+      for(sp=0; sp<PStackGetSP(results[2*i]); sp++)
+      {
+         ClauseSetProp((Clause_p)PStackElementP(results[2*i], sp), CPOpFlag);
+      }
+      for(sp=0; sp<PStackGetSP(core_clauses); sp++)
+      {
+         clause = PStackElementP(core_clauses, sp);
+         if(ClauseQueryProp(clause, CPOpFlag))
+         {
+            PStackPushP(tmp, clause);
+         }
+      }
+      PStackReset(core_clauses);
+      PStackPushStack(core_clauses, tmp);
+      PStackReset(tmp);
+      PStackClauseDelProp(results[2*i], CPOpFlag);
+
+      for(sp=0; sp<PStackGetSP(results[2*i+1]); sp++)
+      {
+         FormulaSetProp((WFormula_p)PStackElementP(results[2*i+1], sp),
+                        CPOpFlag);
+      }
+      for(sp=0; sp<PStackGetSP(core_formulas); sp++)
+      {
+         form = PStackElementP(core_formulas, sp);
+         if(FormulaQueryProp(form, CPOpFlag))
+         {
+            PStackPushP(tmp, form);
+         }
+      }
+      PStackReset(core_formulas);
+      PStackPushStack(core_formulas, tmp);
+      PStackReset(tmp);
+      PStackFormulaDelProp(results[2*i+1], CPOpFlag);
+   }
+   PStackFree(tmp);
+
+   for(sp=0; sp<PStackGetSP(core_clauses); sp++)
+   {
+      ClauseSetProp((Clause_p)PStackElementP(core_clauses, sp), CPOpFlag);
+   }
+   for(sp=0; sp<PStackGetSP(core_formulas); sp++)
+   {
+      FormulaSetProp((WFormula_p)PStackElementP(core_formulas, sp),
+                     CPOpFlag);
+   }
+   return PStackGetSP(core_clauses)+PStackGetSP(core_formulas);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: core_filters_problem()
+//
+//   Apply the filters in jobs to the problem, write the common core
+//   of all results into one file, and the remainder of each result
+//   into a file that includes the core.
+//
+// Global Variables: -
+//
+// Side Effects    : Writes result files
+//
+/----------------------------------------------------------------------*/
+
+static void core_filters_problem(StructFOFSpec_p ctrl,
+                                 AxFilterSet_p filters,
+                                 PStack_p jobs,
+                                 char* corename,
+                                 char *desc)
+{
+   long     n = PStackGetSP(jobs), i;
+   PStack_p *results = SizeMalloc(2*MAX(n,1)*sizeof(PStack_p));
+   PStack_p core_clauses = PStackAlloc();
+   PStack_p core_formulas = PStackAlloc();
+   DStr_p   core_file = DStrAlloc();
+   FILE     *fp;
+
+   for(i=0; i<2*n; i++)
+   {
+      results[i] = PStackAlloc();
+   }
+   run_filter_jobs(ctrl, filters, jobs, FJSelect, corename, desc,
+                   NULL, results);
+
+   DStrAppendStr(core_file, corename);
+   DStrAppendStr(core_file, "_common.ax");
+   if(mark_common_core(results, n, core_clauses, core_formulas))
+   {
+      fprintf(GlobalOut, "# Common core of %ld clauses/formulas goes "
+              "into file %s\n",
+              (long)(PStackGetSP(core_clauses)+PStackGetSP(core_formulas)),
+              DStrView(core_file));
+      fp = SecureFOpen(DStrView(core_file), "w");
+      fprintf(fp, "%% Common core of all filters on file %s\n", corename);
+      print_result(fp, core_clauses, core_formulas, false);
+      SecureFClose(fp);
+      run_filter_jobs(ctrl, filters, jobs, FJWrite, corename, desc,
+                      DStrView(core_file), results);
+   }
+   else
+   {
+      run_filter_jobs(ctrl, filters, jobs, FJWrite, corename, desc,
+                      NULL, results);
+   }
+   PStackClauseDelProp(core_clauses, CPOpFlag);
+   PStackFormulaDelProp(core_formulas, CPOpFlag);
+
+   for(i=0; i<2*n; i++)
+   {
+      PStackFree(results[i]);
+   }
+   SizeFree(results, 2*MAX(n,1)*sizeof(PStack_p));
+   PStackFree(core_clauses);
+   PStackFree(core_formulas);
+   DStrFree(core_file);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: all_filters_problem()
 //
 //   Apply all filters to problems.
 //
-// Global Variables:
+// Global Variables: filter_jobs, common_core
 //
 // Side Effects    : Writes result files
 //
@@ -325,6 +906,7 @@ void all_filters_problem(StructFOFSpec_p ctrl,
                          bool hypo_filter_only,
                          char *desc)
 {
+   PStack_p jobs = PStackAlloc();
    int i;
 
    for(i=0; i<AxFilterSetElements(filters); i++)
@@ -332,11 +914,19 @@ void all_filters_problem(StructFOFSpec_p ctrl,
       /* SigPrint(stdout,ctrl->sig); */
       if(!hypo_filter_only || AxFilterSetGetFilter(filters,i)->use_hypotheses)
       {
-         filter_problem(ctrl,
-                        AxFilterSetGetFilter(filters,i),
-                        corename, desc);
+         PStackPushInt(jobs, i);
       }
    }
+   if(common_core)
+   {
+      core_filters_problem(ctrl, filters, jobs, corename, desc);
+   }
+   else
+   {
+      run_filter_jobs(ctrl, filters, jobs, FJSelectWrite, corename, desc,
+                      NULL, NULL);
+   }
+   PStackFree(jobs);
 }
 
 
@@ -940,6 +1530,17 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_DUMP_FILTER:
             dumpfilter = true;
             break;
+      case OPT_FILTER_JOBS:
+            filter_jobs = CLStateGetIntArg(handle, arg);
+            if(filter_jobs < 1)
+            {
+               Error("Option -j (--filter-jobs) requires a positive "
+                     "argument", USAGE_ERROR);
+            }
+            break;
+      case OPT_COMMON_CORE:
+            common_core = true;
+            break;
       case OPT_LOP_PARSE:
       case OPT_LOP_FORMAT:
             parse_format = LOPFormat;
@@ -0,0 +1,1540 @@
+/*-----------------------------------------------------------------------
+
+File  : e_microbench.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Microbenchmarks for the core term and index operations of E
+  (matching, unification, term orderings, term bank insertion,
+  signature lookup and retrieval from the perfect discrimination
+  tree, fingerprint and feature vector indices, detection of clause
+  copies). The workload is sampled from a problem
+  file or generated synthetically, and the program reports
+  operations per second and latency percentiles for each primitive.
+  Optionally, LPO and LPO4 are also run on deep f(s,s)-towers.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 15:02:44 CEST 2026
+    New
+<2> Tue Oct 20 16:40:19 CEST 2026
+    Large synthetic signatures, parse time, sigfind benchmark.
+<3> Wed Oct 21 11:32:05 CEST 2026
+    markcopies benchmark.
+<4> Wed Oct 21 17:20:48 CEST 2026
+    LPO tower benchmarks.
+
+-----------------------------------------------------------------------*/
+
+#include <time.h>
+#include <cio_commandline.h>
+#include <cio_output.h>
+#include <cio_tempfile.h>
+#include <ccl_formulafunc.h>
+#include <ccl_proofstate.h>
+#include <ccl_subsumption.h>
+#include <ccl_pdtrees.h>
+#include <cte_fp_index.h>
+#include <che_to_weightgen.h>
+#include <che_to_precgen.h>
+#include <e_version.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+#define NAME "e_microbench"
+
+/* Parameters of the synthetic problem generator */
+
+#define GEN_CONSTS     6
+#define GEN_FUNS       4  /* Per arity (1-3) */
+#define GEN_PREDS      3  /* Per arity (1-2) */
+#define GEN_VARS       4
+#define GEN_MAX_LITS   4
+
+/* Pattern variables use odd FunCodes and are therefore disjoint from
+   the (even) variables of the parsed clauses. */
+
+#define PATTERN_VARS   4
+#define PATTERN_PROB   0.25
+
+/* ClauseSetMarkCopies() works on a whole clause set, so each
+   operation processes one of MARKCOPIES_SETS sets of MARKCOPIES_SIZE
+   clauses. Each clause is a copy of one of the set with probability
+   MARKCOPIES_PROB. */
+
+#define MARKCOPIES_SETS 16
+#define MARKCOPIES_SIZE 256
+#define MARKCOPIES_PROB 0.25
+
+/* The tower benchmarks compare t_n(a) and t_n(b) with t_0(x) = x and
+   t_{k+1}(x) = f(t_k(x),t_k(x)). Without memoization, LPO needs time
+   exponential in n for this. */
+
+#define LPO_MAX_DEPTH  64
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_VERSION,
+   OPT_VERBOSE,
+   OPT_OUTPUT,
+   OPT_OPERATIONS,
+   OPT_BENCHMARKS,
+   OPT_SEED,
+   OPT_GENERATE,
+   OPT_GEN_DEPTH,
+   OPT_GEN_SYMBOLS,
+   OPT_LPO_DEPTH,
+   OPT_LPO_MEMO
+}OptionCodes;
+
+
+/* Everything a benchmark needs. Operands are computed by the setup
+   function of each benchmark, so that only the operation itself is
+   timed. */
+
+typedef struct bench_state_cell
+{
+   ProofState_p state;
+   PStack_p     terms;     /* Distinct non-variable subterms */
+   long         ops;
+   Term_p       *lhs;
+   Term_p       *rhs;
+   Clause_p     *queries;
+   Subst_p      subst;
+   OCB_p        kbo;
+   OCB_p        lpo;
+   TB_p         bank;      /* Target of TBInsert() */
+   char         **names;   /* Queries for SigFindFCode() */
+   PDTree_p     pdt;
+   FPIndex_p    fpindex;
+   PStack_p     collect;
+   ClauseSet_p  fvset;
+   ClauseSet_p  *copysets; /* Input of ClauseSetMarkCopies() */
+   Term_p       towers[2]; /* Operands of the tower benchmarks */
+   OCB_p        lpo_tower;
+   OCB_p        lpo4_tower;
+}BenchStateCell, *BenchState_p;
+
+typedef void (*BenchSetupFun)(BenchState_p bench);
+typedef long (*BenchOpFun)(BenchState_p bench, long i);
+
+typedef struct bench_cell
+{
+   char          *name;
+   BenchSetupFun setup;
+   BenchOpFun    op;
+   char          *desc;
+}BenchCell, *Bench_p;
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+
+   {OPT_VERSION,
+    '\0', "version",
+    NoArg, NULL,
+    "Print the version number of the program."},
+
+   {OPT_VERBOSE,
+    'v', "verbose",
+    OptArg, "1",
+    "Verbose comments on the progress of the program by printing "
+    "technical information to stderr."},
+
+   {OPT_OUTPUT,
+    'o', "output-file",
+    ReqArg, NULL,
+    "Redirect output into the named file."},
+
+   {OPT_OPERATIONS,
+    'n', "operations",
+    ReqArg, NULL,
+    "Number of timed operations per benchmark."},
+
+   {OPT_BENCHMARKS,
+    'b', "benchmarks",
+    ReqArg, NULL,
+    "Comma-separated list of benchmarks to run. The default is to run "
+    "all of them (see the list below)."},
+
+   {OPT_SEED,
+    '\0', "seed",
+    ReqArg, NULL,
+    "Seed for the random selection of operands (and for the synthetic "
+    "problem)."},
+
+   {OPT_GENERATE,
+    'g', "generate",
+    ReqArg, NULL,
+    "Number of clauses of the synthetic problem that is used if no "
+    "input file is given."},
+
+   {OPT_GEN_DEPTH,
+    '\0', "generate-depth",
+    ReqArg, NULL,
+    "Maximal term depth of the synthetic problem."},
+
+   {OPT_GEN_SYMBOLS,
+    's', "generate-symbols",
+    ReqArg, NULL,
+    "Approximate number of distinct function symbols and constants "
+    "of the synthetic problem. Use this together with a large value "
+    "for --generate to get a problem with a large signature."},
+
+   {OPT_LPO_DEPTH,
+    '\0', "lpo-depth",
+    ReqArg, NULL,
+    "Run the benchmarks lpo-tower and lpo4-tower, which compare "
+    "f(s,s)-towers of the given depth over two fresh constants. By "
+    "default, these benchmarks are skipped. Without memoization, the "
+    "cost grows exponentially with the depth, so use a small value "
+    "for --operations in that case."},
+
+   {OPT_LPO_MEMO,
+    '\0', "lpo-memo-threshold",
+    ReqArg, NULL,
+    "Set the number of recursive steps after which an LPO or LPO4 "
+    "comparison starts to memoize its results (as in eprover). Use "
+    "-1 to disable memoization."},
+
+   {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+char *outname      = NULL;
+char *bench_select = NULL;
+long operations    = 100000;
+long seed          = 42;
+long gen_clauses   = 2000;
+long gen_depth     = 4;
+long gen_consts    = GEN_CONSTS;
+long gen_funs      = GEN_FUNS;
+long lpo_depth     = 0;
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[]);
+void print_help(FILE* out);
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+#define rand_below(n) ((long)(JKISSRand()%(unsigned)(n)))
+#define random_term(bench) \
+        ((Term_p)PStackElementP((bench)->terms, \
+                                rand_below(PStackGetSP((bench)->terms))))
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_nsec()
+//
+//   Return a monotonic time stamp in nanoseconds.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long long bench_nsec(void)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec*1000000000LL+ts.tv_nsec;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gen_term()
+//
+//   Print a random term of at most the given depth over the
+//   synthetic signature. Top level terms are never variables.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, changes RNG state
+//
+/----------------------------------------------------------------------*/
+
+static void gen_term(FILE* out, long depth, bool top)
+{
+   long arity, i;
+
+   if(depth == 0 || (!top && rand_below(4)==0))
+   {
+      if(rand_below(2))
+      {
+         fprintf(out, "X%ld", rand_below(GEN_VARS));
+      }
+      else
+      {
+         fprintf(out, "c%ld", rand_below(gen_consts));
+      }
+      return;
+   }
+   arity = 1+rand_below(3);
+   fprintf(out, "f%ld_%ld(", arity, rand_below(gen_funs));
+   for(i=0; i<arity; i++)
+   {
+      if(i)
+      {
+         fputc(',', out);
+      }
+      gen_term(out, depth-1, false);
+   }
+   fputc(')', out);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: gen_problem()
+//
+//   Write a random clause set in TPTP-3 syntax to a new temporary
+//   file and return its name.
+//
+// Global Variables: -
+//
+// Side Effects    : Creates a file, changes RNG state
+//
+/----------------------------------------------------------------------*/
+
+static char* gen_problem(long clauses, long depth)
+{
+   char *name = TempFileName();
+   FILE *out  = OutOpen(name);
+   long i, j, lits, arity, k;
+
+   for(i=0; i<clauses; i++)
+   {
+      fprintf(out, "cnf(c%ld, axiom, (", i);
+      lits = 1+rand_below(GEN_MAX_LITS);
+      for(j=0; j<lits; j++)
+      {
+         if(j)
+         {
+            fprintf(out, " | ");
+         }
+         if(rand_below(5) < 3)
+         {
+            gen_term(out, depth, true);
+            fprintf(out, rand_below(2)?" = ":" != ");
+            gen_term(out, depth, true);
+         }
+         else
+         {
+            arity = 1+rand_below(2);
+            fprintf(out, "%sp%ld_%ld(", rand_below(2)?"~":"",
+                    arity, rand_below(GEN_PREDS));
+            for(k=0; k<arity; k++)
+            {
+               if(k)
+               {
+                  fputc(',', out);
+               }
+               gen_term(out, depth, false);
+            }
+            fputc(')', out);
+         }
+      }
+      fprintf(out, ")).\n");
+   }
+   OutClose(out);
+   return name;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: collect_subterms()
+//
+//   Push all non-variable subterms of term not yet marked with
+//   TPOpFlag onto terms and mark them.
+//
+// Global Variables: -
+//
+// Side Effects    : Sets TPOpFlag
+//
+/----------------------------------------------------------------------*/
+
+static void collect_subterms(Term_p term, PStack_p terms)
+{
+   int i;
+
+   if(TermIsVar(term) || TermCellQueryProp(term, TPOpFlag))
+   {
+      return;
+   }
+   TermCellSetProp(term, TPOpFlag);
+   PStackPushP(terms, term);
+   for(i=0; i<term->arity; i++)
+   {
+      collect_subterms(term->args[i], terms);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: term_generalize()
+//
+//   Return a shared generalization of term, where each proper
+//   subterm is replaced with probability prob by one of a small
+//   number of pattern variables (so patterns may be non-linear).
+//
+// Global Variables: -
+//
+// Side Effects    : Inserts into bank, changes RNG state
+//
+/----------------------------------------------------------------------*/
+
+static Term_p term_generalize(TB_p bank, Term_p term, double prob, bool top)
+{
+   Term_p handle;
+   int    i;
+
+   if(!top && (TermIsVar(term) || JKISSRandDouble() < prob))
+   {
+      return VarBankVarAssertAlloc(bank->vars,
+                                   -(2*rand_below(PATTERN_VARS)+1),
+                                   term->sort);
+   }
+   if(!term->arity)
+   {
+      return term;
+   }
+   handle = TermTopCopy(term);
+   for(i=0; i<term->arity; i++)
+   {
+      handle->args[i] = term_generalize(bank, term->args[i], prob, false);
+   }
+   return TBTermTopInsert(bank, handle);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: random_subterm()
+//
+//   Return a random proper subterm of term (or term itself if it is
+//   a constant).
+//
+// Global Variables: -
+//
+// Side Effects    : Changes RNG state
+//
+/----------------------------------------------------------------------*/
+
+static Term_p random_subterm(Term_p term)
+{
+   do
+   {
+      if(!term->arity)
+      {
+         break;
+      }
+      term = term->args[rand_below(term->arity)];
+   }while(rand_below(2));
+
+   return term;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: setup_pairs()
+//
+//   Fill lhs/rhs with pattern/target pairs. Half of the targets are
+//   the term the pattern was created from, the others are random
+//   terms.
+//
+// Global Variables: -
+//
+// Side Effects    : Inserts into the term bank
+//
+/----------------------------------------------------------------------*/
+
+static void setup_pairs(BenchState_p bench)
+{
+   long   i;
+   Term_p term;
+
+   for(i=0; i<bench->ops; i++)
+   {
+      term = random_term(bench);
+      bench->lhs[i] = term_generalize(bench->state->terms, term,
+                                      PATTERN_PROB, true);
+      bench->rhs[i] = rand_below(2)?term:random_term(bench);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: setup_cmp_pairs()
+//
+//   Fill lhs/rhs with pairs of terms to compare: A term with one of
+//   its subterms, with a generalization, or with a random term.
+//
+// Global Variables: -
+//
+// Side Effects    : Inserts into the term bank
+//
+/----------------------------------------------------------------------*/
+
+static void setup_cmp_pairs(BenchState_p bench)
+{
+   long   i;
+   Term_p term;
+
+   for(i=0; i<bench->ops; i++)
+   {
+      term = random_term(bench);
+      bench->lhs[i] = term;
+      switch(rand_below(3))
+      {
+      case 0:
+            bench->rhs[i] = random_subterm(term);
+            break;
+      case 1:
+            bench->rhs[i] = term_generalize(bench->state->terms, term,
+                                            PATTERN_PROB, true);
+            break;
+      default:
+            bench->rhs[i] = random_term(bench);
+            break;
+      }
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: setup_queries()
+//
+//   Fill lhs with random terms (as query terms for indices).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void setup_queries(BenchState_p bench)
+{
+   long i;
+
+   for(i=0; i<bench->ops; i++)
+   {
+      bench->lhs[i] = random_term(bench);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: setup_patterns()
+//
+//   Fill lhs with generalizations of random terms.
+//
+// Global Variables: -
+//
+// Side Effects    : Inserts into the term bank
+//
+/----------------------------------------------------------------------*/
+
+static void setup_patterns(BenchState_p bench)
+{
+   long i;
+
+   for(i=0; i<bench->ops; i++)
+   {
+      bench->lhs[i] = term_generalize(bench->state->terms,
+                                      random_term(bench),
+                                      PATTERN_PROB, true);
+   }
+}
+
+
+/*---------------------------------------------------------------------*/
+/*            Setup and operation functions of the benchmarks          */
+/*---------------------------------------------------------------------*/
+
+static void tbinsert_setup(BenchState_p bench)
+{
+   if(bench->bank)
+   {
+      bench->bank->sig = NULL;
+      TBFree(bench->bank);
+   }
+   bench->bank = TBAlloc(bench->state->signature);
+   setup_queries(bench);
+}
+
+static long tbinsert_op(BenchState_p bench, long i)
+{
+   long old_nodes = TBNonVarTermNodes(bench->bank);
+
+   TBInsert(bench->bank, bench->lhs[i], DEREF_NEVER);
+   return TBNonVarTermNodes(bench->bank)-old_nodes;
+}
+
+static long match_op(BenchState_p bench, long i)
+{
+   if(SubstComputeMatch(bench->lhs[i], bench->rhs[i], bench->subst))
+   {
+      SubstBacktrack(bench->subst);
+      return 1;
+   }
+   return 0;
+}
+
+static long mgu_op(BenchState_p bench, long i)
+{
+   if(SubstComputeMgu(bench->lhs[i], bench->rhs[i], bench->subst))
+   {
+      SubstBacktrack(bench->subst);
+      return 1;
+   }
+   return 0;
+}
+
+static void kbo_setup(BenchState_p bench)
+{
+   if(!bench->kbo)
+   {
+      bench->kbo = OCBAlloc(KBO6, true, bench->state->signature);
+      TOGeneratePrecedence(bench->kbo, bench->state->axioms, NULL,
+                           PUnaryFirst);
+      TOGenerateWeights(bench->kbo, bench->state->axioms, NULL,
+                        WSelectMaximal, W_DEFAULT_WEIGHT);
+   }
+   setup_cmp_pairs(bench);
+}
+
+static long kbo_op(BenchState_p bench, long i)
+{
+   return TOCompare(bench->kbo, bench->lhs[i], bench->rhs[i],
+                    DEREF_NEVER, DEREF_NEVER)!=to_uncomparable;
+}
+
+static void lpo_setup(BenchState_p bench)
+{
+   if(!bench->lpo)
+   {
+      bench->lpo = OCBAlloc(LPO4, true, bench->state->signature);
+      TOGeneratePrecedence(bench->lpo, bench->state->axioms, NULL,
+                           PUnaryFirst);
+   }
+   setup_cmp_pairs(bench);
+}
+
+static long lpo_op(BenchState_p bench, long i)
+{
+   return TOCompare(bench->lpo, bench->lhs[i], bench->rhs[i],
+                    DEREF_NEVER, DEREF_NEVER)!=to_uncomparable;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: tower_setup()
+//
+//   Create the towers t_n(a) and t_n(b) of depth lpo_depth over fresh
+//   symbols (once), and use them as the operands of all operations.
+//
+// Global Variables: lpo_depth
+//
+// Side Effects    : Extends the signature, inserts into the term bank
+//
+/----------------------------------------------------------------------*/
+
+static void tower_setup(BenchState_p bench)
+{
+   Sig_p   sig = bench->state->signature;
+   FunCode f;
+   Term_p  handle;
+   long    i, j;
+
+   if(!bench->towers[0])
+   {
+      f = SigGetNewSkolemCode(sig, 2);
+      for(i=0; i<2; i++)
+      {
+         handle = TermTopAlloc(SigGetNewSkolemCode(sig, 0), 0);
+         handle->sort = STIndividuals;
+         bench->towers[i] = TBTermTopInsert(bench->state->terms, handle);
+         for(j=0; j<lpo_depth; j++)
+         {
+            handle = TermTopAlloc(f, 2);
+            handle->sort = STIndividuals;
+            handle->args[0] = bench->towers[i];
+            handle->args[1] = bench->towers[i];
+            bench->towers[i] = TBTermTopInsert(bench->state->terms,
+                                               handle);
+         }
+      }
+   }
+   for(i=0; i<bench->ops; i++)
+   {
+      bench->lhs[i] = bench->towers[0];
+      bench->rhs[i] = bench->towers[1];
+   }
+}
+
+static void lpo_tower_setup(BenchState_p bench)
+{
+   tower_setup(bench);
+   if(!bench->lpo_tower)
+   {
+      bench->lpo_tower = OCBAlloc(LPO, true, bench->state->signature);
+      TOGeneratePrecedence(bench->lpo_tower, bench->state->axioms, NULL,
+                           PUnaryFirst);
+   }
+}
+
+static long lpo_tower_op(BenchState_p bench, long i)
+{
+   return TOCompare(bench->lpo_tower, bench->lhs[i], bench->rhs[i],
+                    DEREF_NEVER, DEREF_NEVER)!=to_uncomparable;
+}
+
+static void lpo4_tower_setup(BenchState_p bench)
+{
+   tower_setup(bench);
+   if(!bench->lpo4_tower)
+   {
+      bench->lpo4_tower = OCBAlloc(LPO4, true, bench->state->signature);
+      TOGeneratePrecedence(bench->lpo4_tower, bench->state->axioms, NULL,
+                           PUnaryFirst);
+   }
+}
+
+static long lpo4_tower_op(BenchState_p bench, long i)
+{
+   return TOCompare(bench->lpo4_tower, bench->lhs[i], bench->rhs[i],
+                    DEREF_NEVER, DEREF_NEVER)!=to_uncomparable;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: pdt_setup()
+//
+//   Index all non-variable literal sides of all clauses in a perfect
+//   discrimination tree (as if they were demodulators). The clauses
+//   are dated after the creation time (the normal form date of the
+//   query terms), so that the age constraints do not prune the
+//   search.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, sets clause dates
+//
+/----------------------------------------------------------------------*/
+
+static void pdt_setup(BenchState_p bench)
+{
+   Clause_p    handle;
+   Eqn_p       lit;
+   ClausePos_p pos;
+   EqnSide     side;
+   SysDate     date = SysDateCreationTime();
+
+   if(!bench->pdt)
+   {
+      bench->pdt = PDTreeAlloc();
+      SysDateInc(&date);
+      for(handle = bench->state->axioms->anchor->succ;
+          handle != bench->state->axioms->anchor;
+          handle = handle->succ)
+      {
+         handle->date = date;
+         for(lit = handle->literals; lit; lit = lit->next)
+         {
+            for(side = LeftSide; side <= RightSide; side++)
+            {
+               if(side == RightSide && !EqnIsEquLit(lit))
+               {
+                  break;
+               }
+               if(TermIsVar(side==LeftSide?lit->lterm:lit->rterm))
+               {
+                  continue;
+               }
+               pos          = ClausePosCellAlloc();
+               pos->clause  = handle;
+               pos->literal = lit;
+               pos->side    = side;
+               pos->pos     = NULL;
+               PDTreeInsert(bench->pdt, pos);
+            }
+         }
+      }
+   }
+   setup_queries(bench);
+}
+
+static long pdt_op(BenchState_p bench, long i)
+{
+   long res = 0;
+
+   PDTreeSearchInit(bench->pdt, bench->lhs[i], PDTREE_IGNORE_NF_DATE, false);
+   while(PDTreeFindNextDemodulator(bench->pdt, bench->subst))
+   {
+      res++;
+   }
+   PDTreeSearchExit(bench->pdt);
+   SubstBacktrack(bench->subst);
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fp_setup()
+//
+//   Index all distinct subterms in an FP7 fingerprint index.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void fp_setup(BenchState_p bench)
+{
+   PStackPointer i;
+
+   if(!bench->fpindex)
+   {
+      bench->fpindex = FPIndexAlloc(IndexFP7Create,
+                                    bench->state->signature, NULL);
+      for(i=0; i<PStackGetSP(bench->terms); i++)
+      {
+         FPIndexInsert(bench->fpindex, PStackElementP(bench->terms, i));
+      }
+   }
+}
+
+static void fp_unif_setup(BenchState_p bench)
+{
+   fp_setup(bench);
+   setup_queries(bench);
+}
+
+static long fp_unif_op(BenchState_p bench, long i)
+{
+   PStackReset(bench->collect);
+   return FPIndexFindUnifiable(bench->fpindex, bench->lhs[i],
+                               bench->collect);
+}
+
+static void fp_match_setup(BenchState_p bench)
+{
+   fp_setup(bench);
+   setup_patterns(bench);
+}
+
+static long fp_match_op(BenchState_p bench, long i)
+{
+   PStackReset(bench->collect);
+   return FPIndexFindMatchable(bench->fpindex, bench->lhs[i],
+                               bench->collect);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: fvi_setup()
+//
+//   Index every other clause in a feature vector index (with E's
+//   default feature selection) and use the others as forward
+//   subsumption queries.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void fvi_setup(BenchState_p bench)
+{
+   Clause_p    handle, copy;
+   PStack_p    queries;
+   FVCollect_p cspec;
+   long        i, symbols;
+
+   if(!bench->fvset)
+   {
+      symbols = MIN(bench->state->signature->f_count+
+                    FVINDEX_SYMBOL_SLACK_DEFAULT,
+                    FVINDEX_MAX_FEATURES_DEFAULT);
+      cspec = FVCollectAlloc(FVICollectFeatures,
+                             true,
+                             0,
+                             symbols*2+2,
+                             2,
+                             0,
+                             symbols,
+                             symbols+2,
+                             0,
+                             symbols,
+                             0,0,0,
+                             0,0,0);
+      bench->fvset = ClauseSetAlloc();
+      bench->fvset->fvindex = FVIAnchorAlloc(cspec, NULL);
+      queries = PStackAlloc();
+      i = 0;
+      for(handle = bench->state->axioms->anchor->succ;
+          handle != bench->state->axioms->anchor;
+          handle = handle->succ)
+      {
+         copy = ClauseCopy(handle, bench->state->terms);
+         ClauseSubsumeOrderSortLits(copy);
+         copy->weight = ClauseStandardWeight(copy);
+         if(i++%2)
+         {
+            PStackPushP(queries, copy);
+         }
+         else
+         {
+            ClauseSetIndexedInsertClause(bench->fvset, copy);
+         }
+      }
+      if(PStackEmpty(queries))
+      {
+         PStackPushP(queries, bench->fvset->anchor->succ);
+      }
+      for(i=0; i<bench->ops; i++)
+      {
+         bench->queries[i] = PStackElementP(queries,
+                                            rand_below(PStackGetSP(queries)));
+      }
+      PStackFree(queries);
+   }
+}
+
+static long fvi_op(BenchState_p bench, long i)
+{
+   return ClauseSetSubsumesClause(bench->fvset, bench->queries[i])!=NULL;
+}
+
+/* Symbol names are copied, as the parser looks up its own token
+   buffer, not the names stored in the signature. */
+
+static void sigfind_setup(BenchState_p bench)
+{
+   Sig_p sig = bench->state->signature;
+   long  i;
+
+   if(!bench->names)
+   {
+      bench->names = SizeMalloc(bench->ops*sizeof(char*));
+      for(i=0; i<bench->ops; i++)
+      {
+         bench->names[i] =
+            SecureStrdup(SigFindName(sig, 1+rand_below(sig->f_count)));
+      }
+   }
+}
+
+static long sigfind_op(BenchState_p bench, long i)
+{
+   return SigFindFCode(bench->state->signature, bench->names[i])!=0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: markcopies_setup()
+//
+//   Create the clause sets for ClauseSetMarkCopies(). Each clause is
+//   a copy of a random problem clause or (with probability
+//   MARKCOPIES_PROB) of a random earlier clause of the same set.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void markcopies_setup(BenchState_p bench)
+{
+   PStack_p clauses, members;
+   Clause_p handle;
+   long     i, j;
+
+   if(!bench->copysets)
+   {
+      clauses = PStackAlloc();
+      members = PStackAlloc();
+      for(handle = bench->state->axioms->anchor->succ;
+          handle != bench->state->axioms->anchor;
+          handle = handle->succ)
+      {
+         PStackPushP(clauses, handle);
+      }
+      bench->copysets = SizeMalloc(MARKCOPIES_SETS*sizeof(ClauseSet_p));
+      for(i=0; i<MARKCOPIES_SETS; i++)
+      {
+         bench->copysets[i] = ClauseSetAlloc();
+         PStackReset(members);
+         for(j=0; j<MARKCOPIES_SIZE; j++)
+         {
+            if(j && JKISSRandDouble() < MARKCOPIES_PROB)
+            {
+               handle = PStackElementP(members, rand_below(j));
+            }
+            else
+            {
+               handle = PStackElementP(clauses,
+                                       rand_below(PStackGetSP(clauses)));
+            }
+            handle = ClauseCopy(handle, bench->state->terms);
+            ClauseSetInsert(bench->copysets[i], handle);
+            PStackPushP(members, handle);
+         }
+      }
+      PStackFree(members);
+      PStackFree(clauses);
+   }
+}
+
+static long markcopies_op(BenchState_p bench, long i)
+{
+   ClauseSet_p set = bench->copysets[i%MARKCOPIES_SETS];
+   long        res = ClauseSetMarkCopies(set);
+
+   ClauseSetDelProp(set, CPDeleteClause);
+   return res;
+}
+
+
+/* The benchmarks, in the order they are run */
+
+BenchCell benchmarks[] =
+{
+   {"tbinsert", tbinsert_setup, tbinsert_op,
+    "TBInsert() of random subterms into an initially empty term bank "
+    "(result: new term cells)"},
+   {"match",    setup_pairs,    match_op,
+    "SubstComputeMatch() of a pattern against a term "
+    "(result: success)"},
+   {"mgu",      setup_pairs,    mgu_op,
+    "SubstComputeMgu() of a pattern and a term (result: success)"},
+   {"sigfind",  sigfind_setup,  sigfind_op,
+    "SigFindFCode() of the name of a random symbol "
+    "(result: found)"},
+   {"kbo",      kbo_setup,      kbo_op,
+    "KBO6 comparison (result: comparable)"},
+   {"lpo",      lpo_setup,      lpo_op,
+    "LPO4 comparison (result: comparable)"},
+   {"pdt",      pdt_setup,      pdt_op,
+    "Retrieval of all generalizations from a PDT of all literal sides "
+    "(result: matches)"},
+   {"fp-unif",  fp_unif_setup,  fp_unif_op,
+    "FP7 index retrieval of unification candidates among all "
+    "subterms (result: candidate leaves)"},
+   {"fp-match", fp_match_setup, fp_match_op,
+    "FP7 index retrieval of instance candidates of a pattern "
+    "(result: candidate leaves)"},
+   {"fvi",      fvi_setup,      fvi_op,
+    "Forward subsumption of a clause by half of the clauses via the "
+    "feature vector index (result: subsumed)"},
+   {"markcopies", markcopies_setup, markcopies_op,
+    "ClauseSetMarkCopies() on a set of 256 clauses, about a quarter "
+    "of them copies of others (result: copies)"},
+   {"lpo-tower", lpo_tower_setup, lpo_tower_op,
+    "LPO comparison of two f(s,s)-towers, only with --lpo-depth "
+    "(result: comparable)"},
+   {"lpo4-tower", lpo4_tower_setup, lpo4_tower_op,
+    "LPO4 comparison of two f(s,s)-towers, only with --lpo-depth "
+    "(result: comparable)"},
+   {NULL, NULL, NULL, NULL}
+};
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_selected()
+//
+//   Return true if name occurs in the comma-separated list of
+//   selected benchmarks (or if there is no such list).
+//
+// Global Variables: bench_select
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static bool bench_selected(char* name)
+{
+   char   *start, *end;
+   size_t len = strlen(name);
+
+   if(!bench_select)
+   {
+      return true;
+   }
+   for(start = bench_select; *start; start = end)
+   {
+      end = strchr(start, ',');
+      if(!end)
+      {
+         end = start+strlen(start);
+      }
+      if((size_t)(end-start) == len && strncmp(start, name, len)==0)
+      {
+         return true;
+      }
+      if(*end)
+      {
+         end++;
+      }
+   }
+   return false;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: cmp_long_long()
+//
+//   Comparison function for qsort().
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int cmp_long_long(const void* p1, const void* p2)
+{
+   const long long *l1 = p1, *l2 = p2;
+
+   return (*l1 > *l2) - (*l1 < *l2);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: bench_run()
+//
+//   Set up and run a benchmark, timing each operation individually,
+//   and print a result line.
+//
+// Global Variables: -
+//
+// Side Effects    : Output, whatever the benchmark does
+//
+/----------------------------------------------------------------------*/
+
+static void bench_run(FILE* out, BenchState_p bench, Bench_p desc,
+                      long long *latency)
+{
+   long      i, hits = 0;
+   long long start, total = 0;
+   double    n = bench->ops;
+
+   JKISSSeed(seed, 8765, 4321);
+   desc->setup(bench);
+   /* Warm up caches and lazily computed data */
+   for(i=0; i<MIN(bench->ops, 1000); i++)
+   {
+      desc->op(bench, i);
+   }
+   if(desc->setup == tbinsert_setup)
+   {
+      desc->setup(bench);
+   }
+   for(i=0; i<bench->ops; i++)
+   {
+      start = bench_nsec();
+      hits += desc->op(bench, i);
+      latency[i] = bench_nsec()-start;
+      total += latency[i];
+   }
+   qsort(latency, bench->ops, sizeof(long long), cmp_long_long);
+   fprintf(out, "%-10s %9ld %12.0f %9.1f %8lld %8lld %8lld %9lld %10.3f\n",
+           desc->name,
+           bench->ops,
+           total?n*1000000000.0/total:0.0,
+           total/n,
+           latency[(long)((n-1)*0.5)],
+           latency[(long)((n-1)*0.9)],
+           latency[(long)((n-1)*0.99)],
+           latency[bench->ops-1],
+           hits/n);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: timer_overhead()
+//
+//   Return the median cost of an (empty) timed section in
+//   nanoseconds.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static long long timer_overhead(long long *latency, long n)
+{
+   long      i;
+   long long start;
+
+   for(i=0; i<n; i++)
+   {
+      start = bench_nsec();
+      latency[i] = bench_nsec()-start;
+   }
+   qsort(latency, n, sizeof(long long), cmp_long_long);
+   return latency[n/2];
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: main()
+//
+//   Entry point of the program and driver of the processing.
+//
+// Global Variables: All declared in this file
+//
+// Side Effects    : Yes ;-)
+//
+/----------------------------------------------------------------------*/
+
+int main(int argc, char* argv[])
+{
+   CLState_p      state;
+   Scanner_p      in;
+   StrTree_p      skip_includes = NULL;
+   BenchStateCell bench;
+   Bench_p        desc;
+   char           *gen_name = NULL;
+   long long      *latency;
+   double         size_sum = 0;
+   long long      parse_time;
+   PStackPointer  i;
+
+   assert(argv[0]);
+#ifdef STACK_SIZE
+   INCREASE_STACK_SIZE;
+#endif
+   InitIO(NAME);
+
+   state = process_options(argc, argv);
+   OpenGlobalOut(outname);
+   JKISSSeed(seed, 8765, 4321);
+
+   if(state->argc ==  0)
+   {
+      gen_name = gen_problem(gen_clauses, gen_depth);
+      CLStateInsertArg(state, gen_name);
+   }
+
+   memset(&bench, 0, sizeof(BenchStateCell));
+   bench.state = ProofStateAlloc(FPIgnoreProps);
+   parse_time  = bench_nsec();
+   for(i=0; state->argv[i]; i++)
+   {
+      in = CreateScanner(StreamTypeFile, state->argv[i], true, NULL);
+      ScannerSetFormat(in, AutoFormat);
+      FormulaAndClauseSetParse(in, bench.state->f_axioms,
+                               bench.state->watchlist, bench.state->terms,
+                               NULL, &skip_includes);
+      DestroyScanner(in);
+   }
+   parse_time = bench_nsec()-parse_time;
+   if(gen_name)
+   {
+      TempFileRemove(gen_name);
+      FREE(gen_name);
+   }
+   FormulaSetPreprocConjectures(bench.state->f_axioms,
+                                bench.state->f_ax_archive, false, false);
+   FormulaSetCNF2(bench.state->f_axioms, bench.state->f_ax_archive,
+                  bench.state->axioms, bench.state->terms,
+                  bench.state->freshvars, bench.state->gc_terms, 1000);
+   VERBOUT("Problem read and clausified\n");
+
+   bench.terms = PStackAlloc();
+   {
+      Clause_p handle;
+      Eqn_p    lit;
+
+      for(handle = bench.state->axioms->anchor->succ;
+          handle != bench.state->axioms->anchor;
+          handle = handle->succ)
+      {
+         for(lit = handle->literals; lit; lit = lit->next)
+         {
+            collect_subterms(lit->lterm, bench.terms);
+            if(EqnIsEquLit(lit))
+            {
+               collect_subterms(lit->rterm, bench.terms);
+            }
+         }
+      }
+   }
+   TermStackDelProps(bench.terms, TPOpFlag);
+   if(PStackEmpty(bench.terms))
+   {
+      Error("Problem contains no non-variable terms", USAGE_ERROR);
+   }
+   for(i=0; i<PStackGetSP(bench.terms); i++)
+   {
+      size_sum += TermStandardWeight((Term_p)PStackElementP(bench.terms, i));
+   }
+
+   bench.ops     = operations;
+   bench.lhs     = SizeMalloc(operations*sizeof(Term_p));
+   bench.rhs     = SizeMalloc(operations*sizeof(Term_p));
+   bench.queries = SizeMalloc(operations*sizeof(Clause_p));
+   bench.subst   = SubstAlloc();
+   bench.collect = PStackAlloc();
+   latency       = SizeMalloc(operations*sizeof(long long));
+
+   fprintf(GlobalOut,
+           "# %ld clauses, %ld distinct subterms (average weight %.1f), "
+           "%ld operations per benchmark\n",
+           bench.state->axioms->members, (long)PStackGetSP(bench.terms),
+           size_sum/PStackGetSP(bench.terms), operations);
+   fprintf(GlobalOut, "# Parse time: %.3f s for %ld symbols\n",
+           parse_time/1000000000.0,
+           (long)SigExternalSymbols(bench.state->signature));
+   fprintf(GlobalOut, "# Timer overhead (included below): %lld ns\n",
+           timer_overhead(latency, MIN(operations, 10000)));
+   fprintf(GlobalOut, "%-10s %9s %12s %9s %8s %8s %8s %9s %10s\n",
+           "# Bench", "Ops", "Ops/s", "Mean(ns)", "p50(ns)", "p90(ns)",
+           "p99(ns)", "Max(ns)", "Result/op");
+   for(desc = benchmarks; desc->name; desc++)
+   {
+      if(!lpo_depth && (desc->setup == lpo_tower_setup ||
+                        desc->setup == lpo4_tower_setup))
+      {
+         continue;
+      }
+      if(bench_selected(desc->name))
+      {
+         bench_run(GlobalOut, &bench, desc, latency);
+         fflush(GlobalOut);
+      }
+   }
+
+#ifndef FAST_EXIT
+   SizeFree(latency, operations*sizeof(long long));
+   SizeFree(bench.lhs, operations*sizeof(Term_p));
+   SizeFree(bench.rhs, operations*sizeof(Term_p));
+   SizeFree(bench.queries, operations*sizeof(Clause_p));
+   SubstFree(bench.subst);
+   PStackFree(bench.collect);
+   if(bench.names)
+   {
+      for(i=0; i<operations; i++)
+      {
+         FREE(bench.names[i]);
+      }
+      SizeFree(bench.names, operations*sizeof(char*));
+   }
+   PStackFree(bench.terms);
+   if(bench.kbo)
+   {
+      OCBFree(bench.kbo);
+   }
+   if(bench.lpo)
+   {
+      OCBFree(bench.lpo);
+   }
+   if(bench.lpo_tower)
+   {
+      OCBFree(bench.lpo_tower);
+   }
+   if(bench.lpo4_tower)
+   {
+      OCBFree(bench.lpo4_tower);
+   }
+   if(bench.bank)
+   {
+      bench.bank->sig = NULL;
+      TBFree(bench.bank);
+   }
+   if(bench.pdt)
+   {
+      PDTreeFree(bench.pdt);
+   }
+   if(bench.fpindex)
+   {
+      FPIndexFree(bench.fpindex);
+   }
+   if(bench.fvset)
+   {
+      ClauseSetFree(bench.fvset);
+   }
+   if(bench.copysets)
+   {
+      for(i=0; i<MARKCOPIES_SETS; i++)
+      {
+         ClauseSetFree(bench.copysets[i]);
+      }
+      SizeFree(bench.copysets, MARKCOPIES_SETS*sizeof(ClauseSet_p));
+   }
+   ProofStateFree(bench.state);
+   StrTreeFree(skip_includes);
+#endif
+   CLStateFree(state);
+   OutClose(GlobalOut);
+   ExitIO();
+
+#ifdef CLB_MEMORY_DEBUG
+   MemFlushFreeList();
+   MemDebugPrintStats(stdout);
+#endif
+
+   return 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, Verbose, operations, bench_select, seed,
+//                   gen_clauses, gen_depth, gen_consts, gen_funs,
+//                   lpo_depth, LPOMemoThreshold
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg;
+   long   symbols;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_VERBOSE:
+            Verbose = CLStateGetIntArg(handle, arg);
+            break;
+      case OPT_HELP:
+            print_help(stdout);
+            exit(NO_ERROR);
+      case OPT_VERSION:
+            printf(NAME " " VERSION "\n");
+            exit(NO_ERROR);
+      case OPT_OUTPUT:
+            outname = arg;
+            break;
+      case OPT_OPERATIONS:
+            operations = CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            break;
+      case OPT_BENCHMARKS:
+            bench_select = arg;
+            break;
+      case OPT_SEED:
+            seed = CLStateGetIntArg(handle, arg);
+            break;
+      case OPT_GENERATE:
+            gen_clauses = CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            break;
+      case OPT_GEN_DEPTH:
+            gen_depth = CLStateGetIntArgCheckRange(handle, arg, 1, 64);
+            break;
+      case OPT_GEN_SYMBOLS:
+            symbols = CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            gen_consts = MAX(GEN_CONSTS, symbols/2);
+            gen_funs   = MAX(GEN_FUNS, symbols/6); /* Per arity */
+            break;
+      case OPT_LPO_DEPTH:
+            lpo_depth = CLStateGetIntArgCheckRange(handle, arg, 1,
+                                                   LPO_MAX_DEPTH);
+            break;
+      case OPT_LPO_MEMO:
+            LPOMemoThreshold = CLStateGetIntArgCheckRange(handle, arg, -1,
+                                                          LONG_MAX);
+            break;
+      default:
+            assert(false);
+            break;
+      }
+   }
+   return state;
+}
+
+
+void print_help(FILE* out)
+{
+   Bench_p desc;
+
+   fprintf(out, "\n\
+"NAME " " VERSION "\n\
+\n\
+Usage: " NAME " [options] [files]\n\
+\n\
+Run microbenchmarks of the core term and index operations of E on a\n\
+workload sampled from the given problem files (or, if no file is\n\
+given, from a synthetic clause set). Operands are picked at random\n\
+from the distinct subterms and the clauses of the clausified problem.\n\
+Each operation is timed individually. For each benchmark the program\n\
+prints the number of operations, operations per second, mean and\n\
+percentile latencies, and the average result of the operation.\n\
+\n");
+   PrintOptions(stdout, opts, "Options\n\n");
+   fprintf(out, "\nBenchmarks:\n\n");
+   for(desc = benchmarks; desc->name; desc++)
+   {
+      fprintf(out, "   %-10s %s\n", desc->name, desc->desc);
+   }
+   fprintf(out, "\n\n" E_FOOTER);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -59,6 +59,7 @@ typedef enum
    OPT_PCL_COMPRESSED,
    OPT_PCL_COMPACT,
    OPT_PCL_SHELL_LEVEL,
+   OPT_DERIVATION_LOG,
    OPT_MEM_LIMIT,
    OPT_CPU_LIMIT,
    OPT_SOFTCPU_LIMIT,
@@ -81,12 +82,14 @@ typedef enum
    OPT_TSTP_PARSE,
    OPT_TSTP_PRINT,
    OPT_TSTP_FORMAT,
+   OPT_PROBLEM_CACHE,
    OPT_AUTO,
    OPT_SATAUTO,
    OPT_AUTODEV,
    OPT_SATAUTODEV,
    OPT_AUTO_SCHED,
    OPT_SATAUTO_SCHED,
+   OPT_AUTO_TABLE,
    OPT_NO_PREPROCESSING,
    OPT_EQ_UNFOLD_LIMIT,
    OPT_EQ_UNFOLD_MAXCLAUSES,
@@ -134,7 +137,9 @@ typedef enum
    OPT_TO_CONSTWEIGHT,
    OPT_TO_PRECEDENCE,
    OPT_TO_LPO_RECLIMIT,
+   OPT_TO_LPO_MEMO,
    OPT_TO_RESTRICT_LIT_CMPS,
+   OPT_ORDER_JOBS,
    OPT_TPTP_SOS,
    OPT_ER_DESTRUCTIVE,
    OPT_ER_STRONG_DESTRUCTIVE,
@@ -176,6 +181,7 @@ typedef enum
    OPT_DEF_CNF_OLD,
    OPT_DEF_CNF,
    OPT_MINISCOPE_LIMIT,
+   OPT_CNF_JOBS,
    OPT_PRINT_TYPES,
    OPT_DUMMY
 }OptionCodes;
@@ -300,6 +306,14 @@ OptCell opts[] =
     "initial clauses/formulas, level 2 will print no clauses or axioms. "
     "All levels will still print the dependency graph."},
 
+   {OPT_DERIVATION_LOG,
+    '\0', "derivation-log",
+    ReqArg, NULL,
+    "Write a compact binary log of all inferences into the named file "
+    "instead of printing the PCL/TSTP protocol. Only clauses used as "
+    "premises are written out. Implies an output level of at least 4. "
+    "Use 'epclextract -b' to extract a proof from the log."},
+
    {OPT_PRINT_STATISTICS,
     '\0', "print-statistics",
     NoArg, NULL,
@@ -587,6 +601,17 @@ OptCell opts[] =
     NoArg, NULL,
     "Synonymous with --tstp-format."},
 
+   {OPT_PROBLEM_CACHE,
+    '\0', "problem-cache",
+    ReqArg, NULL,
+    "Use the named file as a binary cache for the parsed problem. If "
+    "the file holds a snapshot of the same input files (with unchanged "
+    "content, including all included files) and was written with the "
+    "same input options, the problem is loaded from it instead of being "
+    "parsed. Otherwise, the input is parsed as usual and the snapshot is "
+    "(re-)written. Snapshots are specific to the machine and E version. "
+    "Not supported for input from stdin."},
+
    {OPT_AUTO,
     '\0', "auto",
     NoArg, NULL,
@@ -625,6 +650,17 @@ OptCell opts[] =
     "Use the (experimental) strategy scheduling without SInE, thus "
     "maintaining completeness."},
 
+   {OPT_AUTO_TABLE,
+    '\0', "auto-table",
+    ReqArg, NULL,
+    "Read the strategy selection table for one of the automatic modes "
+    "from the named file. The file starts with auto_table(<mode>), "
+    "and this table replaces the built-in one for <mode> (e.g. Auto, "
+    "AutoDev or AutoSched3). The format is described in "
+    "HEURISTICS/che_autotable.h, development_tools/auto_to_table.py "
+    "converts the output of the auto mode generators. This option can "
+    "be given several times."},
+
    {OPT_NO_PREPROCESSING,
     '\0', "no-preprocessing",
     NoArg, NULL,
@@ -1013,6 +1049,16 @@ OptCell opts[] =
     "If the problem persists, send a bug report ;-)"
    },
 
+   {OPT_TO_LPO_MEMO,
+    '\0', "lpo-memo-threshold",
+    ReqArg, NULL,
+    "Set the number of recursive steps after which an LPO or LPO4 "
+    "comparison starts to memoize the results for pairs of shared "
+    "subterms. This avoids exponential recomputation on deep terms. "
+    "The cache only lives for a single top-level comparison. The "
+    "default is 128. Use -1 to disable memoization."
+   },
+
    {OPT_TO_RESTRICT_LIT_CMPS,
     '\0', "restrict-literal-comparisons",
     NoArg, NULL,
@@ -1023,6 +1069,14 @@ OptCell opts[] =
     " case (It still is incomplete for the equational case, but pretty"
     " useless anyways)."},
 
+   {OPT_ORDER_JOBS,
+    '\0', "order-jobs",
+    ReqArg, NULL,
+    "Distribute the search for the best term ordering with "
+    "--term-ordering=Optimize over up to the given number of parallel "
+    "worker processes. The selected ordering is the same as for the "
+    "sequential search."},
+
    {OPT_TPTP_SOS,
     '\0', "sos-uses-input-types",
     NoArg, NULL,
@@ -1331,6 +1385,16 @@ OptCell opts[] =
     "default is 1000. Only applies to the new (default) clausification "
     "algorithm"},
 
+   {OPT_CNF_JOBS,
+    '\0', "cnf-jobs",
+    ReqArg, NULL,
+    "Clausify large formula sets in up to the given number of parallel "
+    "worker processes. The resulting clause set (including the names "
+    "of Skolem symbols and definitions) is the same as for sequential "
+    "clausification. Only applies to the new (default) clausification "
+    "algorithm, and is not used when inferences are printed or a proof "
+    "object is built."},
+
    {OPT_PRINT_TYPES,
     '\0', "print-types",
     NoArg, NULL,
@@ -19,15 +19,19 @@ Changes
 
 <1> Mon Feb 21 13:24:04 CET 2011
     New (but borrowing from LTB runner)
+<2> Tue Oct 20 10:12:37 CEST 2026
+    Serve any number of clients via EServerDispatch()
 
 -----------------------------------------------------------------------*/
 
-#include <sys/select.h>
 #include <netinet/in.h>
+#include <signal.h>
+#include <sys/resource.h>
 #include <clb_defines.h>
 #include <cio_commandline.h>
 #include <cio_output.h>
 #include <cio_network.h>
+#include <cco_eserver.h>
 #include <ccl_relevance.h>
 #include <cio_signals.h>
 #include <ccl_formulafunc.h>
@@ -206,6 +210,35 @@ void print_help(FILE* out);
 /*---------------------------------------------------------------------*/
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: raise_fd_limit()
+//
+//   Raise the soft limit on open file descriptors to the hard limit,
+//   so that we can serve as many clients as allowed.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes resource limit
+//
+/----------------------------------------------------------------------*/
+
+static void raise_fd_limit(void)
+{
+   struct rlimit rlim;
+
+   if(getrlimit(RLIMIT_NOFILE, &rlim) == 0 && rlim.rlim_cur < rlim.rlim_max)
+   {
+      rlim.rlim_cur = rlim.rlim_max;
+      if(setrlimit(RLIMIT_NOFILE, &rlim) == -1)
+      {
+         TmpErrno = errno;
+         SysWarning("Cannot raise file descriptor limit");
+      }
+   }
+}
+
+
 
 /*-----------------------------------------------------------------------
 //
@@ -268,74 +301,21 @@ int main(int argc, char* argv[])
    /* Do stuff */
 
    {
-      int sock = CreateServerSock(port);
-      int conn = -1;
-      fd_set rfds, wfds, xfds;
-      int res, tmp;
-      struct sockaddr addr;
-      socklen_t       addr_len = sizeof(addr);
-      char *msg;
-      MsgStatus msg_stat;
+      EServer_p server = EServerAlloc();
 
-      Listen(sock);
+      signal(SIGPIPE, SIG_IGN);
+      raise_fd_limit();
+      EServerListen(server, port);
 
       while(true)
       {
-         printf("Main loop\n");
-         FD_ZERO(&rfds);
-         FD_ZERO(&wfds);
-         FD_ZERO(&xfds);
-         FD_SET(sock, &rfds);
-         if(conn!=-1)
-         {
-            FD_SET(conn, &rfds);
-         }
-         res = select(MAX(sock, conn)+1, &rfds, &wfds, &xfds, NULL);
-         if(res != -1)
-         {
-            if((conn != -1) && FD_ISSET(conn, &rfds))
-            {
-               msg = TCPStringRecv(conn, &msg_stat, false);
-               if(!msg)
-               {
-                  if(msg_stat == NWError)
-                  {
-                     printf("Read error\n");
-                  }
-                  else
-                  {
-                     printf("Connection closed\n");
-                  }
-                  close(conn);
-                  conn = -1;
-               }
-               else
-               {
-                  printf("Received: %s\n", msg);
-                  FREE(msg);
-                  TCPStringSendX(conn, "wait");
-                  TCPStringSendX(conn, "ready");
-               }
-            }
-            if(FD_ISSET(sock, &rfds))
-            {
-               tmp = accept(sock, &addr, &addr_len);
-               if(conn==-1)
-               {
-                  printf("Accepted %d\n", tmp);
-                  conn = tmp;
-               }
-               else
-               {
-                  close(tmp);
-               }
-            }
-         }
-         else
+         if(EServerDispatch(server, -1) == -1)
          {
-            perror("Something weird");
+            TmpErrno = errno;
+            SysWarning("Waiting for connections failed");
          }
       }
+      EServerFree(server);
    }
    /* Done */
 
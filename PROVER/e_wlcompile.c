@@ -0,0 +1,290 @@
+/*-----------------------------------------------------------------------
+
+File  : e_wlcompile.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Read a watchlist (a set of clauses in any of the supported input
+  formats) and write it as a compiled watchlist that eprover
+  --watchlist can load without parsing.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Tue Oct 20 00:48:12 CEST 2026
+    New
+
+-----------------------------------------------------------------------*/
+
+#include <cio_commandline.h>
+#include <cio_output.h>
+#include <cio_signals.h>
+#include <ccl_wlindex.h>
+#include <e_version.h>
+
+
+
+/*---------------------------------------------------------------------*/
+/*                  Data types                                         */
+/*---------------------------------------------------------------------*/
+
+#define NAME "e_wlcompile"
+
+typedef enum
+{
+   OPT_NOOPT=0,
+   OPT_HELP,
+   OPT_VERSION,
+   OPT_VERBOSE,
+   OPT_OUTPUT,
+   OPT_LOP_PARSE,
+   OPT_TPTP_PARSE,
+   OPT_TSTP_PARSE
+}OptionCodes;
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+OptCell opts[] =
+{
+   {OPT_HELP,
+    'h', "help",
+    NoArg, NULL,
+    "Print a short description of program usage and options."},
+
+   {OPT_VERSION,
+    '\0', "version",
+    NoArg, NULL,
+    "Print the version number of the program."},
+
+   {OPT_VERBOSE,
+    'v', "verbose",
+    OptArg, "1",
+    "Verbose comments on the progress of the program by printing "
+    "technical information to stderr."},
+
+   {OPT_OUTPUT,
+    'o', "output-file",
+    ReqArg, NULL,
+   "Name of the compiled watchlist to write. This option is "
+    "required."},
+
+   {OPT_LOP_PARSE,
+    '\0', "lop-in",
+    NoArg, NULL,
+    "Set E-LOP as the input format. If no input format is "
+    "selected by this or one of the following options, E will "
+    "guess the input format based on the first token."},
+
+   {OPT_TPTP_PARSE,
+    '\0', "tptp-in",
+    NoArg, NULL,
+    "Parse TPTP-2 format instead of E-LOP."},
+
+   {OPT_TPTP_PARSE,
+    '\0', "tptp2-in",
+    NoArg, NULL,
+    "Synonymous with --tptp-in."},
+
+   {OPT_TSTP_PARSE,
+    '\0', "tstp-in",
+    NoArg, NULL,
+    "Parse TPTP-3 format instead of E-LOP."},
+
+   {OPT_TSTP_PARSE,
+    '\0', "tptp3-in",
+    NoArg, NULL,
+    "Synonymous with --tstp-in."},
+
+    {OPT_NOOPT,
+    '\0', NULL,
+    NoArg, NULL,
+    NULL}
+};
+
+char     *outname = NULL;
+IOFormat parse_format = AutoFormat;
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[]);
+void print_help(FILE* out);
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: main()
+//
+//   Entry point of the program and driver of the processing.
+//
+// Global Variables: All declared in this file
+//
+// Side Effects    : Yes ;-)
+//
+/----------------------------------------------------------------------*/
+
+int main(int argc, char* argv[])
+{
+   TB_p            terms;
+   SortTable_p     sort_table;
+   Sig_p           sig;
+   ClauseSet_p     clauses;
+   Scanner_p       in;
+   int             i;
+   CLState_p       state;
+
+   assert(argv[0]);
+#ifdef STACK_SIZE
+   INCREASE_STACK_SIZE;
+#endif
+   InitIO(NAME);
+
+   state = process_options(argc, argv);
+
+   if(!outname)
+   {
+      Error("No output file given (use -o)", USAGE_ERROR);
+   }
+   if(state->argc ==  0)
+   {
+      CLStateInsertArg(state, "-");
+   }
+
+   sort_table = DefaultSortTableAlloc();
+   sig        = SigAlloc(sort_table);
+   SigInsertInternalCodes(sig);
+   terms      = TBAlloc(sig);
+   clauses    = ClauseSetAlloc();
+
+   for(i=0; state->argv[i]; i++)
+   {
+      in = CreateScanner(StreamTypeFile, state->argv[i], true, NULL);
+      ScannerSetFormat(in, parse_format);
+      ClauseSetParseList(in, clauses, terms);
+      CheckInpTok(in, NoToken);
+      DestroyScanner(in);
+   }
+   CLStateFree(state);
+   VERBOUT("Watchlist read\n");
+
+   if(!WLIndexStore(outname, clauses, terms))
+   {
+      Error("Writing %s failed", FILE_ERROR, outname);
+   }
+   if(Verbose)
+   {
+      fprintf(stderr, "%s: %ld clauses, %ld term nodes written to %s\n",
+              NAME, clauses->members, TBNonVarTermNodes(terms), outname);
+   }
+
+#ifndef FAST_EXIT
+   ClauseSetFree(clauses);
+   terms->sig = NULL;
+   TBFree(terms);
+   SigFree(sig);
+   SortTableFree(sort_table);
+#endif
+   ExitIO();
+
+#ifdef CLB_MEMORY_DEBUG
+   MemFlushFreeList();
+   MemDebugPrintStats(stdout);
+#endif
+
+   return 0;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: process_options()
+//
+//   Read and process the command line option, return (the pointer to)
+//   a CLState object containing the remaining arguments.
+//
+// Global Variables: opts, Verbose
+//
+// Side Effects    : Sets variables, may terminate with program
+//                   description if option -h or --help was present
+//
+/----------------------------------------------------------------------*/
+
+CLState_p process_options(int argc, char* argv[])
+{
+   Opt_p handle;
+   CLState_p state;
+   char*  arg;
+
+   state = CLStateAlloc(argc,argv);
+
+   while((handle = CLStateGetOpt(state, &arg, opts)))
+   {
+      switch(handle->option_code)
+      {
+      case OPT_VERBOSE:
+            Verbose = CLStateGetIntArg(handle, arg);
+            break;
+      case OPT_HELP:
+            print_help(stdout);
+            exit(NO_ERROR);
+      case OPT_VERSION:
+            printf(NAME " " VERSION "\n");
+            exit(NO_ERROR);
+      case OPT_OUTPUT:
+            outname = arg;
+            break;
+      case OPT_LOP_PARSE:
+            parse_format = LOPFormat;
+            break;
+      case OPT_TPTP_PARSE:
+            parse_format = TPTPFormat;
+            break;
+      case OPT_TSTP_PARSE:
+            parse_format = TSTPFormat;
+            break;
+      default:
+            assert(false);
+            break;
+      }
+   }
+   return state;
+}
+
+
+void print_help(FILE* out)
+{
+   fprintf(out, "\n\
+"NAME " " VERSION "\n\
+\n\
+Usage: " NAME " [options] -o <outfile> [files]\n\
+\n\
+Read a watchlist (a list of clauses) and write it as a compiled\n\
+watchlist. Compiled watchlists are recognized by eprover --watchlist\n\
+and loaded without parsing, and the file is shared between\n\
+concurrent provers via the page cache. A compiled watchlist has to be\n\
+rebuilt whenever E is updated.\n\
+\n");
+   PrintOptions(stdout, opts, "Options\n\n");
+   fprintf(out, "\n\n" E_FOOTER);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
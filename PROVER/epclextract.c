@@ -29,6 +29,7 @@ Changes
 #include <cio_signals.h>
 #include <pcl_protocol.h>
 #include <pcl_miniprotocol.h>
+#include <pcl_derivlog.h>
 #include <e_version.h>
 
 
@@ -45,6 +46,7 @@ typedef enum
    OPT_VERSION,
    OPT_VERBOSE,
    OPT_FAST,
+   OPT_BINARY_LOG,
    OPT_PASS_COMMENTS,
    OPT_TSTP_PRINT,
    OPT_COMPETITION,
@@ -83,6 +85,12 @@ OptCell opts[] =
     "Do a fast extract. With this option the program understands only "
     "a subset of PCL and assumes that all \"proof\" and \"final\" "
     "steps are at the end of the protocoll."},
+   {OPT_BINARY_LOG,
+    'b', "binary-log",
+    NoArg, NULL,
+    "Read binary inference logs (as written by eprover "
+    "--derivation-log) instead of PCL. Output is always in TSTP "
+    "syntax."},
 
    {OPT_PASS_COMMENTS,
     'C', "forward-comments",
@@ -133,6 +141,7 @@ char       *outname    = NULL;
 long       time_limit  = 10;
 char       *executable = NULL;
 bool       fast_extract = false,
+           binary_log = false,
            comp_frame = false,
            no_extract = false,
            pass_comments = false;
@@ -159,6 +168,7 @@ int main(int argc, char* argv[])
    bool            empty_clause = false;
    PCLMiniProt_p   mprot = NULL;
    PCLProt_p       prot = NULL;
+   DLog_p          dlog = NULL;
 
    assert(argv[0]);
 
@@ -186,7 +196,11 @@ int main(int argc, char* argv[])
    }
    steps = 0;
 
-   if(fast_extract)
+   if(binary_log)
+   {
+      dlog = DLogAlloc();
+   }
+   else if(fast_extract)
    {
       mprot = PCLMiniProtAlloc();
    }
@@ -196,6 +210,11 @@ int main(int argc, char* argv[])
    }
    for(i=0; state->argv[i]; i++)
    {
+      if(binary_log)
+      {
+         steps+=DLogRead(dlog, state->argv[i]);
+         continue;
+      }
       in = CreateScanner(StreamTypeFile, state->argv[i], !pass_comments, NULL);
       ScannerSetFormat(in, TPTPFormat);
       if(fast_extract)
@@ -212,7 +231,18 @@ int main(int argc, char* argv[])
    VERBOUT2("PCL input read\n");
    fflush(GlobalOut);
 
-   if(fast_extract)
+   if(binary_log)
+   {
+      if(no_extract)
+      {
+         DLogSetProofSteps(dlog);
+      }
+      else
+      {
+         empty_clause = DLogMarkProofSteps(dlog);
+      }
+   }
+   else if(fast_extract)
    {
       if(no_extract)
       {
@@ -249,7 +279,11 @@ int main(int argc, char* argv[])
     fprintf(GlobalOut, "# SZS output start Saturation.\n");
       }
    }
-   if(fast_extract)
+   if(binary_log)
+   {
+      DLogPrintProofSteps(GlobalOut, dlog);
+   }
+   else if(fast_extract)
    {
       PCLMiniProtPrintProofClauses(GlobalOut,mprot, output_format);
    }
@@ -275,7 +309,11 @@ int main(int argc, char* argv[])
 #ifdef FAST_EXIT
    exit(0);
 #else
-   if(fast_extract)
+   if(binary_log)
+   {
+      DLogFree(dlog);
+   }
+   else if(fast_extract)
    {
       PCLMiniProtFree(mprot);
    }
@@ -337,6 +375,9 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_FAST:
        fast_extract = true;
        break;
+      case OPT_BINARY_LOG:
+       binary_log = true;
+       break;
       case OPT_PASS_COMMENTS:
             pass_comments = true;
             break;
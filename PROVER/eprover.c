@@ -28,8 +28,12 @@
 #include <cio_signals.h>
 #include <ccl_unfold_defs.h>
 #include <ccl_formulafunc.h>
+#include <ccl_cnfjobs.h>
+#include <ccl_problemcache.h>
+#include <ccl_derivlog.h>
 #include <cte_simplesorts.h>
 #include <cco_scheduling.h>
+#include <che_autotable.h>
 #include <e_version.h>
 
 
@@ -85,7 +89,8 @@ long              step_limit = LONG_MAX,
    generated_limit = LONG_MAX,
    eqdef_maxclauses = DEFAULT_EQDEF_MAXCLAUSES,
    relevance_prune_level = 0,
-   miniscope_limit = 1000;
+   miniscope_limit = 1000,
+   cnf_jobs = 1;
 long long tb_insert_limit = LLONG_MAX;
 
 int eqdef_incrlimit = DEFAULT_EQDEF_INCRLIMIT,
@@ -94,6 +99,8 @@ char              *outdesc = DEFAULT_OUTPUT_DESCRIPTOR,
    *filterdesc = DEFAULT_FILTER_DESCRIPTOR;
 PStack_p          wfcb_definitions, hcb_definitions;
 char              *sine=NULL;
+char              *problem_cache=NULL;
+char              *derivation_log=NULL;
 pid_t              pid = 0;
 
 FunctionProperties free_symb_prop = FPIgnoreProps;
@@ -112,15 +119,45 @@ void print_help(FILE* out);
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: adapt_output_format()
+//
+//   Set the output formats according to the detected input format.
+//
+// Global Variables: OutputFormat, DocOutputFormat
+//
+// Side Effects    : As described
+//
+/----------------------------------------------------------------------*/
+
+static void adapt_output_format(IOFormat parse_format_local,
+                                IOFormat in_format)
+{
+   if(parse_format_local == AutoFormat && in_format == TSTPFormat)
+   {
+      OutputFormat = TSTPFormat;
+      if(DocOutputFormat == no_format)
+      {
+         DocOutputFormat = tstp_format;
+      }
+   }
+   if(DocOutputFormat==no_format)
+   {
+      DocOutputFormat = pcl_format;
+   }
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: parse_spec()
 //
-//   Allocate proof state, parse input files into it, and check that
-//   requested properties are met. Factored out of main for reasons of
-//   readability and length.
+//   Allocate proof state, parse input files (or load the problem
+//   cache) into it, and check that requested properties are
+//   met. Factored out of main for reasons of readability and length.
 //
-// Global Variables: -
+// Global Variables: StreamFileLog
 //
 // Side Effects    : Memory, input, may terminate with error.
 //
@@ -130,42 +167,76 @@ ProofState_p parse_spec(CLState_p state,
                         IOFormat parse_format_local,
                         bool error_on_empty_local,
                         FunctionProperties free_symb_prop_local,
+                        char* problem_cache_local,
                         long* ax_no)
 {
    ProofState_p proofstate;
    Scanner_p in;
    int i;
    StrTree_p skip_includes = NULL;
+   char* file_name;
    long parsed_ax_no;
+   long cache_key = ((long)free_symb_prop_local<<2)|parse_format_local;
+   IOFormat in_format = parse_format_local;
 
+   for(i=0; problem_cache_local && state->argv[i]; i++)
+   {
+      if(strcmp(state->argv[i], "-")==0)
+      {
+         Warning("Problem cache not supported for stdin, ignoring it");
+         problem_cache_local = NULL;
+      }
+   }
    proofstate = ProofStateAlloc(free_symb_prop_local);
-   for(i=0; state->argv[i]; i++)
+   if(problem_cache_local &&
+      ProblemCacheLoad(problem_cache_local, state->argv, cache_key,
+                       &in_format, proofstate->terms,
+                       proofstate->f_axioms, proofstate->watchlist))
+   {
+      adapt_output_format(parse_format_local, in_format);
+      VERBOUT2("Specification read from cache\n");
+   }
+   else
    {
-      in = CreateScanner(StreamTypeFile, state->argv[i], true, NULL);
-      ScannerSetFormat(in, parse_format_local);
-      if(parse_format_local == AutoFormat && in->format == TSTPFormat)
+      if(problem_cache_local)
       {
-         OutputFormat = TSTPFormat;
-         if(DocOutputFormat == no_format)
+         StreamFileLog = PStackAlloc();
+      }
+      for(i=0; state->argv[i]; i++)
+      {
+         in = CreateScanner(StreamTypeFile, state->argv[i], true, NULL);
+         ScannerSetFormat(in, parse_format_local);
+         if(in_format != TSTPFormat)
          {
-            DocOutputFormat = tstp_format;
+            in_format = in->format;
          }
+         adapt_output_format(parse_format_local, in->format);
+
+         FormulaAndClauseSetParse(in,
+                                  proofstate->f_axioms,
+                                  proofstate->watchlist,
+                                  proofstate->terms,
+                                  NULL,
+                                  &skip_includes);
+         CheckInpTok(in, NoToken);
+         DestroyScanner(in);
       }
-      if(DocOutputFormat==no_format)
+      VERBOUT2("Specification read\n");
+      if(problem_cache_local)
       {
-         DocOutputFormat = pcl_format;
+         ProblemCacheStore(problem_cache_local, state->argv,
+                           StreamFileLog, cache_key,
+                           in_format, proofstate->terms,
+                           proofstate->f_axioms, proofstate->watchlist);
+         while(!PStackEmpty(StreamFileLog))
+         {
+            file_name = PStackPopP(StreamFileLog);
+            FREE(file_name);
+         }
+         PStackFree(StreamFileLog);
+         StreamFileLog = NULL;
       }
-
-      FormulaAndClauseSetParse(in,
-                               proofstate->f_axioms,
-                               proofstate->watchlist,
-                               proofstate->terms,
-                               NULL,
-                               &skip_includes);
-      CheckInpTok(in, NoToken);
-      DestroyScanner(in);
    }
-   VERBOUT2("Specification read\n");
 
    proofstate->has_interpreted_symbols =
       FormulaSetHasInterpretedSymbol(proofstate->f_axioms);
@@ -240,6 +311,7 @@ static void print_info(void)
 //                   (possibly) IndexUnifTimer)
 //                   (possibly) BWRWTimer);
 //                   (possibly) BWRWIndexTimer)
+//                   (possibly) UnitSRIndexTimer)
 //                   (possibly) IndexMatchTimer
 //                   (possibly) FreqVecTimer);
 //                   (possibly) FVIndexTimer);
@@ -306,6 +378,7 @@ static void print_proof_stats(ProofState_p proofstate,
       PERF_CTR_PRINT(GlobalOut, IndexUnifTimer);
       PERF_CTR_PRINT(GlobalOut, BWRWTimer);
       PERF_CTR_PRINT(GlobalOut, BWRWIndexTimer);
+      PERF_CTR_PRINT(GlobalOut, UnitSRIndexTimer);
       PERF_CTR_PRINT(GlobalOut, IndexMatchTimer);
       PERF_CTR_PRINT(GlobalOut, FreqVecTimer);
       PERF_CTR_PRINT(GlobalOut, FVIndexTimer);
@@ -392,6 +465,11 @@ int main(int argc, char* argv[])
    state = process_options(argc, argv);
 
    OpenGlobalOut(outname);
+   if(derivation_log)
+   {
+      DerivLogOpen(derivation_log);
+      OutputLevel = MAX(OutputLevel, 4);
+   }
    print_info();
 
 
@@ -402,16 +480,11 @@ int main(int argc, char* argv[])
 
    proofstate = parse_spec(state, parse_format,
                            error_on_empty, free_symb_prop,
-                           &parsed_ax_no);
+                           problem_cache, &parsed_ax_no);
 
    relevancy_pruned += ProofStateSinE(proofstate, sine);
    relevancy_pruned += ProofStatePreprocess(proofstate, relevance_prune_level);
 
-   if(strategy_scheduling)
-   {
-      ExecuteSchedule(StratSchedule, h_parms, print_rusage);
-   }
-
    FormulaSetDocInital(GlobalOut, OutputLevel, proofstate->f_axioms);
    ClauseSetDocInital(GlobalOut, OutputLevel, proofstate->axioms);
 
@@ -443,13 +516,14 @@ int main(int argc, char* argv[])
 
    if(new_cnf)
    {
-      cnf_size = FormulaSetCNF2(proofstate->f_axioms,
-                                proofstate->f_ax_archive,
-                                proofstate->axioms,
-                                proofstate->terms,
-                                proofstate->freshvars,
-                                proofstate->gc_terms,
-                                miniscope_limit);
+      cnf_size = FormulaSetParallelCNF2(proofstate->f_axioms,
+                                        proofstate->f_ax_archive,
+                                        proofstate->axioms,
+                                        proofstate->terms,
+                                        proofstate->freshvars,
+                                        proofstate->gc_terms,
+                                        miniscope_limit,
+                                        cnf_jobs);
    }
    else
    {
@@ -488,6 +562,13 @@ int main(int argc, char* argv[])
                                             eqdef_incrlimit,
                                             eqdef_maxclauses);
    }
+   /* Everything up to here is independent of the heuristic and
+      ordering, so it is done once and inherited by all strategies
+      of the schedule. */
+   if(strategy_scheduling)
+   {
+      ExecuteSchedule(StratSchedule, h_parms, print_rusage);
+   }
    //printf("Alive (0.5)!\n");
    proofcontrol = ProofControlAlloc();
    ProofControlInit(proofstate, proofcontrol, h_parms,
@@ -763,6 +844,7 @@ cleanup1:
    PStackFree(wfcb_definitions);
    FVIndexParmsFree(fvi_parms);
    HeuristicParmsFree(h_parms);
+   AutoTablesFree();
 #ifdef FULL_MEM_STATS
    MemFreeListPrint(GlobalOut);
 #endif
@@ -776,6 +858,7 @@ cleanup1:
    MemFlushFreeList();
    MemDebugPrintStats(stdout);
 #endif
+   DerivLogClose();
    OutClose(GlobalOut);
    return retval;
 }
@@ -897,6 +980,9 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_PCL_SHELL_LEVEL:
             PCLShellLevel =  CLStateGetIntArgCheckRange(handle, arg, 0, 2);
             break;
+      case OPT_DERIVATION_LOG:
+            derivation_log = arg;
+            break;
       case OPT_PRINT_STATISTICS:
             print_statistics = true;
             break;
@@ -1049,6 +1135,9 @@ CLState_p process_options(int argc, char* argv[])
             OutputFormat = TSTPFormat;
             EqnUseInfix = true;
             break;
+      case OPT_PROBLEM_CACHE:
+            problem_cache = arg;
+            break;
       case OPT_AUTO:
             h_parms->heuristic_name = "Auto";
             h_parms->ordertype = AUTO;
@@ -1074,6 +1163,9 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_SATAUTO_SCHED:
             strategy_scheduling = true;
             break;
+      case OPT_AUTO_TABLE:
+            AutoTableLoad(arg);
+            break;
       case OPT_NO_PREPROCESSING:
             no_preproc = true;
             break;
@@ -1378,6 +1470,17 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_TO_RESTRICT_LIT_CMPS:
             h_parms->no_lit_cmp = true;
             break;
+      case OPT_ORDER_JOBS:
+            h_parms->order_jobs = CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            break;
+      case OPT_TO_LPO_MEMO:
+            LPOMemoThreshold = CLStateGetIntArg(handle, arg);
+            if(LPOMemoThreshold<-1)
+            {
+               Error("Argument to option --lpo-memo-threshold "
+                     "has to be >= -1", USAGE_ERROR);
+            }
+            break;
       case OPT_TPTP_SOS:
             h_parms->use_tptp_sos = true;
             break;
@@ -1589,6 +1692,9 @@ CLState_p process_options(int argc, char* argv[])
       case OPT_MINISCOPE_LIMIT:
             miniscope_limit =  CLStateGetIntArgCheckRange(handle, arg, 0, LONG_MAX);
             break;
+      case OPT_CNF_JOBS:
+            cnf_jobs = CLStateGetIntArgCheckRange(handle, arg, 1, LONG_MAX);
+            break;
       case OPT_PRINT_TYPES:
             TermPrintTypes = true;
             break;
@@ -18,6 +18,8 @@ Changes
 
 <1> Wed Nov 22 00:31:03 CET 2000
     New
+<2> Tue Oct 20 16:05:42 CEST 2026
+    Cached normal forms for shared terms (TBTermACEqual()).
 
 -----------------------------------------------------------------------*/
 
@@ -105,6 +107,156 @@ static void ac_collect_args(PTree_p* root, Sig_p sig, FunCode f,
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ac_nf_ident_compare()
+//
+//   Compare two shared terms (stored as IntOrP) by cell identity.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int ac_nf_ident_compare(const void* t1, const void* t2)
+{
+   Term_p s1 = ((const IntOrP*)t1)->p_val;
+   Term_p s2 = ((const IntOrP*)t2)->p_val;
+
+   return CMP(TBCellIdent(s1), TBCellIdent(s2));
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ac_nf_push_args()
+//
+//   Push the arguments of the normal form nf of an application of
+//   the AC symbol f onto stack, i.e. walk down the right comb.
+//   Anything else is a single argument.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static void ac_nf_push_args(PStack_p stack, FunCode f, Term_p nf)
+{
+   while(nf->f_code == f)
+   {
+      PStackPushP(stack, nf->args[0]);
+      nf = nf->args[1];
+   }
+   PStackPushP(stack, nf);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ac_nf_build()
+//
+//   Return the normal form of the term top handle, whose arguments
+//   already are normal forms. Consumes handle.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes cache->nf_bank
+//
+/----------------------------------------------------------------------*/
+
+static Term_p ac_nf_build(ACNormCache_p cache, Term_p handle)
+{
+   Sig_p  sig = cache->bank->sig;
+   Term_p res, tmp;
+   PStackPointer i;
+
+   if(handle->arity != 2)
+   {
+      return TBTermTopInsert(cache->nf_bank, handle);
+   }
+   if(SigQueryFuncProp(sig, handle->f_code, FPIsAC))
+   {
+      PStackReset(cache->scratch);
+      ac_nf_push_args(cache->scratch, handle->f_code, handle->args[0]);
+      ac_nf_push_args(cache->scratch, handle->f_code, handle->args[1]);
+      PStackSort(cache->scratch, ac_nf_ident_compare);
+
+      /* Reuse handle for the innermost application */
+      i = PStackGetSP(cache->scratch)-1;
+      handle->args[1] = PStackElementP(cache->scratch, i);
+      handle->args[0] = PStackElementP(cache->scratch, i-1);
+      res = TBTermTopInsert(cache->nf_bank, handle);
+      for(i = i-2; i>=0; i--)
+      {
+         tmp = TermTopAlloc(res->f_code, 2);
+         tmp->sort = res->sort;
+         tmp->args[0] = PStackElementP(cache->scratch, i);
+         tmp->args[1] = res;
+         res = TBTermTopInsert(cache->nf_bank, tmp);
+      }
+      return res;
+   }
+   if(SigQueryFuncProp(sig, handle->f_code, FPCommutative) &&
+      TBCellIdent(handle->args[0]) > TBCellIdent(handle->args[1]))
+   {
+      tmp = handle->args[0];
+      handle->args[0] = handle->args[1];
+      handle->args[1] = tmp;
+   }
+   return TBTermTopInsert(cache->nf_bank, handle);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ac_normal_form()
+//
+//   Return the cached normal form of term (a term from cache->bank),
+//   computing and caching it (and those of its shared subterms) if
+//   necessary. Variables are their own normal form.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes the cache
+//
+/----------------------------------------------------------------------*/
+
+static Term_p ac_normal_form(ACNormCache_p cache, Term_p term)
+{
+   Term_p handle, res;
+   int    i;
+
+   if(TermIsVar(term))
+   {
+      return term;
+   }
+   if(TermIsShared(term))
+   {
+      res = PDArrayElementP(cache->nforms, term->entry_no);
+      if(res)
+      {
+         return res;
+      }
+   }
+   handle = TermTopAlloc(term->f_code, term->arity);
+   handle->sort = term->sort;
+   for(i=0; i<term->arity; i++)
+   {
+      handle->args[i] = ac_normal_form(cache, term->args[i]);
+   }
+   res = ac_nf_build(cache, handle);
+   assert(res->weight == TermStandardWeight(term));
+
+   if(TermIsShared(term))
+   {
+      PDArrayAssignP(cache->nforms, term->entry_no, res);
+   }
+   return res;
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -378,6 +530,108 @@ bool TermACEqual(Sig_p sig, Term_p t1, Term_p t2)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: ACNormCacheAlloc()
+//
+//   Allocate an empty AC normal form cache for terms from bank.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+ACNormCache_p ACNormCacheAlloc(TB_p bank)
+{
+   ACNormCache_p handle = ACNormCacheCellAlloc();
+
+   handle->bank    = bank;
+   handle->nf_bank = TBAlloc(bank->sig);
+   handle->nforms  = PDArrayAlloc(1024, 0);
+   handle->scratch = PStackAlloc();
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: ACNormCacheFree()
+//
+//   Free an AC normal form cache. Normal forms obtained from it
+//   become invalid.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void ACNormCacheFree(ACNormCache_p junk)
+{
+   junk->nf_bank->sig = NULL;
+   TBFree(junk->nf_bank);
+   PDArrayFree(junk->nforms);
+   PStackFree(junk->scratch);
+   ACNormCacheCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBTermACNormalForm()
+//
+//   Return the AC normal form of term from bank (see
+//   cte_acterms.h). Normal forms of shared terms are cached in the
+//   bank. The result is valid until the next garbage collection of
+//   bank.
+//
+// Global Variables: -
+//
+// Side Effects    : May allocate bank->ac_cache, changes it.
+//
+/----------------------------------------------------------------------*/
+
+Term_p TBTermACNormalForm(TB_p bank, Term_p term)
+{
+   if(!bank->ac_cache)
+   {
+      bank->ac_cache = ACNormCacheAlloc(bank);
+   }
+   return ac_normal_form(bank->ac_cache, term);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBTermACEqual()
+//
+//   Return true if the two terms from bank are equal modulo AC as
+//   described in the signature. Equivalent to TermACEqual(), but
+//   uses the normal forms cached in the bank, so that repeated tests
+//   on the same terms are just pointer comparisons.
+//
+// Global Variables: -
+//
+// Side Effects    : May fill bank->ac_cache.
+//
+/----------------------------------------------------------------------*/
+
+bool TBTermACEqual(TB_p bank, Term_p t1, Term_p t2)
+{
+   if(t1 == t2)
+   {
+      return true;
+   }
+   if(TermStandardWeight(t1)!=TermStandardWeight(t2))
+   {
+      return false;
+   }
+   return TBTermACNormalForm(bank, t1) == TBTermACNormalForm(bank, t2);
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
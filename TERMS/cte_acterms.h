@@ -19,6 +19,8 @@ Changes
 
 <1> Fri Nov 17 20:02:15 MET 2000
     New
+<2> Tue Oct 20 16:05:42 CEST 2026
+    Cached normal forms for shared terms.
 
 -----------------------------------------------------------------------*/
 
@@ -28,6 +30,7 @@ Changes
 
 #include <clb_objtrees.h>
 #include <cte_termfunc.h>
+#include <cte_termbanks.h>
 
 /*---------------------------------------------------------------------*/
 /*                    Data type declarations                           */
@@ -42,6 +45,24 @@ typedef struct actermopcell
    PDArray_p        args;         /* Pointer to array of arguments */
 }ACTermCell, *ACTerm_p;
 
+/* Cached AC normal forms of the shared terms of a term bank. Normal
+   forms are themselves shared terms in a private term bank: Nested
+   applications of an AC symbol f are flattened and rebuilt as a
+   right comb f(t1,f(t2,...f(tn-1,tn))) with the ti in normal form
+   and sorted by cell identity, and the arguments of commutative
+   symbols are sorted the same way. Two terms are equal modulo AC if
+   and only if their normal forms are the same cell. The cache is
+   owned by the bank (bank->ac_cache) and is discarded with it and
+   at each garbage collection. */
+
+typedef struct ac_norm_cache_cell
+{
+   TB_p      bank;      /* Normal forms of terms from here... */
+   TB_p      nf_bank;   /* ...are shared here. */
+   PDArray_p nforms;    /* Normal forms indexed by entry_no in bank */
+   PStack_p  scratch;   /* For collecting the arguments of AC terms */
+}ACNormCacheCell, *ACNormCache_p;
+
 
 /*---------------------------------------------------------------------*/
 /*                Exported Functions and Variables                     */
@@ -58,6 +79,14 @@ ACTerm_p ACTermNormalize(Sig_p sig, Term_p term);
 void     ACTermPrint(FILE* out, ACTerm_p term, Sig_p sig);
 bool     TermACEqual(Sig_p sig, Term_p t1, Term_p t2);
 
+#define ACNormCacheCellAlloc() (ACNormCacheCell*)SizeMalloc(sizeof(ACNormCacheCell))
+#define ACNormCacheCellFree(junk) SizeFree(junk, sizeof(ACNormCacheCell))
+
+ACNormCache_p ACNormCacheAlloc(TB_p bank);
+void          ACNormCacheFree(ACNormCache_p junk);
+Term_p        TBTermACNormalForm(TB_p bank, Term_p term);
+bool          TBTermACEqual(TB_p bank, Term_p t1, Term_p t2);
+
 #endif
 
 /*---------------------------------------------------------------------*/
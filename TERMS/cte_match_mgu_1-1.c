@@ -20,6 +20,8 @@ Changes
 
 <1> Wed Mar 11 16:17:33 MET 1998
     New
+<2> Wed Oct 21 19:10:12 CEST 2026
+    Variable-offset versions of matching and unification.
 
 -----------------------------------------------------------------------*/
 
@@ -309,6 +311,245 @@ bool SubstComputeMgu(Term_p t1, Term_p t2, Subst_p subst)
 }
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: SubstComputeMatchOffset()
+//
+//   As SubstComputeMatch(), but the variables of matcher are read as
+//   their twins (i.e. matcher is read with DEREF_OFFSET), and it is
+//   the twins that are bound. This computes a match from a
+//   variable-disjoint copy of matcher without creating the copy, so
+//   matcher and to_match may share variables. Instantiated terms
+//   have to be read with DEREF_OFFSET on the matcher side and
+//   DEREF_NEVER on the to_match side.
+//
+// Global Variables: -
+//
+// Side Effects    : Instantiates terms
+//
+/----------------------------------------------------------------------*/
+
+bool SubstComputeMatchOffset(Term_p matcher, Term_p to_match, Subst_p subst)
+{
+   long matcher_weight  = TermStandardWeight(matcher);
+   long to_match_weight = TermStandardWeight(to_match);
+   Term_p var;
+
+   if((matcher_weight > to_match_weight) || (TermCellQueryProp(to_match, TPPredPos) && TermIsVar(matcher)))
+   {
+      return false;
+   }
+
+   bool res = true;
+   PStackPointer backtrack = PStackGetSP(subst); /* For backtracking */
+   PLocalStackInit(jobs);
+
+   PLocalStackPush(jobs, matcher);
+   PLocalStackPush(jobs, to_match);
+
+   while(!PLocalStackEmpty(jobs))
+   {
+      to_match =  PLocalStackPop(jobs);
+      matcher  =  PLocalStackPop(jobs);
+
+      if(TermIsVar(matcher))
+      {
+         assert(TermVarTwin(matcher));
+         var = TermVarTwin(matcher);
+         if(var->sort != to_match->sort)
+         {
+            res = false;
+            break;
+         }
+         if(var->binding)
+         {
+            if(var->binding != to_match)
+            {
+               res = false;
+               break;
+            }
+         }
+         else
+         {
+            SubstAddBinding(subst, var, to_match);
+         }
+
+         matcher_weight += TermStandardWeight(to_match) - DEFAULT_VWEIGHT;
+
+         if(matcher_weight > to_match_weight)
+         {
+            res = false;
+            break;
+         }
+      }
+      else
+      {
+         if(matcher->f_code != to_match->f_code)
+         {
+            res = false;
+            break;
+         }
+         else
+         {
+            PLocalStackEnsureSpace(jobs, 2*matcher->arity);
+            for(int i=matcher->arity-1; i>=0; i--)
+            {
+               PLocalStackPush(jobs, matcher->args[i]);
+               PLocalStackPush(jobs, to_match->args[i]);
+            }
+         }
+      }
+   }
+
+   PLocalStackFree(jobs);
+   if(!res)
+   {
+      SubstBacktrackToPos(subst,backtrack);
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: SubstComputeMguOffset()
+//
+//   Compute an mgu between t1, read with deref_1, and t2, read with
+//   deref_2. Each of deref_1 and deref_2 is either DEREF_ALWAYS or
+//   DEREF_OFFSET. In the second case, the term is treated as its
+//   variable-disjoint copy (TBInsertDisjoint()) without creating it,
+//   i.e. its variables are read as their twins. This allows the
+//   unification of a term with itself or with a term that shares
+//   variables with it. If a variable is bound to a non-variable
+//   subterm read with DEREF_OFFSET, it is bound to the copy of that
+//   subterm in bank. Otherwise as SubstComputeMgu().
+//
+//   Instantiated terms have to be read with the same deref values
+//   afterwards.
+//
+// Global Variables: -
+//
+// Side Effects    : Instantiates terms, may change bank
+//
+/----------------------------------------------------------------------*/
+
+bool SubstComputeMguOffset(Term_p t1, Term_p t2, Subst_p subst,
+                           DerefType deref_1, DerefType deref_2, TB_p bank)
+{
+   #ifdef MEASURE_UNIFICATION
+      UnifAttempts++;
+   #endif
+
+   assert(deref_1 == DEREF_ALWAYS || deref_1 == DEREF_OFFSET);
+   assert(deref_2 == DEREF_ALWAYS || deref_2 == DEREF_OFFSET);
+
+   PERF_CTR_ENTRY(MguTimer);
+
+   if((TermCellQueryProp(t1, TPPredPos) && TermIsVar(t2))||
+      (TermCellQueryProp(t2, TPPredPos) && TermIsVar(t1)))
+   {
+      PERF_CTR_EXIT(MguTimer);
+      return false;
+
+   }
+   PStackPointer backtrack = PStackGetSP(subst); /* For backtracking */
+
+   bool res = true;
+   PQueue_p jobs = PQueueAlloc();
+
+   PQueueStoreInt(jobs, deref_1);
+   PQueueStoreP(jobs, t1);
+   PQueueStoreInt(jobs, deref_2);
+   PQueueStoreP(jobs, t2);
+
+   while(!PQueueEmpty(jobs))
+   {
+      t2      = PQueueGetLastP(jobs);
+      deref_2 = PQueueGetLastInt(jobs);
+      t1      = PQueueGetLastP(jobs);
+      deref_1 = PQueueGetLastInt(jobs);
+      t2 = TermDeref(t2, &deref_2);
+      t1 = TermDeref(t1, &deref_1);
+
+      if(TermIsVar(t2))
+      {
+         SWAP(t1, t2);
+         SWAP(deref_1, deref_2);
+      }
+
+      if(TermIsVar(t1))
+      {
+         if(deref_2 == DEREF_OFFSET)
+         {
+            t2 = TBInsertDisjoint(bank, t2);
+         }
+         if(t1 != t2)
+         {
+            assert(t1->sort != STNoSort);
+            assert(t2->sort != STNoSort);
+            /* Sort check and occur check - remember, variables are elementary and shared! */
+            if((t1->sort != t2->sort) || occur_check(t2, t1))
+            {
+               res = false;
+               break;
+            }
+            else
+            {
+               SubstAddBinding(subst, t1, t2);
+            }
+         }
+      }
+      else
+      {
+         if(t1->f_code != t2->f_code)
+         {
+            res = false;
+            break;
+         }
+         else
+         {
+            assert(t1->sort != STNoSort);
+            assert(t2->sort != STNoSort);
+            assert(t1->sort == t2->sort);
+            for(int i=t1->arity-1; i>=0; i--)
+            {
+               /* Delay variable bindings */
+               if(TermIsVar(t1->args[i]) || TermIsVar(t2->args[i]))
+               {
+                  PQueueBuryP(jobs, t2->args[i]);
+                  PQueueBuryInt(jobs, deref_2);
+                  PQueueBuryP(jobs, t1->args[i]);
+                  PQueueBuryInt(jobs, deref_1);
+               }
+               else
+               {
+                  PQueueStoreInt(jobs, deref_1);
+                  PQueueStoreP(jobs, t1->args[i]);
+                  PQueueStoreInt(jobs, deref_2);
+                  PQueueStoreP(jobs, t2->args[i]);
+               }
+            }
+         }
+      }
+   }
+   PQueueFree(jobs);
+
+   if(!res)
+   {
+      SubstBacktrackToPos(subst,backtrack);
+   }
+   else
+   {
+      #ifdef MEASURE_UNIFICATION
+         UnifSuccesses++;
+      #endif
+   }
+
+   PERF_CTR_EXIT(MguTimer);
+   return res;
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                        End of File                                  */
 /*---------------------------------------------------------------------*/
@@ -51,6 +51,9 @@ PERF_CTR_DECL(MguTimer);
 
 bool SubstComputeMatch(Term_p matcher, Term_p to_match, Subst_p subst);
 bool SubstComputeMgu(Term_p t1, Term_p t2, Subst_p subst);
+bool SubstComputeMatchOffset(Term_p matcher, Term_p to_match, Subst_p subst);
+bool SubstComputeMguOffset(Term_p t1, Term_p t2, Subst_p subst,
+                           DerefType deref_1, DerefType deref_2, TB_p bank);
 
 #define VerifyMatch(matcher, to_match) \
         TermStructEqualDeref((matcher), (to_match), \
@@ -18,6 +18,9 @@ Changes
 
 <1> Mon Jan 26 19:16:16 MET 1998
     new
+<2> Wed Oct 21 19:27:51 CEST 2026
+    Separate deref values for the replacement and the superterm in
+    TBTermPosReplace().
 
 -----------------------------------------------------------------------*/
 
@@ -145,10 +148,10 @@ Term_p TermFollowRWChain(Term_p term)
 //   if necessary, this is the responsibility of the calling
 //   functions.
 //
-//   Note that this function may dereference terms more than once,
-//   which will lead to strange behaviour if instantiated variables
-//   appear in the term...---> This has been fixed. Each term in repl
-//   and its superterms should now be dereferenced only once.
+//   repl is read with deref_repl, the superterm with deref. The two
+//   may differ if repl and the superterm come from different clauses
+//   that are unified with SubstComputeMguOffset(). Each term in repl
+//   and its superterms is dereferenced only once.
 //
 // Global Variables: -
 //
@@ -157,21 +160,19 @@ Term_p TermFollowRWChain(Term_p term)
 /----------------------------------------------------------------------*/
 
 Term_p TBTermPosReplace(TB_p bank, Term_p repl, TermPos_p pos,
-         DerefType deref)
+                        DerefType deref_repl, DerefType deref)
 {
    Term_p        handle, old;
-   int           subscript;
+   int           subscript, j;
    PStackPointer i;
-   PStack_p      store = PStackAlloc();
-
 
    assert(bank);
    assert(repl);
    assert(pos);
 
+   repl = TBInsertNoProps(bank, repl, deref_repl);
    i = PStackGetSP(pos);
 
-
    /* Note that we start inside-out here - the first term handled is
       the actual subterm replaced, at the end repl is the complete
       term generated.*/
@@ -183,21 +184,16 @@ Term_p TBTermPosReplace(TB_p bank, Term_p repl, TermPos_p pos,
       i--;
 
       old = PStackElementP(pos, i);
-      handle = TermTopCopy(old);
+      handle = TermTopCopyWithoutArgs(old);
+      handle->properties = TPIgnoreProps;
       assert(handle->arity > subscript);
-      handle->args[subscript] = repl;
-      PStackPushP(store, handle);
-      repl = handle;
-   }
-   repl = TBInsertNoProps(bank, repl, deref);
-
-   while(!PStackEmpty(store))
-   {
-      handle = PStackPopP(store);
-      TermTopFree(handle);
+      for(j=0; j<handle->arity; j++)
+      {
+         handle->args[j] = (j==subscript)?repl:
+            TBInsertNoProps(bank, old->args[j], deref);
+      }
+      repl = TBTermTopInsert(bank, handle);
    }
-   PStackFree(store);
-
    return repl;
 }
 
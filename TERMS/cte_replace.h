@@ -57,7 +57,7 @@ void   TermDeleteRWLink(Term_p term);
 Term_p TermFollowRWChain(Term_p term);
 
 Term_p TBTermPosReplace(TB_p bank, Term_p repl, TermPos_p pos,
-         DerefType deref);
+                        DerefType deref_repl, DerefType deref);
 
 
 #endif
@@ -66,6 +66,145 @@ static void sig_print_operator(FILE* out, Sig_p sig, FunCode op, bool comments)
    }
 }
 
+/*-----------------------------------------------------------------------
+//
+// Function: sig_name_hash()
+//
+//   Return a hash value (FNV-1a) for a symbol name.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static unsigned long sig_name_hash(const char* name)
+{
+   unsigned long res = 2166136261UL;
+
+   while(*name)
+   {
+      res = (res ^ (unsigned char)*name) * 16777619UL;
+      name++;
+   }
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sig_index_find_slot()
+//
+//   Return the position of name (with the given hash) in the symbol
+//   index of sig, or the position of the empty slot where it would
+//   be inserted.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static unsigned long sig_index_find_slot(Sig_p sig, const char* name,
+                                         unsigned long hash)
+{
+   unsigned long mask = sig->f_index_size-1, i;
+   SigIndex_p    index = sig->f_index;
+
+   for(i = hash&mask; index[i].f_code; i = (i+1)&mask)
+   {
+      if(index[i].hash == hash &&
+         strcmp(sig->f_info[index[i].f_code].name, name)==0)
+      {
+         break;
+      }
+   }
+   return i;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sig_index_alloc()
+//
+//   Allocate an empty symbol index with size slots.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static SigIndex_p sig_index_alloc(unsigned long size)
+{
+   SigIndex_p    index = SecureMalloc(size*sizeof(SigIndexCell));
+   unsigned long i;
+
+   for(i=0; i<size; i++)
+   {
+      index[i].f_code = 0;
+   }
+   return index;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sig_index_grow()
+//
+//   Double the size of the symbol index of sig and reinsert all
+//   entries.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void sig_index_grow(Sig_p sig)
+{
+   SigIndex_p    old = sig->f_index;
+   unsigned long old_size = sig->f_index_size, mask, i, j;
+
+   sig->f_index_size = 2*old_size;
+   sig->f_index      = sig_index_alloc(sig->f_index_size);
+   mask              = sig->f_index_size-1;
+
+   for(i=0; i<old_size; i++)
+   {
+      if(old[i].f_code)
+      {
+         for(j = old[i].hash&mask; sig->f_index[j].f_code; j = (j+1)&mask)
+         {
+            /* Find free slot */
+         }
+         sig->f_index[j] = old[i];
+      }
+   }
+   FREE(old);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: sig_alpha_cmp()
+//
+//   Compare two function cells by name (for qsort()).
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static int sig_alpha_cmp(const void* f1, const void* f2)
+{
+   const Func_p *func1 = f1, *func2 = f2;
+
+   return strcmp((*func1)->name, (*func2)->name);
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: sig_compute_alpha_ranks()
@@ -80,17 +219,20 @@ static void sig_print_operator(FILE* out, Sig_p sig, FunCode op, bool comments)
 
 static void sig_compute_alpha_ranks(Sig_p sig)
 {
-   PStack_p stack;
-   long count = 0;
-   StrTree_p handle;
-
-   stack = StrTreeTraverseInit(sig->f_index);
+   Func_p  *funcs;
+   FunCode i;
 
-   while((handle = StrTreeTraverseNext(stack)))
+   funcs = SecureMalloc(sig->f_count*sizeof(Func_p));
+   for(i=1; i<=sig->f_count; i++)
    {
-      sig->f_info[handle->val1.i_val].alpha_rank = count++;
+      funcs[i-1] = &(sig->f_info[i]);
    }
-   StrTreeTraverseExit(stack);
+   qsort(funcs, sig->f_count, sizeof(Func_p), sig_alpha_cmp);
+   for(i=0; i<sig->f_count; i++)
+   {
+      funcs[i]->alpha_rank = i;
+   }
+   FREE(funcs);
 
    sig->alpha_ranks_valid = true;
 }
@@ -124,7 +266,8 @@ Sig_p SigAlloc(SortTable_p sort_table)
    handle->f_count        = 0;
    handle->f_info         =
       SecureMalloc(sizeof(FuncCell)*DEFAULT_SIGNATURE_SIZE);
-   handle->f_index = NULL;
+   handle->f_index_size   = SIG_INDEX_MIN_SIZE;
+   handle->f_index        = sig_index_alloc(SIG_INDEX_MIN_SIZE);
    handle->ac_axioms = PStackAlloc();
 
    handle->sort_table = sort_table;
@@ -247,13 +390,18 @@ void SigInsertInternalCodes(Sig_p sig)
 
 void SigFree(Sig_p junk)
 {
+   FunCode i;
+
    assert(junk);
    assert(junk->f_info);
 
-   /* names are shared with junk->f_index and are free()ed by the
-      StrTreeFree() call below! */
+   /* names are shared with junk->f_index, which does not own them. */
+   for(i=1; i<=junk->f_count; i++)
+   {
+      FREE(junk->f_info[i].name);
+   }
    FREE(junk->f_info);
-   StrTreeFree(junk->f_index);
+   FREE(junk->f_index);
    PStackFree(junk->ac_axioms);
    if(junk->orn_codes)
    {
@@ -280,15 +428,8 @@ void SigFree(Sig_p junk)
 
 FunCode SigFindFCode(Sig_p sig, const char* name)
 {
-   StrTree_p entry;
-
-   entry = StrTreeFind(&(sig->f_index), name);
-
-   if(entry)
-   {
-      return entry->val1.i_val;
-   }
-   return 0;
+   return sig->f_index[sig_index_find_slot(sig, name,
+                                           sig_name_hash(name))].f_code;
 }
 
 
@@ -564,10 +705,12 @@ void SigSetAllSpecial(Sig_p sig, bool value)
 
 FunCode SigInsertId(Sig_p sig, const char* name, int arity, bool special_id)
 {
-   long      pos;
-   StrTree_p new, test;
+   long          pos;
+   unsigned long hash, slot;
 
-   pos = SigFindFCode(sig, name);
+   hash = sig_name_hash(name);
+   slot = sig_index_find_slot(sig, name, hash);
+   pos  = sig->f_index[slot].f_code;
 
    if(pos) /* name is already known */
    {
@@ -599,12 +742,12 @@ FunCode SigInsertId(Sig_p sig, const char* name, int arity, bool special_id)
    sig->f_info[sig->f_count].properties = FPIgnoreProps;
    sig->f_info[sig->f_count].type = NULL;
    sig->f_info[sig->f_count].feature_offset = -1;
-   new = StrTreeCellAllocEmpty();
-   new->key = sig->f_info[sig->f_count].name;
-   new->val1.i_val = sig->f_count;
-
-   test = StrTreeInsert(&(sig->f_index), new);
-   UNUSED(test); assert(test == NULL);
+   sig->f_index[slot].hash   = hash;
+   sig->f_index[slot].f_code = sig->f_count;
+   if(2*sig->f_count >= sig->f_index_size)
+   {
+      sig_index_grow(sig);
+   }
    SigSetSpecial(sig,sig->f_count,special_id);
    sig->alpha_ranks_valid = false;
 
@@ -1218,7 +1361,8 @@ FunCode SigGetOtherEqnCode(Sig_p sig, FunCode f_code)
 // Function: SigGetNewSkolemCode()
 //
 //   Return a new skolem symbol with arity n. The symbol will be of
-//   the form esk<count>_<ar>, and is guaranteed to be new to sig.
+//   the form esk<count>_<ar>, and is guaranteed to be new to sig. It
+//   is marked with FPSkolemSymbol.
 //
 // Global Variables: -
 //
@@ -1239,6 +1383,7 @@ FunCode SigGetNewSkolemCode(Sig_p sig, int arity)
       sprintf(new_symbol,"esk%ld_%d",sig->skolem_count,arity);
    }
    res = SigInsertId(sig, new_symbol, arity, false);
+   SigSetFuncProp(sig, res, FPSkolemSymbol);
    return res;
 }
 
@@ -1248,7 +1393,8 @@ FunCode SigGetNewSkolemCode(Sig_p sig, int arity)
 // Function: SigGetNewPredicateCode()
 //
 //   Return a new predicate symbol with arity n. The symbol will be of
-//   the form epred<count>_<ar>, and is guaranteed to be new to sig.
+//   the form epred<count>_<ar>, and is guaranteed to be new to sig. It
+//   is marked with FPNewPredicate.
 //
 // Global Variables: -
 //
@@ -1269,6 +1415,7 @@ FunCode SigGetNewPredicateCode(Sig_p sig, int arity)
       sprintf(new_symbol,"epred%ld_%d",sig->newpred_count,arity);
    }
    res = SigInsertId(sig, new_symbol, arity, false);
+   SigSetFuncProp(sig, res, FPNewPredicate);
 
    return res;
 }
@@ -19,6 +19,10 @@ Changes
 
 <1> Thu Sep 18 16:54:31 MET DST 1997
     New
+<2> Tue Oct 20 14:05:12 CEST 2026
+    Symbol index is a hash table instead of a splay tree.
+<3> Wed Oct 21 16:42:07 CEST 2026
+    FPSkolemSymbol, FPNewPredicate.
 
 -----------------------------------------------------------------------*/
 
@@ -58,9 +62,11 @@ typedef enum
                            * defintion off if not in use! */
    FPClSplitDef   = 4096, /* Predicate is a clause split defined
                            * symbol. */
-   FPPseudoPred   = 8192  /* Pseudo-predicate used for side effects
+   FPPseudoPred   = 8192, /* Pseudo-predicate used for side effects
                            * only, does not conceptually contribute to
                            * truth of clause */
+   FPSkolemSymbol = 16384, /* Generated by SigGetNewSkolemCode() */
+   FPNewPredicate = 32768  /* Generated by SigGetNewPredicateCode() */
 }FunctionProperties;
 
 
@@ -86,7 +92,9 @@ typedef struct funccell
 /* A signature contains information about function symbols with
    direct access by internal code (f_info is organized as a array,
    with f_info[f_code] being the information associated with f_code)
-   and efficient access by external name (via the f_index array).
+   and efficient access by external name (via the f_index hash
+   table, which maps names to f_codes and uses the names stored in
+   f_info as keys).
 
    Function codes are integers starting at 1, while variables are
    encoded by negative integers. 0 is unused and can thus express
@@ -96,6 +104,16 @@ typedef struct funccell
 #define DEFAULT_SIGNATURE_SIZE 20
 #define DEFAULT_SIGNATURE_GROW 2
 
+/* Entries of the symbol index. f_code 0 marks an empty slot. */
+
+typedef struct sig_index_cell
+{
+   unsigned long hash;
+   FunCode       f_code;
+}SigIndexCell, *SigIndex_p;
+
+#define SIG_INDEX_MIN_SIZE 64 /* Must be a power of 2 */
+
 typedef struct sigcell
 {
    bool      alpha_ranks_valid; /* The alpha-ranks are up to date */
@@ -103,7 +121,8 @@ typedef struct sigcell
    FunCode   f_count;  /* Largest used f_code */
    FunCode   internal_symbols; /* Largest auto-inserted internal symbol */
    Func_p    f_info;   /* The array */
-   StrTree_p f_index;  /* Back-assoc: Given a symbol, get the index */
+   SigIndex_p f_index; /* Back-assoc: Given a symbol, get the index */
+   unsigned long f_index_size; /* Power of 2, more than 2*f_count */
    PStack_p  ac_axioms; /* All recognized AC axioms */
    /* The following are special symbols needed for pattern
       manipulation. We want very efficient access to them! Also
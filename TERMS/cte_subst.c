@@ -18,6 +18,8 @@
 
   <1> Thu Mar  5 00:22:28 MET 1998
   New
+  <2> Wed Oct 21 19:21:37 CEST 2026
+  SubstNormTerm() takes a deref argument.
 
   -----------------------------------------------------------------------*/
 
@@ -134,7 +136,8 @@ int SubstBacktrack(Subst_p subst)
 //   SubstBacktrackToPos() can be used to backtrack the
 //   instantiations term by term. New variables are marked by
 //   TPSpecialFlag, if other variables are marked thus the effect is
-//   unpredictable.
+//   unpredictable. term is read with deref, which has to be
+//   DEREF_ALWAYS or DEREF_OFFSET.
 //
 //   Warning: As variables may be shared, other terms may be affected!
 //   Take care...your best bet is to norm all terms you need with a
@@ -148,15 +151,19 @@ int SubstBacktrack(Subst_p subst)
 //
 /----------------------------------------------------------------------*/
 
-PStackPointer SubstNormTerm(Term_p term, Subst_p subst, VarBank_p vars)
+PStackPointer SubstNormTerm(Term_p term, Subst_p subst, VarBank_p vars,
+                            DerefType deref)
 {
    PStackPointer ret = PStackGetSP(subst);
-   PLocalStackInit(stack);
-   PLocalStackPush(stack, term);
+   PLocalTaggedStackInit(stack);
+   PLocalTaggedStackPush(stack, term, deref);
 
-   while(!PLocalStackEmpty(stack))
+   assert(deref == DEREF_ALWAYS || deref == DEREF_OFFSET);
+
+   while(!PLocalTaggedStackEmpty(stack))
    {
-      term = TermDerefAlways(PLocalStackPop(stack));
+      PLocalTaggedStackPop(stack, term, deref);
+      term = TermDeref(term, &deref);
       if(TermIsVar(term))
       {
          if(!TermCellQueryProp(term, TPSpecialFlag))
@@ -168,11 +175,11 @@ PStackPointer SubstNormTerm(Term_p term, Subst_p subst, VarBank_p vars)
       }
       else
       {
-         PLocalStackPushTermArgsReversed(stack, term);
+         PLocalTaggedStackPushTermArgsReversed(stack, term, deref);
       }
    }
 
-   PLocalStackFree(stack);
+   PLocalTaggedStackFree(stack);
    return ret;
 }
 
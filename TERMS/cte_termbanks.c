@@ -23,11 +23,36 @@
   Changes
 
   Created: Sat Nov 15 16:26:30 MET 1997
+  <1> Mon Oct 19 22:48:10 CEST 2026
+      Probe the term store before allocating new cells in the
+      TBInsert*() family.
+  <2> Tue Oct 20 16:05:42 CEST 2026
+      Own and discard the AC normal form cache.
+  <3> Wed Oct 21 12:20:16 CEST 2026
+      Cache the copies made by TBInsertDisjoint().
+  <4> Wed Oct 21 20:41:19 CEST 2026
+      TBInsertRepl() for terms read with DEREF_OFFSET.
 
   -----------------------------------------------------------------------*/
 
 #include "cte_termbanks.h"
 #include "cte_typecheck.h"
+#include "cte_acterms.h"
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Argument vectors of terms being inserted are collected on the stack
+   up to this arity, and on the heap for larger terms. */
+
+#define TB_LOCAL_ARGS 8
+
+#define TB_ARGS_BUFFER(local, arity)\
+   (((arity)>TB_LOCAL_ARGS)?TermArgArrayAlloc(arity):(local))
+#define TB_ARGS_BUFFER_FREE(local, args, arity)\
+   if((args)!=(local)){TermArgArrayFree((args),(arity));}
 
 
 
@@ -152,6 +177,10 @@ static Term_p tb_termtop_insert(TB_p bank, Term_p t)
    {
       t->entry_no     = ++(bank->in_count);
       TermCellAssignProp(t,TPGarbageFlag, bank->garbage_state);
+      if(bank->gc_young)
+      {
+         PStackPushP(bank->gc_young, t);
+      }
       TermCellSetProp(t, TPIsShared); /* Groundness may change below */
       t->v_count = 0;
       t->f_count = 1;
@@ -355,6 +384,200 @@ static int tb_term_parse_arglist(Scanner_p in, Term_p** arg_anchor,
 
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: tb_termtop_insert_args()
+//
+//   Return the shared term with the top symbol (and sort) of source
+//   and the (shared) arguments args, adding props to its
+//   properties. The term store is probed with a temporary cell
+//   first, so no new cell is allocated if the term already exists -
+//   this is the common case when instantiating clauses into the bank
+//   during inferences.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes term bank
+//
+/----------------------------------------------------------------------*/
+
+static Term_p tb_termtop_insert_args(TB_p bank, Term_p source,
+                                     Term_p *args, TermProperties props)
+{
+   TermCell probe;
+   Term_p   t;
+   int      i;
+
+   assert(!TermIsVar(source));
+
+   if(source->sort != STNoSort)
+   {
+      probe.f_code = source->f_code;
+      probe.sort   = source->sort;
+      probe.arity  = source->arity;
+      probe.args   = args;
+
+      t = TermCellStoreFind(&(bank->term_store), &probe);
+      if(t)
+      {
+         bank->insertions++;
+         t->properties = t->properties | props;
+         return t;
+      }
+   }
+   t = TermTopCopyWithoutArgs(source);
+   t->properties = props;
+
+   assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
+   assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
+
+   for(i=0; i<t->arity; i++)
+   {
+      t->args[i] = args[i];
+   }
+   return tb_termtop_insert(bank, t);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: tb_caches_discard()
+//
+//   Free the AC normal form cache and the cache of disjoint copies of
+//   bank (if any). This is done whenever term cells are reclaimed, so
+//   that the caches do not outgrow the live part of the bank (and
+//   never point to reclaimed cells).
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void tb_caches_discard(TB_p bank)
+{
+   if(bank->ac_cache)
+   {
+      ACNormCacheFree(bank->ac_cache);
+      bank->ac_cache = NULL;
+   }
+   if(bank->disjoint_cache)
+   {
+      SizeFree(bank->disjoint_cache,
+               bank->disjoint_size*sizeof(TBDisjointEntryCell));
+      bank->disjoint_cache = NULL;
+      bank->disjoint_size  = 0;
+      bank->disjoint_count = 0;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: tb_disjoint_find_slot()
+//
+//   Return the slot of the disjoint cache of bank for entry_no -
+//   either the one holding it, or the empty slot where it would be
+//   inserted.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ TBDisjointEntry_p tb_disjoint_find_slot(
+   TB_p bank, unsigned long entry_no)
+{
+   unsigned long mask = bank->disjoint_size-1, i;
+
+   i = entry_no*2654435761UL;
+   i = (i^(i>>16))&mask;
+   while(bank->disjoint_cache[i].entry_no &&
+         bank->disjoint_cache[i].entry_no!=entry_no)
+   {
+      i = (i+1)&mask;
+   }
+   return &(bank->disjoint_cache[i]);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: tb_disjoint_cache_alloc()
+//
+//   Give bank an empty disjoint cache with size slots.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void tb_disjoint_cache_alloc(TB_p bank, unsigned long size)
+{
+   unsigned long i;
+
+   bank->disjoint_cache = SizeMalloc(size*sizeof(TBDisjointEntryCell));
+   bank->disjoint_size  = size;
+   bank->disjoint_count = 0;
+   for(i=0; i<size; i++)
+   {
+      bank->disjoint_cache[i].entry_no = 0;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: tb_disjoint_cache_store()
+//
+//   Remember copy as the disjoint copy of the term with the given
+//   entry_no, growing the cache if it becomes more than half full.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+static void tb_disjoint_cache_store(TB_p bank, unsigned long entry_no,
+                                    Term_p copy)
+{
+   TBDisjointEntry_p slot, old_cache;
+   unsigned long     old_size, i;
+
+   if(!bank->disjoint_cache)
+   {
+      tb_disjoint_cache_alloc(bank, TB_DISJOINT_CACHE_INIT_SIZE);
+   }
+   slot = tb_disjoint_find_slot(bank, entry_no);
+   if(!slot->entry_no)
+   {
+      slot->entry_no = entry_no;
+      bank->disjoint_count++;
+   }
+   slot->copy = copy;
+
+   if(2*bank->disjoint_count > bank->disjoint_size)
+   {
+      old_cache = bank->disjoint_cache;
+      old_size  = bank->disjoint_size;
+      tb_disjoint_cache_alloc(bank, 2*old_size);
+      for(i=0; i<old_size; i++)
+      {
+         if(old_cache[i].entry_no)
+         {
+            *tb_disjoint_find_slot(bank, old_cache[i].entry_no) =
+               old_cache[i];
+            bank->disjoint_count++;
+         }
+      }
+      SizeFree(old_cache, old_size*sizeof(TBDisjointEntryCell));
+   }
+}
+
+
 /*---------------------------------------------------------------------*/
 /*                         Exported Functions                          */
 /*---------------------------------------------------------------------*/
@@ -385,6 +608,10 @@ TB_p TBAlloc(Sig_p sig)
    handle->rewrite_steps = 0;
    handle->ext_index = PDIntArrayAlloc(1,100000);
    handle->garbage_state = TPIgnoreProps;
+   handle->gc_old_limit = 0;
+   handle->gc_young = NULL;
+   handle->gc_remembered = NULL;
+   handle->gc_minor = false;
    handle->sig = sig;
    handle->vars = VarBankAlloc(sig->sort_table);
    TermCellStoreInit(&(handle->term_store));
@@ -401,6 +628,10 @@ TB_p TBAlloc(Sig_p sig)
    TermFree(term);
    handle->min_term    = NULL;
    handle->freevarsets = NULL;
+   handle->ac_cache    = NULL;
+   handle->disjoint_cache = NULL;
+   handle->disjoint_size  = 0;
+   handle->disjoint_count = 0;
    return handle;
 }
 
@@ -424,9 +655,15 @@ void TBFree(TB_p junk)
 
    /* printf("TBFree(): %ld\n", TermCellStoreNodes(&(junk->term_store)));
     */
+   tb_caches_discard(junk);
    TermCellStoreExit(&(junk->term_store));
    PDArrayFree(junk->ext_index);
    VarBankFree(junk->vars);
+   if(junk->gc_young)
+   {
+      PStackFree(junk->gc_young);
+      PStackFree(junk->gc_remembered);
+   }
 
    assert(!junk->freevarsets);
    TBCellFree(junk);
@@ -491,7 +728,7 @@ long TBTermNodes(TB_p bank)
 Term_p TBInsert(TB_p bank, Term_p term, DerefType deref)
 {
    int    i;
-   Term_p t;
+   Term_p t, *args, local_args[TB_LOCAL_ARGS];
 
    assert(term);
 
@@ -503,16 +740,13 @@ Term_p TBInsert(TB_p bank, Term_p term, DerefType deref)
    }
    else
    {
-      t = TermTopCopyWithoutArgs(term); /* This is an unshared term cell at the moment */
-
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
-
-      for(i=0; i<t->arity; i++)
+      args = TB_ARGS_BUFFER(local_args, term->arity);
+      for(i=0; i<term->arity; i++)
       {
-         t->args[i] = TBInsert(bank, term->args[i], deref);
+         args[i] = TBInsert(bank, term->args[i], deref);
       }
-      t = tb_termtop_insert(bank, t);
+      t = tb_termtop_insert_args(bank, term, args, (term->properties&TPPredPos));
+      TB_ARGS_BUFFER_FREE(local_args, args, term->arity);
    }
    return t;
 }
@@ -533,7 +767,7 @@ Term_p TBInsert(TB_p bank, Term_p term, DerefType deref)
 Term_p TBInsertNoProps(TB_p bank, Term_p term, DerefType deref)
 {
    int    i;
-   Term_p t;
+   Term_p t, *args, local_args[TB_LOCAL_ARGS];
 
    assert(term);
 
@@ -545,17 +779,13 @@ Term_p TBInsertNoProps(TB_p bank, Term_p term, DerefType deref)
    }
    else
    {
-      t = TermTopCopyWithoutArgs(term); /* This is an unshared term cell at the moment */
-      t->properties = TPIgnoreProps;
-
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
-
-      for(i=0; i<t->arity; i++)
+      args = TB_ARGS_BUFFER(local_args, term->arity);
+      for(i=0; i<term->arity; i++)
       {
-         t->args[i] = TBInsertNoProps(bank, term->args[i], deref);
+         args[i] = TBInsertNoProps(bank, term->args[i], deref);
       }
-      t = tb_termtop_insert(bank, t);
+      t = tb_termtop_insert_args(bank, term, args, TPIgnoreProps);
+      TB_ARGS_BUFFER_FREE(local_args, args, term->arity);
    }
    return t;
 }
@@ -567,7 +797,10 @@ Term_p TBInsertNoProps(TB_p bank, Term_p term, DerefType deref)
 //
 //   As TBInsertNoProps, but when old is encountered as a subterm
 //   (regardless of instantiation), replace it with uninstantiated
-//   repl (which _must_ be in bank).
+//   repl (which _must_ be in bank). If term is read with
+//   DEREF_OFFSET, the bindings of the twins of its variables belong
+//   to the other variable namespace, so that there the disjoint copy
+//   of old is replaced instead.
 //
 // Global Variables: -
 //
@@ -578,7 +811,7 @@ Term_p TBInsertNoProps(TB_p bank, Term_p term, DerefType deref)
 Term_p  TBInsertRepl(TB_p bank, Term_p term, DerefType deref, Term_p old, Term_p repl)
 {
    int    i;
-   Term_p t;
+   Term_p t, *args, local_args[TB_LOCAL_ARGS];
 
    assert(term);
 
@@ -588,6 +821,11 @@ Term_p  TBInsertRepl(TB_p bank, Term_p term, DerefType deref, Term_p old, Term_p
       return repl;
    }
 
+   if(deref == DEREF_OFFSET && TermIsVar(term) &&
+      TermVarTwin(term)->binding)
+   {
+      old = TBInsertDisjoint(bank, old);
+   }
    term = TermDeref(term, &deref);
 
    if(TermIsVar(term))
@@ -596,17 +834,13 @@ Term_p  TBInsertRepl(TB_p bank, Term_p term, DerefType deref, Term_p old, Term_p
    }
    else
    {
-      t = TermTopCopyWithoutArgs(term); /* This is an unshared term cell at the moment */
-      t->properties = TPIgnoreProps;
-
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
-
-      for(i=0; i<t->arity; i++)
+      args = TB_ARGS_BUFFER(local_args, term->arity);
+      for(i=0; i<term->arity; i++)
       {
-         t->args[i] = TBInsertRepl(bank, term->args[i], deref, old, repl);
+         args[i] = TBInsertRepl(bank, term->args[i], deref, old, repl);
       }
-      t = tb_termtop_insert(bank, t);
+      t = tb_termtop_insert_args(bank, term, args, TPIgnoreProps);
+      TB_ARGS_BUFFER_FREE(local_args, args, term->arity);
    }
    return t;
 }
@@ -632,7 +866,7 @@ Term_p  TBInsertRepl(TB_p bank, Term_p term, DerefType deref, Term_p old, Term_p
 Term_p TBInsertInstantiated(TB_p bank, Term_p term)
 {
    int    i;
-   Term_p t;
+   Term_p t, *args, local_args[TB_LOCAL_ARGS];
 
    assert(term);
 
@@ -654,17 +888,13 @@ Term_p TBInsertInstantiated(TB_p bank, Term_p term)
    }
    else
    {
-      t = TermTopCopyWithoutArgs(term); /* This is an unshared term cell at the moment */
-      t->properties    = TPIgnoreProps;
-
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
-
-      for(i=0; i<t->arity; i++)
+      args = TB_ARGS_BUFFER(local_args, term->arity);
+      for(i=0; i<term->arity; i++)
       {
-         t->args[i] = TBInsertInstantiated(bank, term->args[i]);
+         args[i] = TBInsertInstantiated(bank, term->args[i]);
       }
-      t = tb_termtop_insert(bank, t);
+      t = tb_termtop_insert_args(bank, term, args, TPIgnoreProps);
+      TB_ARGS_BUFFER_FREE(local_args, args, term->arity);
    }
    return t;
 }
@@ -688,7 +918,7 @@ Term_p TBInsertInstantiated(TB_p bank, Term_p term)
 Term_p TBInsertOpt(TB_p bank, Term_p term, DerefType deref)
 {
    int    i;
-   Term_p t;
+   Term_p t, *args, local_args[TB_LOCAL_ARGS];
 
    assert(term);
 
@@ -705,16 +935,13 @@ Term_p TBInsertOpt(TB_p bank, Term_p term, DerefType deref)
    }
    else
    {
-      t = TermTopCopyWithoutArgs(term); /* This is an unshared term cell at the moment */
-
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
-
-      for(i=0; i<t->arity; i++)
+      args = TB_ARGS_BUFFER(local_args, term->arity);
+      for(i=0; i<term->arity; i++)
       {
-         t->args[i] = TBInsertOpt(bank, term->args[i], deref);
+         args[i] = TBInsertOpt(bank, term->args[i], deref);
       }
-      t = tb_termtop_insert(bank, t);
+      t = tb_termtop_insert_args(bank, term, args, (term->properties&TPPredPos));
+      TB_ARGS_BUFFER_FREE(local_args, args, term->arity);
    }
    return t;
 }
@@ -726,18 +953,23 @@ Term_p TBInsertOpt(TB_p bank, Term_p term, DerefType deref)
 //
 //   Create a copy of (uninstantiated) term with disjoint
 //   variables. This assumes that all variables in term are odd or
-//   even, the returned copy will have variable ids shifted by -1.
+//   even, the returned copy will have variable ids shifted by
+//   TB_DISJOINT_VAR_OFFSET (so the copy has the other parity). Shared
+//   terms have to be from bank, their copies are cached, so that the
+//   subterms a clause shares with earlier given clauses are not
+//   traversed again.
 //
 // Global Variables: -
 //
-// Side Effects    : Changes bank.
+// Side Effects    : Changes bank and its disjoint cache.
 //
 /----------------------------------------------------------------------*/
 
 Term_p  TBInsertDisjoint(TB_p bank, Term_p term)
 {
    int    i;
-   Term_p t;
+   Term_p t, *args, local_args[TB_LOCAL_ARGS];
+   TBDisjointEntry_p slot;
 
    assert(term);
 
@@ -749,20 +981,29 @@ Term_p  TBInsertDisjoint(TB_p bank, Term_p term)
 
    if(TermIsVar(term))
    {
-      t = VarBankVarAssertAlloc(bank->vars, term->f_code+1, term->sort);
+      return VarBankVarAssertAlloc(bank->vars,
+                                   term->f_code+TB_DISJOINT_VAR_OFFSET,
+                                   term->sort);
    }
-   else
+   if(TermIsShared(term) && bank->disjoint_cache)
    {
-      t = TermTopCopyWithoutArgs(term); /* This is an unshared term cell at the moment */
-
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[0]));
-      assert(SysDateIsCreationDate(t->rw_data.nf_date[1]));
-
-      for(i=0; i<t->arity; i++)
+      slot = tb_disjoint_find_slot(bank, term->entry_no);
+      if(slot->entry_no)
       {
-         t->args[i] = TBInsertDisjoint(bank, term->args[i]);
+         slot->copy->properties |= (term->properties&TPPredPos);
+         return slot->copy;
       }
-      t = tb_termtop_insert(bank, t);
+   }
+   args = TB_ARGS_BUFFER(local_args, term->arity);
+   for(i=0; i<term->arity; i++)
+   {
+      args[i] = TBInsertDisjoint(bank, term->args[i]);
+   }
+   t = tb_termtop_insert_args(bank, term, args, (term->properties&TPPredPos));
+   TB_ARGS_BUFFER_FREE(local_args, args, term->arity);
+   if(TermIsShared(term))
+   {
+      tb_disjoint_cache_store(bank, term->entry_no, t);
    }
    return t;
 }
@@ -1284,7 +1525,10 @@ long TBTermDelPropCount(Term_p term, TermProperties prop)
 //
 // Function: TBGCMarkTerm()
 //
-//   Mark a term as used for the garbage collector.
+//   Mark a term as used for the garbage collector. During a minor
+//   collection, only young term cells are marked (and traversed) -
+//   old terms are alive by definition, and their arguments are always
+//   older than they are.
 //
 // Global Variables: -
 //
@@ -1294,17 +1538,23 @@ long TBTermDelPropCount(Term_p term, TermProperties prop)
 
 void TBGCMarkTerm(TB_p bank, Term_p term)
 {
-   PStack_p stack = PStackAlloc();
+   PStack_p stack;
    int i;
 
    assert(bank);
    assert(term);
 
+   if(bank->gc_minor && !TBTermIsYoung(bank, term))
+   {
+      return;
+   }
+   stack = PStackAlloc();
    PStackPushP(stack, term);
    while(!PStackEmpty(stack))
    {
       term = PStackPopP(stack);
-      if(!TBTermCellIsMarked(bank,term))
+      if(!TBTermCellIsMarked(bank,term) &&
+         (!bank->gc_minor || TBTermIsYoung(bank, term)))
       {
          TermCellFlipProp(term, TPGarbageFlag);
          for(i=0; i<term->arity; i++)
@@ -1340,6 +1590,7 @@ long TBGCSweep(TB_p bank)
    long recovered = 0;
 
    assert(bank);
+   assert(!bank->gc_minor);
    assert(!TermIsRewritten(bank->true_term));
    TBGCMarkTerm(bank, bank->true_term);
    TBGCMarkTerm(bank, bank->false_term);
@@ -1348,6 +1599,7 @@ long TBGCSweep(TB_p bank)
       TBGCMarkTerm(bank, bank->min_term);
    }
 
+   tb_caches_discard(bank);
    VERBOUT("Garbage collection started.\n");
    recovered = TermCellStoreGCSweep(&(bank->term_store),
                                     bank->garbage_state);
@@ -1363,6 +1615,149 @@ long TBGCSweep(TB_p bank)
 #endif
    bank->garbage_state =
       bank->garbage_state?TPIgnoreProps:TPGarbageFlag;
+   if(bank->gc_young)
+   {
+      PStackReset(bank->gc_young);
+      PStackReset(bank->gc_remembered);
+      bank->gc_old_limit = bank->in_count;
+   }
+   return recovered;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBGCEnableGenerations()
+//
+//   Enable generational garbage collection for the bank. All terms
+//   currently in the bank become the old generation, all terms
+//   inserted from now on are recorded as young until they survive a
+//   collection.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void TBGCEnableGenerations(TB_p bank)
+{
+   assert(bank);
+
+   if(!bank->gc_young)
+   {
+      bank->gc_young      = PStackAlloc();
+      bank->gc_remembered = PStackAlloc();
+      bank->gc_old_limit  = bank->in_count;
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBGCRememberRWLink()
+//
+//   Record that term has just been given a rewrite link. Term
+//   arguments always point to older terms, so rewrite links from old
+//   terms are the only references from the old into the young
+//   generation. They have to be treated as roots by minor
+//   collections.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void TBGCRememberRWLink(TB_p bank, Term_p term)
+{
+   assert(TermIsRewritten(term));
+
+   if(bank->gc_young && !TBTermIsYoung(bank, term))
+   {
+      PStackPushP(bank->gc_remembered, term);
+   }
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBGCStartMinor()
+//
+//   Start a minor collection. Until the following TBGCSweepYoung(),
+//   TBGCMarkTerm() only marks young terms.
+//
+// Global Variables: -
+//
+// Side Effects    : Changes bank state.
+//
+/----------------------------------------------------------------------*/
+
+void TBGCStartMinor(TB_p bank)
+{
+   assert(bank->gc_young);
+   assert(!bank->gc_minor);
+
+   bank->gc_minor = true;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TBGCSweepYoung()
+//
+//   Finish a minor collection: Mark the targets of remembered rewrite
+//   links, free all unmarked young term cells, and promote the
+//   survivors into the old generation. Unlike TBGCSweep(), this never
+//   visits old term cells. Returns the number of term cells
+//   recovered.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+long TBGCSweepYoung(TB_p bank)
+{
+   long     recovered = 0;
+   PStackPointer i;
+   Term_p   term;
+
+   assert(bank->gc_minor);
+
+   tb_caches_discard(bank);
+   if(bank->min_term)
+   {
+      TBGCMarkTerm(bank, bank->min_term);
+   }
+   for(i=0; i<PStackGetSP(bank->gc_remembered); i++)
+   {
+      term = PStackElementP(bank->gc_remembered, i);
+      if(TermIsRewritten(term))
+      {
+         TBGCMarkTerm(bank, TermRWReplaceField(term));
+      }
+   }
+   for(i=0; i<PStackGetSP(bank->gc_young); i++)
+   {
+      term = PStackElementP(bank->gc_young, i);
+      if(TBTermCellIsMarked(bank, term))
+      {
+         /* Survivor - reset the mark, the garbage state is not
+            flipped for minor collections */
+         TermCellFlipProp(term, TPGarbageFlag);
+      }
+      else
+      {
+         TermCellStoreDelete(&(bank->term_store), term);
+         recovered++;
+      }
+   }
+   PStackReset(bank->gc_young);
+   PStackReset(bank->gc_remembered);
+   bank->gc_old_limit = bank->in_count;
+   bank->gc_minor     = false;
 
    return recovered;
 }
@@ -41,6 +41,26 @@
 /*                    Data type declarations                           */
 /*---------------------------------------------------------------------*/
 
+/* Variable-disjoint copies made by TBInsertDisjoint(). Renaming adds
+   a fixed offset to each variable id, so the copy of a shared term
+   depends only on the term and can be reused until cells are
+   reclaimed. The cache is an open addressing hash table keyed by the
+   entry_no of the original (which is never 0), kept at most half
+   full. */
+
+typedef struct tb_disjoint_entry_cell
+{
+   unsigned long entry_no;
+   Term_p        copy;
+}TBDisjointEntryCell, *TBDisjointEntry_p;
+
+#define TB_DISJOINT_CACHE_INIT_SIZE 1024
+
+/* Offset added to variable ids by TBInsertDisjoint(). Clause
+   variables are even, so copies have odd variables. */
+
+#define TB_DISJOINT_VAR_OFFSET 1
+
 typedef struct tbcell
 {
    unsigned long in_count;       /* How many terms have been inserted? */
@@ -69,11 +89,34 @@ typedef struct tbcell
                                     get the new value, so that marking
                                     can be done by flipping in the
                                     term cell. */
+   unsigned long gc_old_limit;   /* Terms with entry_no up to this
+                                    value form the old generation, all
+                                    later terms the young one. */
+   PStack_p      gc_young;       /* All young term cells, if
+                                    generational collection is enabled
+                                    (otherwise NULL). */
+   PStack_p      gc_remembered;  /* Old terms that got a rewrite link
+                                    (which may point into the young
+                                    generation) since the last
+                                    collection. */
+   bool          gc_minor;       /* If set, marking only touches the
+                                    young generation. */
    struct gc_admin_cell *gc;     /* Higher level code can register
                                   * garbage collection information
                                   * here. This is only a convenience
                                   * link, memory needs to be managed
                                   * elsewhere. */
+   struct ac_norm_cache_cell *ac_cache; /* AC normal forms of terms
+                                  * in this bank (see
+                                  * cte_acterms.h). Allocated on
+                                  * demand, discarded at each
+                                  * garbage collection. */
+   TBDisjointEntry_p disjoint_cache; /* Copies made by
+                                  * TBInsertDisjoint(). Allocated on
+                                  * demand, discarded at each garbage
+                                  * collection. */
+   unsigned long disjoint_size;  /* Slots in disjoint_cache */
+   unsigned long disjoint_count; /* Used slots in disjoint_cache */
    PDArray_p     ext_index;      /* Associate _external_ abbreviations (=
                                     entry_no's with term nodes, necessary
                                     for parsing of term bank terms. For
@@ -160,8 +203,15 @@ long    TBTermDelPropCount(Term_p term, TermProperties prop);
 
 #define TBTermCellIsMarked(bank, term)                                  \
    (GiveProps((term),TPGarbageFlag)!=(bank)->garbage_state)
+#define TBTermIsYoung(bank, term) ((term)->entry_no > (long)(bank)->gc_old_limit)
+#define TBGCYoungTerms(bank) \
+   ((bank)->gc_young?PStackGetSP((bank)->gc_young):0)
 void    TBGCMarkTerm(TB_p bank, Term_p term);
 long    TBGCSweep(TB_p bank);
+void    TBGCEnableGenerations(TB_p bank);
+void    TBGCRememberRWLink(TB_p bank, Term_p term);
+void    TBGCStartMinor(TB_p bank);
+long    TBGCSweepYoung(TB_p bank);
 Term_p  TBCreateConstTerm(TB_p bank, FunCode const);
 Term_p  TBCreateMinTerm(TB_p bank, FunCode min_const);
 
@@ -134,7 +134,10 @@ typedef struct termcell
    SortType         sort;          /* Sort of the term */
    struct termcell* lson;          /* For storing shared term nodes in */
    struct termcell* rson;          /* a splay tree - see
-                                      cte_termcellstore.[ch] */
+                                      cte_termcellstore.[ch]. For
+                                      variables, lson points to the
+                                      twin variable (see
+                                      VarBankVarAlloc()) */
 }TermCell, *Term_p, **TermRef;
 
 
@@ -143,6 +146,10 @@ typedef uintptr_t DerefType, *DerefType_p;
 #define DEREF_NEVER   0
 #define DEREF_ONCE    1
 #define DEREF_ALWAYS  2
+#define DEREF_OFFSET  3 /* Read each variable as its twin, then
+                           dereference always. This gives a term a
+                           second, implicitly renamed variable
+                           namespace (see TermVarTwin()) */
 
 /* The following is an estimate for the memory taken up by a term cell
    with arguments (the argument array is not counted separately). */
@@ -194,6 +201,7 @@ typedef uintptr_t DerefType, *DerefType_p;
 #define TermIsRRewritten(term) TermCellQueryProp((term), TPIsRRewritten)
 #define TermIsTopRewritten(term) (TermIsRewritten(term)&&TermRWDemodField(term))
 #define TermIsShared(term)       TermCellQueryProp((term), TPIsShared)
+#define TermVarTwin(var)         (assert(TermIsVar(var)),(var)->lson)
 
 #define TermNFDate(term,i) (TermIsRewritten(term)?\
                            SysDateCreationTime():(term)->rw_data.nf_date[i])
@@ -269,7 +277,9 @@ static __inline__ Term_p TermDerefAlways(Term_p term)
 // Function: TermDeref()
 //
 //   Dereference a term. deref* tells us how many derefences to do
-//   at most, it will be decremented for each dereferenciation.
+//   at most, it will be decremented for each dereferenciation. If
+//   *deref is DEREF_OFFSET, a variable is replaced by its twin, and
+//   the binding of the twin (if any) is followed with DEREF_ALWAYS.
 //
 // Global Variables: -
 //
@@ -288,6 +298,19 @@ static __inline__ Term_p TermDeref(Term_p term, DerefType_p deref)
          term = term->binding;
       }
    }
+   else if(*deref == DEREF_OFFSET)
+   {
+      if(TermIsVar(term))
+      {
+         assert(TermVarTwin(term));
+         term = TermVarTwin(term);
+         while(term->binding)
+         {
+            term = term->binding;
+         }
+         *deref = DEREF_ALWAYS;
+      }
+   }
    else
    {
       while(*deref)
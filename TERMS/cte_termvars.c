@@ -18,6 +18,8 @@ Changes
 
 <1> Wed Feb 25 00:48:17 MET 1998
     new
+<2> Wed Oct 21 19:02:45 CEST 2026
+    Link variables with their twins.
 
 -----------------------------------------------------------------------*/
 
@@ -40,6 +42,43 @@ Changes
 /*---------------------------------------------------------------------*/
 
 
+/*-----------------------------------------------------------------------
+//
+// Function: var_bank_cell_alloc()
+//
+//   Create the cell for the variable with the given f_code and sort
+//   and enter it into the variable bank.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations, changes variable bank
+//
+/----------------------------------------------------------------------*/
+
+static Term_p var_bank_cell_alloc(VarBank_p bank, FunCode f_code,
+                                  SortType sort)
+{
+   Term_p var;
+
+   var = TermDefaultCellAlloc();
+   TermCellSetProp(var, TPIsShared);
+
+   var->weight = DEFAULT_VWEIGHT;
+   var->v_count = 1;
+   var->f_count = 0;
+   var->entry_no = f_code;
+   var->f_code = f_code;
+   var->sort = sort;
+
+   PDArrayAssignP(VarBankGetStack(bank, sort), -f_code, var);
+   bank->max_var = MAX(-f_code, bank->max_var);
+
+   assert(var->sort != STNoSort);
+
+   return var;
+}
+
+
 /*-----------------------------------------------------------------------
 //
 // Function: var_named_new
@@ -383,6 +422,12 @@ Term_p VarBankExtNameFind(VarBank_p bank, char* name)
 //   Return a pointer to the newly created variable
 //   with the given f_code and sort in the variable bank.
 //
+//   Variables -2n and -2n+1 (i.e. an even variable and the odd one
+//   TBInsertDisjoint() renames it to) are twins and point to each
+//   other via TermVarTwin(). Even variables are always created
+//   together with their twin, so that terms with even variables can
+//   be read with DEREF_OFFSET.
+//
 // Global Variables: -
 //
 // Side Effects    : May change variable bank
@@ -391,23 +436,20 @@ Term_p VarBankExtNameFind(VarBank_p bank, char* name)
 
 Term_p VarBankVarAlloc(VarBank_p bank, FunCode f_code, SortType sort)
 {
-   Term_p var;
-
-   var = TermDefaultCellAlloc();
-   TermCellSetProp(var, TPIsShared);
-
-   var->weight = DEFAULT_VWEIGHT;
-   var->v_count = 1;
-   var->f_count = 0;
-   var->entry_no = f_code;
-   var->f_code = f_code;
-   var->sort = sort;
-
-   PDArrayAssignP(VarBankGetStack(bank, sort), -f_code, var);
-   bank->max_var = MAX(-f_code, bank->max_var);
-
-   assert(var->sort != STNoSort);
+   Term_p  var, twin;
+   FunCode twin_code = (f_code%2)?f_code-1:f_code+1;
 
+   var  = var_bank_cell_alloc(bank, f_code, sort);
+   twin = PDArrayElementP(VarBankGetStack(bank, sort), -twin_code);
+   if(!twin && !(f_code%2))
+   {
+      twin = var_bank_cell_alloc(bank, twin_code, sort);
+   }
+   if(twin)
+   {
+      var->lson  = twin;
+      twin->lson = var;
+   }
    return var;
 }
 
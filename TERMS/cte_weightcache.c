@@ -0,0 +1,362 @@
+/*-----------------------------------------------------------------------
+
+File  : cte_weightcache.c
+
+Author: Stephan Schulz
+
+Contents
+
+  Cached computation of term weights for heuristic evaluation
+  functions.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 10:12:31 CEST 2026
+    New
+<2> Wed Oct 21 09:12:54 CEST 2026
+    Hash table, cleared after garbage collection.
+<3> Wed Oct 21 18:05:33 CEST 2026
+    Fixed size direct-mapped table, allocated on first use.
+
+-----------------------------------------------------------------------*/
+
+#include "cte_weightcache.h"
+
+
+
+/*---------------------------------------------------------------------*/
+/*                        Global Variables                             */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                      Forward Declarations                           */
+/*---------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------*/
+/*                         Internal Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: weight_cache_slot()
+//
+//   Return the slot for entry_no in cache. It holds the weight of
+//   entry_no if its key is entry_no. Sequential entry numbers are
+//   spread over the table, so that the terms of one clause rarely
+//   share a slot.
+//
+// Global Variables: -
+//
+// Side Effects    : -
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ WeightCacheEntry_p weight_cache_slot(
+   WeightCache_p cache, unsigned long entry_no)
+{
+   unsigned long i;
+
+   i = entry_no*2654435761UL;
+   i = (i^(i>>16))&(WEIGHT_CACHE_SIZE-1);
+   return &(cache->table[i]);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: weight_cache_usable()
+//
+//   Return true if the cache can be used for term from bank. Binds
+//   an unused cache to bank and allocates its table.
+//
+// Global Variables: -
+//
+// Side Effects    : May bind the cache, memory operations
+//
+/----------------------------------------------------------------------*/
+
+static __inline__ bool weight_cache_usable(WeightCache_p cache, TB_p bank,
+                                           Term_p term)
+{
+   long i;
+
+   if(!cache || !bank || !TermIsShared(term))
+   {
+      return false;
+   }
+   if(!cache->bank)
+   {
+      cache->bank  = bank;
+      cache->table = SecureMalloc(WEIGHT_CACHE_SIZE*
+                                  sizeof(WeightCacheEntryCell));
+      for(i=0; i<WEIGHT_CACHE_SIZE; i++)
+      {
+         cache->table[i].entry_no = 0;
+      }
+   }
+   return cache->bank == bank;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: term_fsum_weight_cached()
+//
+//   Compute the weighted FSum of a shared term from the cache
+//   cache, filling in missing values on the way.
+//
+// Global Variables: -
+//
+// Side Effects    : Fills the cache.
+//
+/----------------------------------------------------------------------*/
+
+static long term_fsum_weight_cached(WeightCache_p cache, Term_p term,
+                                    long vweight, long flimit,
+                                    long *fweights, long default_fweight)
+{
+   WeightCacheEntry_p slot;
+   long res;
+   int  i;
+
+   if(TermIsVar(term))
+   {
+      return vweight;
+   }
+   slot = weight_cache_slot(cache, term->entry_no);
+   if(slot->entry_no == term->entry_no)
+   {
+      return slot->weight;
+   }
+   res = term->f_code < flimit? fweights[term->f_code]:default_fweight;
+   for(i = 0; i < term->arity; i++)
+   {
+      res += term_fsum_weight_cached(cache, term->args[i], vweight,
+                                     flimit, fweights, default_fweight);
+   }
+   slot->entry_no = term->entry_no;
+   slot->weight   = res;
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: term_symtype_weight_cached()
+//
+//   Compute the symbol type weight of a shared term from the cache
+//   cache, filling in missing values on the way.
+//
+// Global Variables: -
+//
+// Side Effects    : Fills the cache.
+//
+/----------------------------------------------------------------------*/
+
+static long term_symtype_weight_cached(WeightCache_p cache, Term_p term,
+                                       long vweight, long fweight,
+                                       long cweight, long pweight)
+{
+   WeightCacheEntry_p slot;
+   long res;
+   int  i;
+
+   if(TermIsVar(term))
+   {
+      return vweight;
+   }
+   slot = weight_cache_slot(cache, term->entry_no);
+   if(slot->entry_no == term->entry_no)
+   {
+      return slot->weight;
+   }
+   if(TermCellQueryProp(term,TPPredPos))
+   {
+      res = pweight;
+   }
+   else if(term->arity==0)
+   {
+      res = cweight;
+   }
+   else
+   {
+      res = fweight;
+   }
+   for(i = 0; i < term->arity; i++)
+   {
+      res += term_symtype_weight_cached(cache, term->args[i], vweight,
+                                        fweight, cweight, pweight);
+   }
+   slot->entry_no = term->entry_no;
+   slot->weight   = res;
+
+   return res;
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                         Exported Functions                          */
+/*---------------------------------------------------------------------*/
+
+/*-----------------------------------------------------------------------
+//
+// Function: WeightCacheAlloc()
+//
+//   Allocate an empty, unbound weight cache. The table is allocated
+//   when the cache is first used.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+WeightCache_p WeightCacheAlloc(void)
+{
+   WeightCache_p handle = WeightCacheCellAlloc();
+
+   handle->bank  = NULL;
+   handle->table = NULL;
+
+   return handle;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: WeightCacheFree()
+//
+//   Free a weight cache.
+//
+// Global Variables: -
+//
+// Side Effects    : Memory operations
+//
+/----------------------------------------------------------------------*/
+
+void WeightCacheFree(WeightCache_p junk)
+{
+   if(junk->table)
+   {
+      FREE(junk->table);
+   }
+   WeightCacheCellFree(junk);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TermFsumWeightCached()
+//
+//   As TermFsumWeight(), but use and update cache if possible. cache
+//   may be NULL.
+//
+// Global Variables: -
+//
+// Side Effects    : Fills the cache.
+//
+/----------------------------------------------------------------------*/
+
+long TermFsumWeightCached(WeightCache_p cache, TB_p bank, Term_p term,
+                          long vweight, long flimit, long *fweights,
+                          long default_fweight)
+{
+   if(!weight_cache_usable(cache, bank, term))
+   {
+      return TermFsumWeight(term, vweight, flimit, fweights,
+                            default_fweight);
+   }
+   assert(term_fsum_weight_cached(cache, term, vweight, flimit,
+                                  fweights, default_fweight)
+          == TermFsumWeight(term, vweight, flimit, fweights,
+                            default_fweight));
+   return term_fsum_weight_cached(cache, term, vweight, flimit,
+                                  fweights, default_fweight);
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TermNonLinearWeightCached()
+//
+//   As TermNonLinearWeight(), but use and update cache if
+//   possible. The weight of a subterm depends on the variables
+//   already seen in its context, so only the weights of the terms
+//   queried are cached, not those of their subterms.
+//
+// Global Variables: -
+//
+// Side Effects    : Fills the cache.
+//
+/----------------------------------------------------------------------*/
+
+long TermNonLinearWeightCached(WeightCache_p cache, TB_p bank,
+                               Term_p term, long vlweight,
+                               long vweight, long fweight)
+{
+   WeightCacheEntry_p slot;
+   long res;
+
+   if(TermIsVar(term) || !weight_cache_usable(cache, bank, term))
+   {
+      return TermNonLinearWeight(term, vlweight, vweight, fweight);
+   }
+   slot = weight_cache_slot(cache, term->entry_no);
+   if(slot->entry_no == term->entry_no)
+   {
+      res = slot->weight;
+   }
+   else
+   {
+      res = TermNonLinearWeight(term, vlweight, vweight, fweight);
+      slot->entry_no = term->entry_no;
+      slot->weight   = res;
+   }
+   assert(res == TermNonLinearWeight(term, vlweight, vweight, fweight));
+
+   return res;
+}
+
+
+/*-----------------------------------------------------------------------
+//
+// Function: TermSymTypeWeightCached()
+//
+//   As TermSymTypeWeight(), but use and update cache if possible.
+//
+// Global Variables: -
+//
+// Side Effects    : Fills the cache.
+//
+/----------------------------------------------------------------------*/
+
+long TermSymTypeWeightCached(WeightCache_p cache, TB_p bank,
+                             Term_p term, long vweight, long fweight,
+                             long cweight, long pweight)
+{
+   if(!weight_cache_usable(cache, bank, term))
+   {
+      return TermSymTypeWeight(term, vweight, fweight, cweight,
+                               pweight);
+   }
+   assert(term_symtype_weight_cached(cache, term, vweight,
+                                     fweight, cweight, pweight)
+          == TermSymTypeWeight(term, vweight, fweight, cweight,
+                               pweight));
+   return term_symtype_weight_cached(cache, term, vweight,
+                                     fweight, cweight, pweight);
+}
+
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
@@ -0,0 +1,95 @@
+/*-----------------------------------------------------------------------
+
+File  : cte_weightcache.h
+
+Author: Stephan Schulz
+
+Contents
+
+  Per-heuristic caches for term weights of shared terms. Clause
+  evaluation functions with individual symbol weights traverse the
+  same shared terms over and over again. A cache remembers the
+  weights of recently evaluated shared terms (keyed by their entry_no
+  in the term bank) for one fixed set of weight parameters.
+
+  Copyright 2026 by the author.
+  This code is released under the GNU General Public Licence and
+  the GNU Lesser General Public License.
+  See the file COPYING in the main E directory for details..
+  Run "eprover -h" for contact information.
+
+Changes
+
+<1> Mon Oct 19 10:12:31 CEST 2026
+    New
+<2> Wed Oct 21 09:12:54 CEST 2026
+    Hash table instead of an array indexed by entry_no, cleared at
+    garbage collection.
+<3> Wed Oct 21 18:05:33 CEST 2026
+    Fixed size direct-mapped table, allocated on first use.
+
+-----------------------------------------------------------------------*/
+
+#ifndef CTE_WEIGHTCACHE
+
+#define CTE_WEIGHTCACHE
+
+#include <cte_termbanks.h>
+
+
+/*---------------------------------------------------------------------*/
+/*                    Data type declarations                           */
+/*---------------------------------------------------------------------*/
+
+/* Entry numbers are only unique within one term bank, so a cache is
+   bound to the first bank it sees. Terms from other banks (and
+   unshared terms) are evaluated without the cache. Entry numbers are
+   never reused, so values of terms that have been garbage collected
+   are never wrong, only useless.
+
+   The cache is a direct-mapped table of WEIGHT_CACHE_SIZE slots,
+   keyed by entry_no (which is never 0). A new value simply replaces
+   the one in its slot, so the cache never grows. Most heuristics
+   define many evaluation functions but use only a few of them, so
+   the table is only allocated when the cache is bound to a bank. */
+
+typedef struct weight_cache_entry_cell
+{
+   unsigned long entry_no;
+   long          weight;
+}WeightCacheEntryCell, *WeightCacheEntry_p;
+
+typedef struct weight_cache_cell
+{
+   TB_p               bank;
+   WeightCacheEntry_p table; /* NULL until bound */
+}WeightCacheCell, *WeightCache_p;
+
+#define WEIGHT_CACHE_SIZE 4096 /* Must be a power of 2 */
+
+
+/*---------------------------------------------------------------------*/
+/*                Exported Functions and Variables                     */
+/*---------------------------------------------------------------------*/
+
+#define WeightCacheCellAlloc() (WeightCacheCell*)SizeMalloc(sizeof(WeightCacheCell))
+#define WeightCacheCellFree(junk) SizeFree(junk, sizeof(WeightCacheCell))
+
+WeightCache_p WeightCacheAlloc(void);
+void          WeightCacheFree(WeightCache_p junk);
+
+long TermFsumWeightCached(WeightCache_p cache, TB_p bank, Term_p term,
+                          long vweight, long flimit, long *fweights,
+                          long default_fweight);
+long TermNonLinearWeightCached(WeightCache_p cache, TB_p bank,
+                               Term_p term, long vlweight,
+                               long vweight, long fweight);
+long TermSymTypeWeightCached(WeightCache_p cache, TB_p bank,
+                             Term_p term, long vweight, long fweight,
+                             long cweight, long pweight);
+
+#endif
+
+/*---------------------------------------------------------------------*/
+/*                        End of File                                  */
+/*---------------------------------------------------------------------*/
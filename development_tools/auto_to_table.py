@@ -0,0 +1,312 @@
+#!/usr/bin/env python3
+"""
+auto_to_table.py 1.0
+
+Usage: auto_to_table.py [options] <E source dir> <file> ...
+
+Convert the class/strategy selection of auto-mode files generated by
+generate_auto.py or generate_auto_sched.py (a long if/else chain over
+Spec*() predicates) into the class table format read by
+HEURISTICS/che_autotable.c. The chain section of each file is
+replaced in place, the strategy definitions
+(CHE_PROOFCONTROL_INTERNAL) are kept unchanged.
+
+The name of the table is derived from the file name
+(che_X_____auto.c -> Auto, che_X_auto_sched3.c -> AutoSched3, ...).
+
+Options:
+
+ -h
+--help      Print this information.
+
+ -n
+--dry-run   Print the table to stdout instead of replacing the chain.
+
+Copyright 2026 by the authors.
+
+This code is part of the support structure for the equational
+theorem prover E. Visit
+
+ http://www.eprover.org
+
+for more information.
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program ; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+MA  02111-1307 USA
+"""
+
+import sys
+import re
+import getopt
+import os.path
+
+# Predicate name -> (position in the class string, character). Must
+# agree with class_int in generate_auto.py and with
+# spec_class_string() in che_autotable.c.
+
+class_pred = {
+    "AxiomsAreUnit"       : (0, "U"),
+    "AxiomsAreNonUnitHorn": (0, "H"),
+    "AxiomsAreGeneral"    : (0, "G"),
+    "GoalsAreUnit"        : (1, "U"),
+    "GoalsAreHorn"        : (1, "H"),
+    "NoEq"                : (2, "N"),
+    "SomeEq"              : (2, "S"),
+    "PureEq"              : (2, "P"),
+    "FewNGPosUnits"       : (3, "F"),
+    "SomeNGPosUnits"      : (3, "S"),
+    "ManyNGPosUnits"      : (3, "M"),
+    "GoalsHaveVars"       : (4, "N"),
+    "GoalsAreGround"      : (4, "G"),
+    "FewAxioms"           : (5, "F"),
+    "SomeAxioms"          : (5, "S"),
+    "ManyAxioms"          : (5, "M"),
+    "FewLiterals"         : (6, "F"),
+    "SomeLiterals"        : (6, "S"),
+    "ManyLiterals"        : (6, "M"),
+    "SmallTerms"          : (7, "S"),
+    "MediumTerms"         : (7, "M"),
+    "LargeTerms"          : (7, "L"),
+    "FewGroundPos"        : (8, "F"),
+    "SomeGroundPos"       : (8, "S"),
+    "ManyGroundPos"       : (8, "M"),
+    "MaxFArity0"          : (9, "0"),
+    "MaxFArity1"          : (9, "1"),
+    "MaxFArity2"          : (9, "2"),
+    "MaxFArity3Plus"      : (9, "3"),
+    "AvgFArity0"          : (10, "0"),
+    "AvgFArity1"          : (10, "1"),
+    "AvgFArity2"          : (10, "2"),
+    "AvgFArity3Plus"      : (10, "3"),
+    "SmallFArSum"         : (11, "S"),
+    "MediumFArSum"        : (11, "M"),
+    "LargeFArSum"         : (11, "L"),
+    "ShallowMaxDepth"     : (12, "S"),
+    "MediumMaxDepth"      : (12, "M"),
+    "DeepMaxDepth"        : (12, "D")
+}
+
+class_len = 13
+
+pm_types = {
+    "ParamodPlain"      : "Plain",
+    "ParamodAlwaysSim"  : "AlwaysSim",
+    "ParamodOrientedSim": "OrientedSim"
+}
+
+ac_types = {
+    "NoACHandling"    : "None",
+    "ACDiscardAll"    : "DiscardAll",
+    "ACKeepUnits"     : "KeepUnits",
+    "ACKeepOrientable": "KeepOrientable"
+}
+
+match_chain  = re.compile(
+    r"#if defined\(CHE_HEURISTICS_INTERNAL\) \|\| "
+    r"defined\(TO_ORDERING_INTERNAL\)\n(.*)\n#endif\n", re.S)
+match_branch = re.compile(
+    r"else\s*(?:if\((.*?)\)|/\* Default \*/)\s*\{\s*"
+    r"#ifdef CHE_HEURISTICS_INTERNAL(.*?)#endif\s*"
+    r"#ifdef TO_ORDERING_INTERNAL(.*?)#endif\s*\}", re.S)
+match_pred   = re.compile(r"Spec(\w+)\(spec\)")
+match_res    = re.compile(r'res\s*=\s*"(\w+)"\s*;')
+match_hparm  = re.compile(r"control->heuristic_parms\.(\w+)\s*=\s*([^;]+);")
+match_oparm  = re.compile(r"oparms\.(\w+)\s*=\s*([^;]+);")
+match_assoc  = re.compile(r'\{\s*"(\w+)"\s*,\s*(\w+)\s*\}')
+match_cnames = re.compile(r"\[\]\s*=\s*\{(.*?)\};", re.S)
+match_cenum  = re.compile(r"typedef enum\s*\{(.*?)\}\s*(\w+);", re.S)
+
+
+def read_file(name):
+    fp = open(name, "r")
+    res = fp.read()
+    fp.close()
+    return res
+
+
+def parse_enum(text, typename):
+    """
+    Return the list of identifiers of the (0-based, consecutive)
+    C enum typename in text.
+    """
+    for m in match_cenum.finditer(text):
+        if m.group(2) == typename:
+            body = re.sub(r"/\*.*?\*/", "", m.group(1), flags=re.S)
+            res = []
+            for entry in body.split(","):
+                entry = entry.strip()
+                if not entry:
+                    continue
+                ident = entry.split("=")[0].strip()
+                if "=" in entry and entry.split("=")[1].strip() != "0":
+                    continue
+                res.append(ident)
+            return res
+    raise RuntimeError("enum "+typename+" not found")
+
+
+def parse_names(text, arrayname):
+    """
+    Return the strings in the C array arrayname in text.
+    """
+    start = text.index(arrayname)
+    m = match_cnames.search(text, start)
+    body = re.sub(r"/\*.*?\*/", "", m.group(1), flags=re.S)
+    return re.findall(r'"(\w*)"', body)
+
+
+def name_tables(edir):
+    """
+    Return dictionaries mapping C identifiers to the external names
+    used in tables.
+    """
+    heur = os.path.join(edir, "HEURISTICS")
+    litsel = {}
+    for m in match_assoc.finditer(read_file(os.path.join(heur,
+                                                 "che_litselection.c"))):
+        if not m.group(2) in litsel:
+            litsel[m.group(2)] = m.group(1)
+
+    wenum = parse_enum(read_file(os.path.join(heur, "che_to_weightgen.h")),
+                       "TOWeightGenMethod")
+    wnames = parse_names(read_file(os.path.join(heur, "che_to_weightgen.c")),
+                         "TOWeightGenNames")
+    penum = parse_enum(read_file(os.path.join(heur, "che_to_precgen.h")),
+                       "TOPrecGenMethod")
+    pnames = parse_names(read_file(os.path.join(heur, "che_to_precgen.c")),
+                         "TOPrecGenNames")
+    wgen = dict(zip(wenum, wnames))
+    pgen = dict(zip(penum, pnames))
+    return litsel, wgen, pgen
+
+
+def table_name(filename):
+    base = os.path.basename(filename)
+    m = re.match(r"che_X_auto_sched(\d)\.c$", base)
+    if m:
+        return "AutoSched"+m.group(1)
+    m = re.match(r"che_X_____auto(_casc|_dev)?\.c$", base)
+    if m:
+        return {None:"Auto", "_casc":"AutoCASC", "_dev":"AutoDev"}[m.group(1)]
+    raise RuntimeError("Cannot derive table name from "+filename)
+
+
+def translate_class(disjunct):
+    cl = ["-"]*class_len
+    for pred in match_pred.findall(disjunct):
+        pos, val = class_pred[pred]
+        if cl[pos] != "-":
+            raise RuntimeError("Inconsistent class "+disjunct)
+        cl[pos] = val
+    return "".join(cl)
+
+
+def translate_value(field, value, names):
+    litsel, wgen, pgen = names
+    value = value.strip()
+    if field == "selection_strategy":
+        return litsel[value]
+    if field == "pm_type":
+        return pm_types[value]
+    if field == "ac_handling":
+        return ac_types[value]
+    if field == "to_weight_gen":
+        return wgen[value]
+    if field == "to_prec_gen":
+        return pgen[value]
+    return value
+
+
+def translate_parms(regexp, text, names):
+    res = []
+    for m in regexp.finditer(text):
+        res.append(m.group(1)+"="+translate_value(m.group(1), m.group(2),
+                                                    names))
+    return "["+", ".join(res)+"]"
+
+
+def c_string(line):
+    return '"'+line.replace("\\", "\\\\").replace('"', '\\"')+'\\n"'
+
+
+def convert(filename, names):
+    """
+    Return the file with the chain replaced by the table, and the
+    table as plain text.
+    """
+    text  = read_file(filename)
+    m     = match_chain.search(text)
+    if not m:
+        raise RuntimeError("No selection chain found in "+filename)
+    lines = ["auto_table("+table_name(filename)+")."]
+    mask  = None
+    seen  = {}
+    for b in match_branch.finditer(m.group(1)):
+        cond, hparms, oparms = b.groups()
+        strat  = match_res.search(hparms).group(1)
+        hparms = translate_parms(match_hparm, hparms, names)
+        oparms = translate_parms(match_oparm, oparms, names)
+        if cond is None:
+            lines.append("default("+strat+",")
+            lines.append("   "+hparms+",")
+            lines.append("   "+oparms+").")
+            continue
+        classes = []
+        for disjunct in cond.split("||"):
+            cl = translate_class(disjunct)
+            cmask = re.sub("[^-]", "a", cl)
+            if mask and cmask != mask:
+                raise RuntimeError("Mixed class masks in "+filename)
+            mask = cmask
+            if cl in seen:
+                # Shadowed by an earlier branch of the chain
+                continue
+            seen[cl] = strat
+            classes.append('"'+cl+'"')
+        lines.append("strategy("+strat+",")
+        lines.append("   "+hparms+",")
+        lines.append("   "+oparms+",")
+        for i in range(0, len(classes), 5):
+            sep = "," if i+5 < len(classes) else "])."
+            lines.append(("   [" if i==0 else "    ")+
+                         ", ".join(classes[i:i+5])+sep)
+    table = "\n".join(lines)+"\n"
+    section = "#ifdef CHE_AUTOTABLE_INTERNAL\n\n"+\
+              "\n".join(map(c_string, lines))+"\n#endif\n"
+    return text[:m.start()]+section+text[m.end():], table
+
+
+if __name__ == '__main__':
+    opts, args = getopt.gnu_getopt(sys.argv[1:], "hn", ["help", "dry-run"])
+    dry_run = False
+    for option, optarg in opts:
+        if option == "-h" or option == "--help":
+            print(__doc__)
+            sys.exit()
+        elif option == "-n" or option == "--dry-run":
+            dry_run = True
+    if len(args) < 2:
+        print(__doc__)
+        sys.exit(1)
+
+    names = name_tables(args[0])
+    for filename in args[1:]:
+        newtext, table = convert(filename, names)
+        if dry_run:
+            sys.stdout.write(table)
+        else:
+            fp = open(filename, "w")
+            fp.write(newtext)
+            fp.close()
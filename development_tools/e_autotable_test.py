@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""
+e_autotable_test.py 1.0
+
+Usage: e_autotable_test.py [options]
+
+Regression test for the class tables of the automatic modes. Runs
+e_autotable_check, which enumerates all combinations of the problem
+features used by the tables (1679616 per table), selects a strategy
+for each of them and prints a digest of the mapping for each
+built-in table. The digests are compared with the ones stored in
+e_autotable_test.expected next to this script. A difference means
+that the heuristic or a parameter selected for at least one problem
+class has changed; run e_autotable_check --full on the old and the
+new version and compare the output to find out which ones. The exit
+status is 1 if there are differences, 0 otherwise.
+
+The expected digests were computed from the if/else chains that
+selected the strategies before the class tables replaced them.
+
+Options:
+
+ -h
+--help               Print this information.
+
+ -e <dir>
+--e-dir=<dir>        E source directory (default: the parent directory
+                     of this script).
+
+ -c <prog>
+--check=<prog>       e_autotable_check binary to test (default:
+                     PROVER/e_autotable_check in the E directory).
+
+ -x <file>
+--expected=<file>    File with the expected digests (default:
+                     e_autotable_test.expected next to this script).
+
+ -g
+--generate           Write the expected digests instead of comparing
+                     against them.
+
+Copyright 2026 by the authors.
+
+This code is part of the support structure for the equational
+theorem prover E. Visit
+
+ http://www.eprover.org
+
+for more information.
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program ; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+MA  02111-1307 USA
+"""
+
+import sys
+import os
+import getopt
+import difflib
+import subprocess
+
+
+def main(args):
+    opts, args = getopt.gnu_getopt(args, "he:c:x:g",
+                                   ["help", "e-dir=", "check=",
+                                    "expected=", "generate"])
+    edir     = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    prog     = None
+    expected = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                            "e_autotable_test.expected")
+    generate = False
+    for option, optarg in opts:
+        if option == "-h" or option == "--help":
+            print(__doc__)
+            sys.exit()
+        elif option == "-e" or option == "--e-dir":
+            edir = os.path.abspath(optarg)
+        elif option == "-c" or option == "--check":
+            prog = os.path.abspath(optarg)
+        elif option == "-x" or option == "--expected":
+            expected = optarg
+        elif option == "-g" or option == "--generate":
+            generate = True
+    if not prog:
+        prog = os.path.join(edir, "PROVER", "e_autotable_check")
+
+    proc = subprocess.run([prog], stdout=subprocess.PIPE,
+                          stderr=subprocess.STDOUT)
+    lines = proc.stdout.decode("utf-8", "replace").splitlines()
+    if proc.returncode != 0:
+        lines.append("e_autotable_check: exit status %d"%(proc.returncode,))
+    if generate:
+        fp = open(expected, "w")
+        for line in lines:
+            fp.write(line+"\n")
+        fp.close()
+        print("# %d lines written to %s"%(len(lines), expected))
+        return
+
+    fp = open(expected, "r")
+    reference = fp.read().splitlines()
+    fp.close()
+    diff = list(difflib.unified_diff(reference, lines, "expected",
+                                     "actual", lineterm=""))
+    for line in diff:
+        print(line)
+    print("# Tables checked     : %d"%(len(lines),))
+    print("# Differing tables   : %d"%
+          (len([l for l in diff if l[:1] == "-" and l[:3] != "---"]),))
+    if diff:
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
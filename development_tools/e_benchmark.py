@@ -0,0 +1,573 @@
+#!/usr/bin/env python3
+"""
+e_benchmark.py 1.0
+
+Usage: e_benchmark.py run [options] [problem ...]
+       e_benchmark.py compare [options] <base.json> <new.json>
+
+Reproducible performance benchmark for E.
+
+"run" runs eprover over a fixed problem set (by default the problems
+in EXAMPLE_PROBLEMS/ and PROVER/*.lop, PROVER/*.tptp of the E source
+tree) with a fixed set of strategies, repeating each run several
+times. For every run it records the result (SZS status), all numeric
+values printed by --print-statistics (processed and generated
+clauses, time in each phase of the given-clause loop, ...) and the
+CPU time, wall clock time and peak memory of the process. The results
+are written as a JSON document. Address space randomization is
+disabled for the runs (if setarch is available), so that the search
+itself is deterministic.
+
+"compare" compares two such documents problem by problem. Changed
+results and changed search behaviour (processed/generated clauses) are
+always reported. A time metric counts as a regression (or
+improvement) only if the change of the median exceeds a minimum
+relative change and a Mann-Whitney U test over the repetitions finds
+it significant. If there are too few repetitions for the test to
+ever reach the significance level, a warning is printed and the time
+metrics for these problems are not tested. Peak memory (max_rss) is
+nearly deterministic, so it counts as a regression (or improvement)
+whenever the change of the median exceeds a relative threshold.
+
+In addition, the geometric means of the ratios new/base of the median
+CPU time (over all problems solved in both runs) and of the median
+peak memory (over all problems) are reported. They are tested against
+the same relative thresholds, so that a slowdown or growth spread over
+many problems is reported even if no single problem changes
+significantly. The exit status is 1 if there are regressions, 0
+otherwise.
+
+Options for "run":
+
+ -h
+--help               Print this information.
+
+ -e <dir>
+--e-dir=<dir>        E source directory (default: parent of this script).
+
+ -p <prog>
+--eprover=<prog>     Prover binary (default: <e-dir>/PROVER/eprover).
+
+ -s <name>=<options>
+--strategy=<name>=<options>
+                     Add a strategy (may be repeated). The default
+                     is "auto=--auto" and "default=" (E's default
+                     heuristic and KBO).
+
+ -c <secs>
+--cpu-limit=<secs>   CPU time limit per run (default 10).
+
+ -r <n>
+--repeat=<n>         Number of runs per problem and strategy (default 5,
+                     the smallest number for which the test in
+                     "compare" can be significant at alpha=0.05).
+
+ -o <file>
+--output=<file>      Write results to file (default: stdout).
+
+Options for "compare":
+
+ -m <metric>
+--metric=<metric>    Time metric to test (may be repeated). The default
+                     is "cpu_time" and the per-phase times.
+
+ -a <p>
+--alpha=<p>          Significance level (default 0.05).
+
+ -d <r>
+--min-change=<r>     Minimal relative change of the median (default 0.05).
+
+ -t <secs>
+--min-time=<secs>    Ignore timings with medians below this in both
+                     runs (default 0.05).
+
+ -M <r>
+--rss-change=<r>     Minimal relative change of the median peak memory
+                     (default 0.1). A negative value disables the
+                     memory comparison.
+
+ -j <file>
+--json=<file>        Also write the comparison as JSON to file.
+
+Copyright 2026 by the authors.
+
+This code is part of the support structure for the equational
+theorem prover E. Visit
+
+ http://www.eprover.org
+
+for more information.
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program ; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+MA  02111-1307 USA
+"""
+
+import sys
+import os
+import re
+import json
+import glob
+import math
+import time
+import shutil
+import getopt
+import platform
+import itertools
+import subprocess
+
+default_strategies = [("auto", "--auto"), ("default", "")]
+
+problem_patterns = ["EXAMPLE_PROBLEMS/SMOKETEST/*.p",
+                    "EXAMPLE_PROBLEMS/SMOKETEST/*.lop",
+                    "EXAMPLE_PROBLEMS/TPTP/*.p",
+                    "PROVER/*.lop",
+                    "PROVER/*.tptp"]
+
+solved_status = set(["Theorem", "Unsatisfiable", "CounterSatisfiable",
+                     "Satisfiable", "ContradictoryAxioms"])
+
+# Counters that describe the search. With a fixed binary, strategy
+# and problem they are deterministic, so any change is reported.
+
+search_counters = ["Processed clauses", "Generated clauses"]
+
+match_stat   = re.compile(r"^# ([^:]*[^ :]) *: *(-?[0-9.]+)( s)?$")
+match_status = re.compile(r"^#+ SZS status (\w+)")
+match_phase  = re.compile(r"^Time in ")
+
+
+def parse_output(text):
+    """
+    Return SZS status and the numeric statistics in the output of
+    eprover --print-statistics.
+    """
+    status = "Unknown"
+    stats  = {}
+    for line in text.splitlines():
+        mo = match_status.match(line)
+        if mo:
+            status = mo.group(1)
+            continue
+        mo = match_stat.match(line)
+        if mo:
+            try:
+                value = int(mo.group(2))
+            except ValueError:
+                value = float(mo.group(2))
+            stats[mo.group(1)] = value
+    return status, stats
+
+
+def default_problems(edir):
+    res = []
+    for pattern in problem_patterns:
+        res.extend(sorted(glob.glob(os.path.join(edir, pattern))))
+    return res
+
+
+def run_prover(cmd, cwd):
+    """
+    Run cmd, return output, exit status, wall clock time, CPU time
+    and peak resident set size (KB) of the process.
+    """
+    start = time.time()
+    proc  = subprocess.Popen(cmd, cwd=cwd, stdout=subprocess.PIPE,
+                             stderr=subprocess.STDOUT)
+    out   = proc.stdout.read()
+    pid, status, usage = os.wait4(proc.pid, 0)
+    proc.returncode = status
+    wall  = time.time()-start
+    cpu   = usage.ru_utime+usage.ru_stime
+    rss   = usage.ru_maxrss
+    if sys.platform == "darwin":
+        rss = rss//1024
+    if os.WIFEXITED(status):
+        rc = os.WEXITSTATUS(status)
+    else:
+        rc = -os.WTERMSIG(status)
+    return out.decode("utf-8", "replace"), rc, wall, cpu, rss
+
+
+def run_benchmark(edir, eprover, strategies, problems, cpu_limit, repeat):
+    prefix = []
+    if shutil.which("setarch"):
+        prefix = ["setarch", platform.machine(), "-R"]
+    runs = []
+    for problem in problems:
+        name = os.path.relpath(problem, edir)
+        for sname, soptions in strategies:
+            for rep in range(repeat):
+                cmd = prefix+[eprover, "--print-statistics", "-R",
+                              "--cpu-limit=%d"%(cpu_limit,)]+\
+                      soptions.split()+[os.path.basename(problem)]
+                out, rc, wall, cpu, rss = run_prover(cmd,
+                                                     os.path.dirname(problem))
+                status, stats = parse_output(out)
+                if status == "Unknown" and rc not in [0, 1]:
+                    status = "Error"
+                runs.append({"problem"  : name,
+                             "strategy" : sname,
+                             "rep"      : rep,
+                             "status"   : status,
+                             "exit_code": rc,
+                             "wall_time": round(wall, 4),
+                             "cpu_time" : round(cpu, 4),
+                             "max_rss"  : rss,
+                             "stats"    : stats})
+                sys.stderr.write("%-45s %-10s %-20s %7.3fs\n"%
+                                 (name, sname, status, cpu))
+    version = subprocess.run([eprover, "--version"], stdout=subprocess.PIPE,
+                             stderr=subprocess.STDOUT).stdout
+    return {"meta": {"eprover"   : eprover,
+                     "version"   : version.decode().strip(),
+                     "date"      : time.strftime("%Y-%m-%d %H:%M:%S"),
+                     "host"      : platform.node(),
+                     "machine"   : platform.machine(),
+                     "cpu_limit" : cpu_limit,
+                     "repeat"    : repeat,
+                     "strategies": dict(strategies)},
+            "runs": runs}
+
+
+def median(values):
+    values = sorted(values)
+    n = len(values)
+    if n % 2:
+        return values[n//2]
+    return (values[n//2-1]+values[n//2])/2.0
+
+
+def ranks(values):
+    """
+    Return the ranks (1-based, average ranks for ties) of values.
+    """
+    order = sorted(range(len(values)), key=lambda i: values[i])
+    res = [0.0]*len(values)
+    i = 0
+    while i < len(order):
+        j = i
+        while j+1 < len(order) and values[order[j+1]] == values[order[i]]:
+            j += 1
+        for k in range(i, j+1):
+            res[order[k]] = (i+j)/2.0+1
+        i = j+1
+    return res
+
+
+def mann_whitney_p(xs, ys):
+    """
+    Two-sided p-value of the Mann-Whitney U test for the samples xs,
+    ys. Exact (by enumeration of all rank assignments) for small
+    samples, normal approximation otherwise.
+    """
+    n, m = len(xs), len(ys)
+    if n == 0 or m == 0:
+        return 1.0
+    r = ranks(list(xs)+list(ys))
+    observed = sum(r[:n])
+    mean = n*(n+m+1)/2.0
+    if math.comb(n+m, n) <= 20000:
+        dev = abs(observed-mean)
+        extreme = 0
+        total = 0
+        for combo in itertools.combinations(r, n):
+            total += 1
+            if abs(sum(combo)-mean) >= dev-1e-9:
+                extreme += 1
+        return extreme/total
+    sd = math.sqrt(n*m*(n+m+1)/12.0)
+    if sd == 0:
+        return 1.0
+    z = (abs(observed-mean)-0.5)/sd
+    return math.erfc(z/math.sqrt(2))
+
+
+def mann_whitney_min_p(n, m):
+    """
+    Smallest two-sided p-value the exact Mann-Whitney U test can
+    produce for samples of size n and m (all values of one sample
+    ranked below all values of the other).
+    """
+    if n == 0 or m == 0:
+        return 1.0
+    return min(1.0, 2.0/math.comb(n+m, n))
+
+
+def load(filename):
+    fp = open(filename, "r")
+    res = json.load(fp)
+    fp.close()
+    return res
+
+
+def group_runs(data):
+    res = {}
+    for run in data["runs"]:
+        res.setdefault((run["problem"], run["strategy"]), []).append(run)
+    return res
+
+
+def run_metric(run, metric):
+    if metric in run:
+        return run[metric]
+    return run["stats"].get(metric)
+
+
+def time_metrics(data):
+    res = set()
+    for run in data["runs"]:
+        for key in run["stats"]:
+            if match_phase.match(key):
+                res.add(key)
+    return ["cpu_time"]+sorted(res)
+
+
+def geo_mean(ratios):
+    if not ratios:
+        return 1.0
+    return math.exp(sum(map(math.log, ratios))/len(ratios))
+
+
+def aggregate_finding(metric, ratios, threshold):
+    """
+    Return a finding for the geometric mean of ratios if it deviates
+    from 1 by more than threshold, None otherwise.
+    """
+    geo = geo_mean(ratios)
+    if threshold < 0 or not ratios or abs(geo-1.0) <= threshold:
+        return None
+    return {"problem": "(geometric mean)", "strategy": "(all)",
+            "kind": "regression" if geo > 1.0 else "improvement",
+            "metric": metric, "base": 1.0, "new": geo,
+            "change": round(geo-1.0, 4), "count": len(ratios)}
+
+
+def compare(base, new, metrics, alpha, min_change, min_time, rss_change):
+    """
+    Compare two benchmark runs. Return a list of findings, each a
+    dictionary with problem, strategy, kind, and details, and the
+    geometric mean CPU time and memory ratios with the number of
+    problems they are computed from.
+    """
+    b_runs = group_runs(base)
+    n_runs = group_runs(new)
+    res = []
+    ratios = []
+    rss_ratios = []
+    too_small = set()
+    for key in sorted(set(b_runs)|set(n_runs)):
+        problem, strategy = key
+        finding = {"problem": problem, "strategy": strategy}
+        if key not in b_runs or key not in n_runs:
+            res.append(dict(finding, kind="missing",
+                            detail="only in "+("new" if key in n_runs
+                                               else "base")))
+            continue
+        b, n = b_runs[key], n_runs[key]
+        b_status, n_status = b[0]["status"], n[0]["status"]
+        b_solved = b_status in solved_status
+        n_solved = n_status in solved_status
+        if b_status != n_status:
+            kind = "changed"
+            if b_solved and not n_solved:
+                kind = "regression"
+            elif n_solved and not b_solved:
+                kind = "improvement"
+            res.append(dict(finding, kind=kind, metric="status",
+                            base=b_status, new=n_status))
+            continue
+        for counter in search_counters:
+            bv, nv = run_metric(b[0], counter), run_metric(n[0], counter)
+            if bv != nv:
+                res.append(dict(finding, kind="search", metric=counter,
+                                base=bv, new=nv))
+        bv = [r.get("max_rss", 0) for r in b]
+        nv = [r.get("max_rss", 0) for r in n]
+        bm, nm = median(bv), median(nv)
+        if rss_change >= 0 and bm > 0 and nm > 0:
+            rss_ratios.append(nm/bm)
+            change = (nm-bm)/bm
+            if abs(change) > rss_change:
+                res.append(dict(finding,
+                                kind="regression" if change > 0 else
+                                "improvement",
+                                metric="max_rss", base=bm, new=nm,
+                                change=round(change, 4)))
+        for metric in metrics:
+            bv = [run_metric(r, metric) for r in b]
+            nv = [run_metric(r, metric) for r in n]
+            if None in bv or None in nv:
+                continue
+            bm, nm = median(bv), median(nv)
+            if metric == "cpu_time" and b_solved and bm > 0 and nm > 0:
+                ratios.append(nm/bm)
+            if max(bm, nm) < min_time:
+                continue
+            change = (nm-bm)/bm if bm > 0 else float("inf")
+            if abs(change) < min_change:
+                continue
+            if mann_whitney_min_p(len(bv), len(nv)) >= alpha:
+                too_small.add((len(bv), len(nv)))
+                continue
+            p = mann_whitney_p(bv, nv)
+            if p >= alpha:
+                continue
+            res.append(dict(finding,
+                            kind="regression" if change > 0 else
+                            "improvement",
+                            metric=metric, base=bm, new=nm,
+                            change=round(change, 4), p=round(p, 4)))
+    for n, m in sorted(too_small):
+        sys.stderr.write("Warning: %d vs. %d repetitions can never be "
+                         "significant at alpha=%g (minimal p=%.3f), "
+                         "timings not tested\n"%
+                         (n, m, alpha, mann_whitney_min_p(n, m)))
+    for metric, values, threshold in \
+        [("cpu_time", ratios, min_change),
+         ("max_rss", rss_ratios, rss_change)]:
+        finding = aggregate_finding(metric, values, threshold)
+        if finding:
+            res.append(finding)
+    return res, geo_mean(ratios), len(ratios), \
+        geo_mean(rss_ratios), len(rss_ratios)
+
+
+def print_comparison(findings, geo, count, rss_geo, rss_count, alpha):
+    for f in findings:
+        if "p" in f:
+            print("%-12s %-40s %-8s %-32s %8.3f -> %8.3f (%+.1f%%, p=%.3f)"%
+                  (f["kind"], f["problem"], f["strategy"], f["metric"],
+                   f["base"], f["new"], 100*f["change"], f["p"]))
+        elif "change" in f:
+            print("%-12s %-40s %-8s %-32s %8.3f -> %8.3f (%+.1f%%)"%
+                  (f["kind"], f["problem"], f["strategy"], f["metric"],
+                   f["base"], f["new"], 100*f["change"]))
+        elif "metric" in f:
+            print("%-12s %-40s %-8s %-32s %s -> %s"%
+                  (f["kind"], f["problem"], f["strategy"], f["metric"],
+                   f["base"], f["new"]))
+        else:
+            print("%-12s %-40s %-8s %s"%
+                  (f["kind"], f["problem"], f["strategy"], f["detail"]))
+    kinds = [f["kind"] for f in findings]
+    print("# Problems/strategies compared  : %d"%(count,))
+    print("# Geometric mean CPU time ratio : %.4f"%(geo,))
+    print("# Geometric mean peak mem. ratio: %.4f (%d problems)"%
+          (rss_geo, rss_count))
+    print("# Regressions (alpha=%.2f)      : %d"%(alpha,
+                                                 kinds.count("regression")))
+    print("# Improvements                  : %d"%(kinds.count("improvement"),))
+    print("# Changed search behaviour      : %d"%(kinds.count("search"),))
+
+
+def main_run(args):
+    opts, args = getopt.gnu_getopt(args, "he:p:s:c:r:o:",
+                                   ["help", "e-dir=", "eprover=",
+                                    "strategy=", "cpu-limit=", "repeat=",
+                                    "output="])
+    edir       = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    eprover    = None
+    strategies = []
+    cpu_limit  = 10
+    repeat     = 5
+    output     = None
+    for option, optarg in opts:
+        if option == "-h" or option == "--help":
+            print(__doc__)
+            sys.exit()
+        elif option == "-e" or option == "--e-dir":
+            edir = os.path.abspath(optarg)
+        elif option == "-p" or option == "--eprover":
+            eprover = os.path.abspath(optarg)
+        elif option == "-s" or option == "--strategy":
+            name, sep, options = optarg.partition("=")
+            strategies.append((name, options))
+        elif option == "-c" or option == "--cpu-limit":
+            cpu_limit = int(optarg)
+        elif option == "-r" or option == "--repeat":
+            repeat = int(optarg)
+        elif option == "-o" or option == "--output":
+            output = optarg
+    if not eprover:
+        eprover = os.path.join(edir, "PROVER", "eprover")
+    if not strategies:
+        strategies = default_strategies
+    problems = [os.path.abspath(p) for p in args] or default_problems(edir)
+
+    res = run_benchmark(edir, eprover, strategies, problems, cpu_limit,
+                        repeat)
+    fp = open(output, "w") if output else sys.stdout
+    json.dump(res, fp, indent=1, sort_keys=True)
+    fp.write("\n")
+    if output:
+        fp.close()
+
+
+def main_compare(args):
+    opts, args = getopt.gnu_getopt(args, "hm:a:d:t:M:j:",
+                                   ["help", "metric=", "alpha=",
+                                    "min-change=", "min-time=",
+                                    "rss-change=", "json="])
+    metrics    = []
+    alpha      = 0.05
+    min_change = 0.05
+    min_time   = 0.05
+    rss_change = 0.1
+    jsonfile   = None
+    for option, optarg in opts:
+        if option == "-h" or option == "--help":
+            print(__doc__)
+            sys.exit()
+        elif option == "-m" or option == "--metric":
+            metrics.append(optarg)
+        elif option == "-a" or option == "--alpha":
+            alpha = float(optarg)
+        elif option == "-d" or option == "--min-change":
+            min_change = float(optarg)
+        elif option == "-t" or option == "--min-time":
+            min_time = float(optarg)
+        elif option == "-M" or option == "--rss-change":
+            rss_change = float(optarg)
+        elif option == "-j" or option == "--json":
+            jsonfile = optarg
+    if len(args) != 2:
+        print(__doc__)
+        sys.exit(1)
+    base, new = load(args[0]), load(args[1])
+    if not metrics:
+        metrics = time_metrics(base)
+    findings, geo, count, rss_geo, rss_count = \
+        compare(base, new, metrics, alpha, min_change, min_time, rss_change)
+    print_comparison(findings, geo, count, rss_geo, rss_count, alpha)
+    if jsonfile:
+        fp = open(jsonfile, "w")
+        json.dump({"findings": findings, "geo_mean_cpu_ratio": geo,
+                   "compared": count, "geo_mean_rss_ratio": rss_geo,
+                   "compared_rss": rss_count}, fp, indent=1,
+                  sort_keys=True)
+        fp.write("\n")
+        fp.close()
+    if "regression" in [f["kind"] for f in findings]:
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2 or sys.argv[1] not in ["run", "compare"]:
+        print(__doc__)
+        sys.exit(1)
+    if sys.argv[1] == "run":
+        main_run(sys.argv[2:])
+    else:
+        main_compare(sys.argv[2:])
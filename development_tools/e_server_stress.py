@@ -0,0 +1,260 @@
+#!/usr/bin/env python3
+"""
+e_server_stress.py 1.0
+
+Usage: e_server_stress.py [options] <e_server> <spec_file>
+
+Loopback stress test for e_server: Start the server on a local port,
+open many simultaneous connections, and have each send a number of
+"echo " requests of random size (some of them larger than the socket
+buffers, some split over several writes). Every reply must be the
+payload of the corresponding request, in order. The connections are
+driven by a single non-blocking client process. Exits with status 0
+if all replies are correct, 1 otherwise.
+
+Options:
+
+ -h
+--help              Print this information.
+
+ -c <n>
+--connections=<n>   Number of simultaneous connections (default 1000).
+
+ -m <n>
+--messages=<n>      Number of requests per connection (default 20).
+
+ -s <n>
+--max-size=<n>      Maximal payload size in bytes (default 200000).
+
+ -P <n>
+--port=<n>          Port for the server (default 3667).
+
+ -t <n>
+--timeout=<n>       Give up after n seconds (default 120).
+
+Copyright 2026 by the authors.
+
+This code is part of the support structure for the equational
+theorem prover E. Visit
+
+ http://www.eprover.org
+
+for more information.
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program ; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+MA  02111-1307 USA
+"""
+
+import sys
+import os
+import time
+import random
+import socket
+import struct
+import getopt
+import resource
+import selectors
+import subprocess
+
+echo_cmd = b"echo "
+
+
+def pack(payload):
+    """
+    Frame a message as expected by e_server (4 byte length in network
+    byte order, including the length field, then the payload).
+    """
+    return struct.pack(">I", len(payload)+4)+payload
+
+
+def make_payload(rng, max_size):
+    """
+    Return a random printable payload. Most requests are small, some
+    are large.
+    """
+    if rng.random() < 0.1:
+        size = rng.randint(max_size//2, max_size)
+    else:
+        size = rng.randint(0, 200)
+    block = bytes(rng.randrange(33, 127) for i in range(64))
+    return (block*(size//64+1))[:size]
+
+
+class client(object):
+    """
+    One connection with its pending requests and expected replies.
+    """
+    def __init__(self, port, messages, max_size, seed):
+        rng = random.Random(seed)
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        self.sock.setblocking(False)
+        self.sock.connect_ex(("127.0.0.1", port))
+        self.expected = [make_payload(rng, max_size) for i in range(messages)]
+        # Send in random chunks to exercise partial frames
+        data = b"".join(pack(echo_cmd+p) for p in self.expected)
+        self.out     = memoryview(data)
+        self.chunk   = rng.choice([7, 1000, 65536, len(data)])
+        self.inbuf   = bytearray()
+        self.replies = 0
+        self.sent    = len(data)
+        self.error   = None
+
+    def fileno(self):
+        return self.sock.fileno()
+
+    def done(self):
+        return self.error or self.replies == len(self.expected)
+
+    def write(self):
+        while self.out:
+            try:
+                res = self.sock.send(self.out[:self.chunk])
+            except BlockingIOError:
+                return
+            except OSError as e:
+                self.error = "send: "+str(e)
+                return
+            self.out = self.out[res:]
+
+    def read(self):
+        try:
+            data = self.sock.recv(262144)
+        except BlockingIOError:
+            return
+        except OSError as e:
+            self.error = "recv: "+str(e)
+            return
+        if not data:
+            self.error = "connection closed after %d replies"%(self.replies,)
+            return
+        self.inbuf += data
+        while len(self.inbuf) >= 4:
+            length = struct.unpack(">I", self.inbuf[:4])[0]
+            if len(self.inbuf) < length:
+                break
+            msg = bytes(self.inbuf[4:length])
+            del self.inbuf[:length]
+            if self.replies >= len(self.expected):
+                self.error = "unexpected reply"
+            elif msg != self.expected[self.replies]:
+                self.error = "reply %d corrupted (%d bytes, expected %d)"%\
+                             (self.replies, len(msg),
+                              len(self.expected[self.replies]))
+            self.replies += 1
+
+    def events(self):
+        if self.out:
+            return selectors.EVENT_READ|selectors.EVENT_WRITE
+        return selectors.EVENT_READ
+
+
+def wait_for_server(port, timeout):
+    end = time.time()+timeout
+    while time.time() < end:
+        try:
+            s = socket.create_connection(("127.0.0.1", port))
+            s.close()
+            return True
+        except OSError:
+            time.sleep(0.05)
+    return False
+
+
+def raise_fd_limit(needed):
+    soft, hard = resource.getrlimit(resource.RLIMIT_NOFILE)
+    if soft < needed:
+        resource.setrlimit(resource.RLIMIT_NOFILE, (hard, hard))
+
+
+def run(server, spec, connections, messages, max_size, port, timeout):
+    raise_fd_limit(connections+64)
+    proc = subprocess.Popen([server, "--service-port=%d"%(port,), spec],
+                            stdout=subprocess.DEVNULL)
+    try:
+        if not wait_for_server(port, 10):
+            print("e_server did not start")
+            return False
+        start = time.time()
+        clients = [client(port, messages, max_size, i)
+                   for i in range(connections)]
+        sel = selectors.DefaultSelector()
+        for c in clients:
+            sel.register(c, c.events())
+        active = len(clients)
+        while active and time.time()-start < timeout:
+            for key, mask in sel.select(1.0):
+                c = key.fileobj
+                if mask & selectors.EVENT_WRITE:
+                    c.write()
+                if mask & selectors.EVENT_READ:
+                    c.read()
+                if c.done():
+                    sel.unregister(c)
+                    active -= 1
+                else:
+                    sel.modify(c, c.events())
+        elapsed = time.time()-start
+
+        failed = [c for c in clients if not c.done() or c.error]
+        sent   = sum(c.sent for c in clients)
+        print("Connections: %d, requests: %d, bytes sent: %d"%\
+              (connections, connections*messages, sent))
+        print("Time: %.2fs, %.0f requests/s, %.1f MB/s"%\
+              (elapsed, connections*messages/elapsed,
+               2*sent/elapsed/1000000))
+        for c in failed[:10]:
+            print("Failed:", c.error or "timeout after %d replies"%\
+                  (c.replies,))
+        print("Failed connections: %d"%(len(failed),))
+        if proc.poll() is not None:
+            print("e_server terminated with status %d"%(proc.returncode,))
+            return False
+        for c in clients:
+            c.sock.close()
+        return not failed
+    finally:
+        proc.kill()
+        proc.wait()
+
+
+if __name__ == '__main__':
+    opts, args = getopt.gnu_getopt(sys.argv[1:], "hc:m:s:P:t:",
+                                   ["help", "connections=", "messages=",
+                                    "max-size=", "port=", "timeout="])
+    connections = 1000
+    messages    = 20
+    max_size    = 200000
+    port        = 3667
+    timeout     = 120
+    for option, optarg in opts:
+        if option == "-h" or option == "--help":
+            print(__doc__)
+            sys.exit()
+        elif option == "-c" or option == "--connections":
+            connections = int(optarg)
+        elif option == "-m" or option == "--messages":
+            messages = int(optarg)
+        elif option == "-s" or option == "--max-size":
+            max_size = int(optarg)
+        elif option == "-P" or option == "--port":
+            port = int(optarg)
+        elif option == "-t" or option == "--timeout":
+            timeout = int(optarg)
+    if len(args) != 2:
+        print(__doc__)
+        sys.exit(1)
+
+    ok = run(args[0], args[1], connections, messages, max_size, port, timeout)
+    sys.exit(0 if ok else 1)
@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""
+e_spec_features_test.py 1.0
+
+Usage: e_spec_features_test.py [options] [problem ...]
+
+Regression test for the problem features used for automatic strategy
+selection. Runs classify_problem over a fixed problem set (by default
+the problems in EXAMPLE_PROBLEMS/ and PROVER/*.lop of the E source
+tree that do not include missing axiom files), once for the clause set features and problem class and once
+for the raw (-r) features, and compares the output with the expected
+output stored in e_spec_features_test.expected next to this
+script. Any difference changes the strategies selected by the
+automatic modes, so it is reported as an error. The exit status is 1
+if there are differences, 0 otherwise.
+
+The expected output was produced with the original implementation
+that computed each feature in a separate pass over the clause set.
+
+Options:
+
+ -h
+--help               Print this information.
+
+ -e <dir>
+--e-dir=<dir>        E source directory (default: the parent directory
+                     of this script).
+
+ -c <prog>
+--classify=<prog>    classify_problem binary to test (default:
+                     PROVER/classify_problem in the E directory).
+
+ -x <file>
+--expected=<file>    File with the expected output (default:
+                     e_spec_features_test.expected next to this
+                     script).
+
+ -g
+--generate           Write the expected output file instead of
+                     comparing against it.
+
+Copyright 2026 by the authors.
+
+This code is part of the support structure for the equational
+theorem prover E. Visit
+
+ http://www.eprover.org
+
+for more information.
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program ; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston,
+MA  02111-1307 USA
+"""
+
+import sys
+import os
+import re
+import glob
+import getopt
+import difflib
+import subprocess
+
+problem_patterns = ["EXAMPLE_PROBLEMS/SMOKETEST/*.p",
+                    "EXAMPLE_PROBLEMS/SMOKETEST/*.lop",
+                    "EXAMPLE_PROBLEMS/TPTP/*.p",
+                    "PROVER/*.lop"]
+
+modes = [[], ["-r"]]
+
+match_include = re.compile(r"^\s*include\('([^']*)'")
+
+
+def includes_available(problem):
+    """
+    Return True if all files included by problem exist (relative to
+    the directory of the problem, as for the TPTP example problems).
+    """
+    fp = open(problem, "r")
+    text = fp.read()
+    fp.close()
+    for line in text.splitlines():
+        mo = match_include.match(line)
+        if mo and not os.path.exists(os.path.join(os.path.dirname(problem),
+                                                  mo.group(1))):
+            return False
+    return True
+
+
+def default_problems(edir):
+    """
+    Return the default problems. Some of the example problems include
+    axiom files that are not part of the E distribution, these are
+    skipped.
+    """
+    res = []
+    for pattern in problem_patterns:
+        res.extend(p for p in sorted(glob.glob(os.path.join(edir, pattern)))
+                   if includes_available(p))
+    return res
+
+
+def classify(edir, classify_prog, problems):
+    """
+    Run classify_prog in all modes on all problems (with names
+    relative to edir, so that the output does not depend on where
+    the tree is). Return the list of output lines.
+    """
+    res = []
+    env = dict(os.environ)
+    for problem in problems:
+        name = os.path.relpath(problem, edir)
+        # TPTP includes are relative to the TPTP directory
+        env["TPTP"] = os.path.dirname(problem)
+        for mode in modes:
+            proc = subprocess.run([classify_prog]+mode+[name], cwd=edir,
+                                  env=env, stdout=subprocess.PIPE,
+                                  stderr=subprocess.STDOUT)
+            out = proc.stdout.decode("utf-8", "replace")
+            if proc.returncode != 0:
+                out += "%s: exit status %d\n"%(name, proc.returncode)
+            res.extend(out.splitlines())
+    return res
+
+
+def main(args):
+    opts, args = getopt.gnu_getopt(args, "he:c:x:g",
+                                   ["help", "e-dir=", "classify=",
+                                    "expected=", "generate"])
+    edir     = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    prog     = None
+    expected = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                            "e_spec_features_test.expected")
+    generate = False
+    for option, optarg in opts:
+        if option == "-h" or option == "--help":
+            print(__doc__)
+            sys.exit()
+        elif option == "-e" or option == "--e-dir":
+            edir = os.path.abspath(optarg)
+        elif option == "-c" or option == "--classify":
+            prog = os.path.abspath(optarg)
+        elif option == "-x" or option == "--expected":
+            expected = optarg
+        elif option == "-g" or option == "--generate":
+            generate = True
+    if not prog:
+        prog = os.path.join(edir, "PROVER", "classify_problem")
+    problems = [os.path.abspath(p) for p in args] or default_problems(edir)
+
+    lines = classify(edir, prog, problems)
+    if generate:
+        fp = open(expected, "w")
+        for line in lines:
+            fp.write(line+"\n")
+        fp.close()
+        print("# %d lines written to %s"%(len(lines), expected))
+        return
+
+    fp = open(expected, "r")
+    reference = fp.read().splitlines()
+    fp.close()
+    if args:
+        # Only compare the lines for the selected problems
+        names = set(os.path.relpath(p, edir)+" " for p in problems)
+        reference = [l for l in reference
+                     if l.split(":")[0] in names]
+    diff = list(difflib.unified_diff(reference, lines, "expected",
+                                     "actual", lineterm=""))
+    for line in diff:
+        print(line)
+    print("# Problems checked   : %d"%(len(problems),))
+    print("# Differing lines    : %d"%
+          (len([l for l in diff if l[:1] in "+-" and l[:3] not in
+                ["+++", "---"]]),))
+    if diff:
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])